@@ -1,11 +1,10 @@
 // C++ Standard Library
 #include <iomanip>
 #include <iostream>
-#include <optional>
 #include <vector>
 
 // MF
-#include <mf/multi_field_array.hpp>
+#include <mf/packed_multi_field_array.hpp>
 
 template <typename... Ts> class Registry
 {
@@ -20,9 +19,6 @@ public:
     {
       available_[i] = initial_size - i - 1UL;
     }
-
-    // Set activity flags
-    std::fill(storage_.template begin<bool>(), storage_.template end<bool>(), false);
   }
 
   std::size_t create()
@@ -31,10 +27,9 @@ public:
     {
       const std::size_t previous_size = storage_.size();
 
+      // New activity flags are cleared, and new entities have no components
       storage_.resize(2UL * previous_size);
 
-      std::fill(storage_.template begin<bool>() + previous_size, storage_.template end<bool>(), false);
-
       const std::size_t current_size = storage_.size();
 
       for (std::size_t i = 0; i < previous_size; ++i)
@@ -56,70 +51,40 @@ public:
   template <typename ComponentT, typename... ComponentCTorArgTs>
   void emplace(const std::size_t id, ComponentCTorArgTs&&... ctor_args)
   {
-    storage_.template get<std::optional<ComponentT>>(id).emplace(std::forward<ComponentCTorArgTs>(ctor_args)...);
+    storage_.template emplace<ComponentT>(id, std::forward<ComponentCTorArgTs>(ctor_args)...);
   }
 
   inline std::size_t component_count(const std::size_t id) const
   {
-    return ((static_cast<bool>(storage_.template get<std::optional<Ts>>(id)) ? 1UL : 0UL) + ...);
+    return ((storage_.template has<Ts>(id) ? 1UL : 0UL) + ...);
   }
 
   template <typename... ComponentTs> const bool has(const std::size_t id) const
   {
-    return (static_cast<bool>(storage_.template get<std::optional<ComponentTs>>(id)) and ...);
+    return storage_.template has<ComponentTs...>(id);
   }
 
   template <typename... ComponentTs> decltype(auto) get(const std::size_t id)
   {
     MF_ASSERT(Registry::has<ComponentTs...>(id));
-    if constexpr (sizeof...(ComponentTs) > 1)
-    {
-      return std::tuple<ComponentTs&...>{storage_.template get<std::optional<ComponentTs>>(id).value()...};
-    }
-    else
-    {
-      return std::get<0>(std::tuple<ComponentTs&...>{storage_.template get<std::optional<ComponentTs>>(id).value()...});
-    }
+    return storage_.template get<ComponentTs...>(id);
   }
 
   template <typename... ComponentTs> decltype(auto) get(const std::size_t id) const
   {
     MF_ASSERT(Registry::has<ComponentTs...>(id));
-    if constexpr (sizeof...(ComponentTs) > 1)
-    {
-      return std::tuple<const ComponentTs&...>{storage_.template get<std::optional<ComponentTs>>(id).value()...};
-    }
-    else
-    {
-      return std::get<0>(
-        std::tuple<const ComponentTs&...>{storage_.template get<std::optional<ComponentTs>>(id).value()...});
-    }
+    return storage_.template get<ComponentTs...>(id);
   }
 
   template <typename... ComponentTs, typename CallbackT> void for_each(CallbackT&& callback)
   {
-    for (std::size_t id = 0; id < storage_.size(); ++id)
-    {
-      if (Registry::is_active(id) and Registry::has<ComponentTs...>(id))
-      {
-        std::apply(
-          std::forward<CallbackT>(callback),
-          std::forward_as_tuple(storage_.template get<std::optional<ComponentTs>>(id).value()...));
-      }
-    }
+    // Components are removed when an entity is erased, so only active entities have components
+    storage_.template for_each_present<ComponentTs...>(std::forward<CallbackT>(callback));
   }
 
   template <typename... ComponentTs, typename CallbackT> void for_each(CallbackT&& callback) const
   {
-    for (std::size_t id = 0; id < storage_.size(); ++id)
-    {
-      if (Registry::is_active(id) and Registry::has<ComponentTs...>(id))
-      {
-        std::apply(
-          std::forward<CallbackT>(callback),
-          std::forward_as_tuple(storage_.template get<std::optional<ComponentTs>>(id).value()...));
-      }
-    }
+    storage_.template for_each_present<ComponentTs...>(std::forward<CallbackT>(callback));
   }
 
   void erase(const std::size_t id)
@@ -131,8 +96,7 @@ public:
     storage_.template get<bool>(id) = false;
 
     // Deconstruct all components
-    mf::tuple_for_each(
-      [](auto& component) { component = std::nullopt; }, storage_.template get<std::optional<Ts>...>(id));
+    (storage_.template reset<Ts>(id), ...);
 
     // Make entity available again
     available_.push_back(id);
@@ -140,13 +104,8 @@ public:
 
   void clear()
   {
-    for (std::size_t id = 0; id < storage_.size(); ++id)
-    {
-      if (is_active(id))
-      {
-        Registry::erase(id);
-      }
-    }
+    // Visit only active entities, 64 activity flags at a time
+    storage_.template bits<0>().for_each_set([this](const std::size_t id) { Registry::erase(id); });
   }
 
   inline bool is_active(const std::size_t id) const { return storage_.template get<bool>(id); }
@@ -158,7 +117,7 @@ public:
   inline std::size_t available() const { return available_.size(); }
 
 private:
-  mf::multi_field_array<bool, std::optional<Ts>...> storage_;
+  mf::packed_multi_field_array<bool, mf::nullable<Ts>...> storage_;
   std::vector<std::size_t> available_;
 };
 
@@ -0,0 +1,298 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/single_pass_layout.hpp>
+#include <mf/support/tuple_for_each.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Bump-pointer memory arena
+ *
+ *        Memory is handed out from a single, fixed-length buffer by advancing an offset. Individual allocations
+ *        are never freed; instead, all allocations are released at once with \c reset. The most recent allocation
+ *        may be grown or shrunk in place.
+ *
+ *        Arenas may be neither copied nor moved, since allocator adapters refer to their arena by address; a moved
+ *        arena would leave adapters and the moved-from object handing out memory owned by the new arena.
+ */
+class MonotonicArena
+{
+public:
+  /**
+   * @brief Creates an arena which owns a buffer of \c length bytes
+   */
+  explicit MonotonicArena(const std::size_t length) :
+      owned_buffer_{new std::uint8_t[length]},
+      buffer_{owned_buffer_.get()},
+      length_{length},
+      top_{0UL}
+  {}
+
+  /**
+   * @brief Creates an arena which hands out memory from an existing \c buffer of \c length bytes
+   *
+   * @warn \c buffer must outlive the arena and all allocations made from it
+   */
+  MonotonicArena(std::uint8_t* const buffer, const std::size_t length) :
+      owned_buffer_{nullptr},
+      buffer_{buffer},
+      length_{length},
+      top_{0UL}
+  {}
+
+  MonotonicArena(MonotonicArena&&) = delete;
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(MonotonicArena&&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  /**
+   * @brief Allocates \c length bytes, starting at an address which is a multiple of \c alignment
+   *
+   * @throws \c std::bad_alloc  if the arena does not have enough remaining space
+   */
+  std::uint8_t* allocate(const std::size_t length, const std::size_t alignment)
+  {
+    const auto base_value = reinterpret_cast<std::uintptr_t>(buffer_);
+    const std::size_t offset = align_up(base_value + top_, alignment) - base_value;
+    if (offset + length > length_)
+    {
+      throw std::bad_alloc{};
+    }
+    top_ = offset + length;
+    return buffer_ + offset;
+  }
+
+  /**
+   * @brief Changes the length of an allocation at \c ptr from \c old_length to \c new_length bytes without moving it
+   *
+   * @retval true  if \c ptr is the most recent allocation, and there is enough remaining space to resize it
+   * @retval false  otherwise, in which case the arena is unchanged
+   */
+  bool resize_in_place(std::uint8_t* const ptr, const std::size_t old_length, const std::size_t new_length)
+  {
+    const std::size_t offset = reinterpret_cast<std::uintptr_t>(ptr) - reinterpret_cast<std::uintptr_t>(buffer_);
+    if (ptr == nullptr or offset + old_length != top_ or offset + new_length > length_)
+    {
+      return false;
+    }
+
+    top_ = offset + new_length;
+    return true;
+  }
+
+  /**
+   * @brief Releases all allocations at once
+   *
+   * @warn all memory previously allocated from the arena is invalidated
+   */
+  void reset() { top_ = 0UL; }
+
+  /**
+   * @brief Returns the number of bytes currently allocated, including alignment padding
+   */
+  std::size_t used() const { return top_; }
+
+  /**
+   * @brief Returns the total number of bytes which may be allocated from the arena
+   */
+  std::size_t capacity() const { return length_; }
+
+private:
+  /// Buffer which is owned by this arena, if any
+  std::unique_ptr<std::uint8_t[]> owned_buffer_;
+
+  /// Start of buffer which allocations are handed out from
+  std::uint8_t* buffer_;
+
+  /// Length of buffer, in bytes
+  std::size_t length_;
+
+  /// Offset past the end of the most recent allocation
+  std::size_t top_;
+};
+
+/**
+ * @brief Tag type used to specify a single-allocation strategy which allocates from a caller-owned \c MonotonicArena
+ *
+ * @tparam SegmentAlignment  minimum alignment of the start of each field segment
+ */
+template <std::size_t SegmentAlignment = 1UL> struct ArenaAllocationStrategy
+{};
+
+/**
+ * @copydoc BasicMultiAllocatorAdapter
+ *
+ *          Allocates memory for all fields at once from a \c MonotonicArena, with the same layout as
+ *          \c SinglePassAllocationStrategy. De-allocation does nothing; memory is released when the arena is reset.
+ *          Re-allocation of the most recent block in the arena extends it in place.
+ */
+template <typename... ValueTs, std::size_t SegmentAlignment>
+class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, ArenaAllocationStrategy<SegmentAlignment>>
+{
+public:
+  using allocator_types = std::tuple<>;
+
+  /// Describes the placement of each field segment within an allocated block
+  using layout_type = SinglePassLayout<std::tuple<ValueTs...>, SegmentAlignment>;
+
+  /// Memory for all fields may be resized with \c reallocate
+  static constexpr bool supports_reallocate = true;
+
+  /// Memory cannot be resized without moving elements
+  static constexpr bool supports_resize_in_place = false;
+
+  /// Arena memory may be reused, so it is not known to be zero-filled
+  static constexpr bool supports_allocate_zeroed = false;
+
+  /// Memory is held by the arena, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// Copies of a container keep allocating from their own arena
+  using propagate_on_container_copy_assignment = std::false_type;
+
+  /// Memory which is moved between containers stays in the arena it was allocated from, so the arena moves with it
+  using propagate_on_container_move_assignment = std::true_type;
+
+  /// Arenas are exchanged along with the memory allocated from them
+  using propagate_on_container_swap = std::true_type;
+
+  /// Adapters are only equal if they allocate from the same arena
+  using is_always_equal = std::false_type;
+
+  BasicMultiAllocatorAdapter() : arena_{nullptr} {}
+  BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
+
+  /**
+   * @brief Arena initialization constructor
+   *
+   * @warn \c arena must outlive all memory allocated through this adapter
+   */
+  explicit BasicMultiAllocatorAdapter(MonotonicArena& arena) : arena_{std::addressof(arena)} {}
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const { return *this; }
+
+  /**
+   * @brief Returns true if both adapters allocate from the same arena
+   */
+  bool operator==(const BasicMultiAllocatorAdapter& other) const { return arena_ == other.arena_; }
+
+  /**
+   * @brief Returns true if adapters allocate from different arenas
+   */
+  bool operator!=(const BasicMultiAllocatorAdapter& other) const { return arena_ != other.arena_; }
+
+  /**
+   * @brief Allocates memory for \c n elements of each type in \c ValueTs from the arena
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   *
+   * @throws \c std::bad_alloc  if the arena does not have enough remaining space
+   */
+  std::tuple<ValueTs*...> allocate(const std::size_t n)
+  {
+    MF_ASSERT(arena_ != nullptr);
+    return layout_type::segments(arena_->allocate(layout_type::length(n), layout_type::block_alignment), n);
+  }
+
+  /**
+   * @brief Does nothing; memory is released when the arena is reset
+   */
+  void deallocate([[maybe_unused]] const std::tuple<ValueTs*...>& ptrs, [[maybe_unused]] const std::size_t n) {}
+
+  /**
+   * @brief Resizes memory for all types in \c ValueTs from \c old_n to \c new_n elements
+   *
+   *        If the block is the most recent allocation in the arena, it is resized in place and leading elements
+   *        of each field segment are shifted to their positions in the resized layout. Otherwise, a new block is
+   *        allocated and leading elements are copied into it. Elements are preserved as bytes, and must be
+   *        trivially relocatable.
+   *
+   * @param ptrs  points to memory segments to be re-allocated
+   * @param size  number of leading elements to preserve
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @return tuple of pointers to re-allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> reallocate(
+    const std::tuple<ValueTs*...>& ptrs,
+    const std::size_t size,
+    const std::size_t old_n,
+    const std::size_t new_n)
+  {
+    auto* const byte_addr = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
+
+    // Pack segments within the existing block, then release its tail if it is the most recent allocation
+    if (new_n <= old_n)
+    {
+      layout_type::move_segments(byte_addr, size, old_n, new_n);
+      arena_->resize_in_place(byte_addr, layout_type::length(old_n), layout_type::length(new_n));
+      return layout_type::segments(byte_addr, new_n);
+    }
+
+    // Spread segments out once the block has been extended in place
+    if (arena_->resize_in_place(byte_addr, layout_type::length(old_n), layout_type::length(new_n)))
+    {
+      layout_type::move_segments(byte_addr, size, old_n, new_n);
+      return layout_type::segments(byte_addr, new_n);
+    }
+
+    // Copy leading elements into a new block
+    const auto new_ptrs = BasicMultiAllocatorAdapter::allocate(new_n);
+    if (size != 0UL)
+    {
+      tuple_for_each(
+        [size](auto* const dst_ptr, const auto* const src_ptr) {
+          std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(*src_ptr) * size);
+        },
+        new_ptrs,
+        ptrs);
+    }
+    return new_ptrs;
+  }
+
+private:
+  /// Arena which all memory is allocated from
+  MonotonicArena* arena_;
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which allocates from a
+ * \c MonotonicArena
+ */
+template <typename... ValueTs>
+using arena_allocator_adapter = BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, ArenaAllocationStrategy<>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which allocates from a \c MonotonicArena
+ */
+template <typename... FieldTs>
+using arena_multi_field_array =
+  BasicMultiFieldArray<std::tuple<FieldTs...>, arena_allocator_adapter<FieldTs...>, DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
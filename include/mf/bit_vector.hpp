@@ -0,0 +1,644 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MF
+#include <mf/support/assert.hpp>
+
+namespace mf
+{
+namespace detail
+{
+
+/**
+ * @brief Returns the number of set bits in \c word
+ */
+inline std::size_t count_set_bits(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+  for (; word != 0; word &= word - 1UL)
+  {
+    ++count;
+  }
+  return count;
+#endif  // defined(__GNUC__) || defined(__clang__)
+}
+
+/**
+ * @brief Returns the position of the lowest set bit in \c word, which must not be zero
+ */
+inline std::size_t lowest_set_bit(std::uint64_t word)
+{
+  MF_ASSERT(word != 0);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t position = 0;
+  for (; (word & 1UL) == 0; word >>= 1UL)
+  {
+    ++position;
+  }
+  return position;
+#endif  // defined(__GNUC__) || defined(__clang__)
+}
+
+}  // namespace detail
+
+/**
+ * @brief Proxy reference to a single bit of a \c BasicBitVector
+ */
+class BitReference
+{
+public:
+  using word_type = std::uint64_t;
+
+  BitReference(word_type* const word, const word_type mask) : word_{word}, mask_{mask} {}
+
+  BitReference(const BitReference&) = default;
+
+  inline operator bool() const { return ((*word_) & mask_) != 0; }
+
+  inline BitReference& operator=(const bool value)
+  {
+    if (value)
+    {
+      (*word_) |= mask_;
+    }
+    else
+    {
+      (*word_) &= ~mask_;
+    }
+    return *this;
+  }
+
+  inline BitReference& operator=(const BitReference& other) { return this->operator=(static_cast<bool>(other)); }
+
+  /**
+   * @brief Inverts the referenced bit
+   */
+  inline void flip() { (*word_) ^= mask_; }
+
+private:
+  /// Word which holds the referenced bit
+  word_type* word_;
+
+  /// Mask which selects the referenced bit within \c word_
+  word_type mask_;
+};
+
+/**
+ * @brief Random-access iterator over the bits of a \c BasicBitVector
+ *
+ * @tparam WordT  (possibly const) word type; dereferences to a \c BitReference when mutable, or a \c bool otherwise
+ */
+template <typename WordT> class BitIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = bool;
+  using reference = std::conditional_t<std::is_const_v<WordT>, bool, BitReference>;
+  using pointer = void;
+
+  BitIterator(WordT* const words, const std::size_t pos) : words_{words}, pos_{pos} {}
+
+  inline bool operator==(const BitIterator& other) const { return pos_ == other.pos_; }
+  inline bool operator!=(const BitIterator& other) const { return pos_ != other.pos_; }
+  inline bool operator<(const BitIterator& other) const { return pos_ < other.pos_; }
+
+  inline std::ptrdiff_t operator-(const BitIterator& other) const
+  {
+    return static_cast<std::ptrdiff_t>(pos_) - static_cast<std::ptrdiff_t>(other.pos_);
+  }
+
+  inline BitIterator operator+(const std::ptrdiff_t offset) const
+  {
+    return BitIterator{words_, static_cast<std::size_t>(static_cast<std::ptrdiff_t>(pos_) + offset)};
+  }
+
+  inline BitIterator operator-(const std::ptrdiff_t offset) const { return this->operator+(-offset); }
+
+  inline BitIterator& operator+=(const std::ptrdiff_t offset)
+  {
+    pos_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(pos_) + offset);
+    return *this;
+  }
+
+  inline BitIterator& operator-=(const std::ptrdiff_t offset) { return this->operator+=(-offset); }
+
+  inline BitIterator& operator++()
+  {
+    ++pos_;
+    return *this;
+  }
+
+  inline BitIterator operator++(int)
+  {
+    BitIterator prev{*this};
+    ++pos_;
+    return prev;
+  }
+
+  inline BitIterator& operator--()
+  {
+    --pos_;
+    return *this;
+  }
+
+  inline BitIterator operator--(int)
+  {
+    BitIterator prev{*this};
+    --pos_;
+    return prev;
+  }
+
+  inline reference operator*() const
+  {
+    const std::uint64_t mask = std::uint64_t{1} << (pos_ % 64UL);
+    if constexpr (std::is_const_v<WordT>)
+    {
+      return (words_[pos_ / 64UL] & mask) != 0;
+    }
+    else
+    {
+      return BitReference{words_ + pos_ / 64UL, mask};
+    }
+  }
+
+  inline reference operator[](const std::ptrdiff_t offset) const { return *(*this + offset); }
+
+private:
+  /// First word of the bit vector
+  WordT* words_;
+
+  /// Position of the current bit
+  std::size_t pos_;
+};
+
+/**
+ * @brief Resizable array of bits, packed 64 to a word
+ *
+ *        Bulk operations (\c set, \c reset, \c count, \c find_first, \c for_each_set) work a word at a time, and
+ *        skip words without set bits. Bits past \c size in the last word are always kept clear.
+ *
+ * @tparam AllocatorT  allocator type; rebound to allocate words
+ */
+template <typename AllocatorT> class BasicBitVector
+{
+public:
+  /// Word type in which bits are packed
+  using word_type = std::uint64_t;
+
+  /// Number of bits held by each word
+  static constexpr std::size_t bits_per_word = 64UL;
+
+  /// Allocator type used to allocate words
+  using allocator_type = typename std::allocator_traits<AllocatorT>::template rebind_alloc<word_type>;
+
+  /// Iterator over all bits
+  using iterator = BitIterator<word_type>;
+
+  /// Iterator over all bits, which can not modify bits
+  using const_iterator = BitIterator<const word_type>;
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size and capacity to zero
+   */
+  BasicBitVector() = default;
+
+  /**
+   * @brief Allocator initialization constructor
+   */
+  explicit BasicBitVector(const allocator_type& allocator) : words_{allocator}, size_{0} {}
+
+  /**
+   * @brief Creates \c count bits, each set to \c value
+   */
+  explicit BasicBitVector(const std::size_t count, const bool value = false) : words_{}, size_{0}
+  {
+    BasicBitVector::resize(count, value);
+  }
+
+  BasicBitVector(const BasicBitVector& other) = default;
+
+  /**
+   * @brief Moves bits of \c other into a new bit vector, leaving \c other empty
+   */
+  BasicBitVector(BasicBitVector&& other) : words_{std::move(other.words_)}, size_{std::exchange(other.size_, 0UL)}
+  {
+    other.words_.clear();
+  }
+
+  BasicBitVector& operator=(const BasicBitVector& other) = default;
+
+  /**
+   * @brief Moves bits of \c other into this bit vector, leaving \c other empty
+   */
+  BasicBitVector& operator=(BasicBitVector&& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+    words_ = std::move(other.words_);
+    size_ = std::exchange(other.size_, 0UL);
+    other.words_.clear();
+    return *this;
+  }
+
+  /**
+   * @brief Returns the value of the bit at \c pos. No bounds checking is performed.
+   */
+  inline bool test(const std::size_t pos) const
+  {
+    return (words_[pos / bits_per_word] & BasicBitVector::mask(pos)) != 0;
+  }
+
+  /**
+   * @brief Sets the bit at \c pos. No bounds checking is performed.
+   */
+  inline void set(const std::size_t pos) { words_[pos / bits_per_word] |= BasicBitVector::mask(pos); }
+
+  /**
+   * @brief Clears the bit at \c pos. No bounds checking is performed.
+   */
+  inline void reset(const std::size_t pos) { words_[pos / bits_per_word] &= ~BasicBitVector::mask(pos); }
+
+  /**
+   * @brief Sets all bits
+   */
+  inline void set()
+  {
+    std::fill(words_.begin(), words_.end(), ~word_type{0});
+    BasicBitVector::clear_unused_bits();
+  }
+
+  /**
+   * @brief Clears all bits
+   */
+  inline void reset() { std::fill(words_.begin(), words_.end(), word_type{0}); }
+
+  /**
+   * @brief Returns the number of set bits
+   */
+  std::size_t count() const
+  {
+    std::size_t total = 0;
+    for (const word_type word : words_)
+    {
+      total += detail::count_set_bits(word);
+    }
+    return total;
+  }
+
+  /**
+   * @brief Returns true if any bit is set
+   */
+  bool any() const
+  {
+    return std::any_of(words_.begin(), words_.end(), [](const word_type word) { return word != 0; });
+  }
+
+  /**
+   * @brief Returns true if no bits are set
+   */
+  inline bool none() const { return !BasicBitVector::any(); }
+
+  /**
+   * @brief Returns true if all bits are set
+   */
+  inline bool all() const { return BasicBitVector::count() == size_; }
+
+  /**
+   * @brief Returns the position of the first set bit, or \c size() if no bits are set
+   */
+  inline std::size_t find_first() const { return BasicBitVector::find_from(0UL); }
+
+  /**
+   * @brief Returns the position of the first set bit after \c pos, or \c size() if there is no such bit
+   */
+  inline std::size_t find_next(const std::size_t pos) const { return BasicBitVector::find_from(pos + 1UL); }
+
+  /**
+   * @brief Calls \c callback with the position of each set bit, in order
+   */
+  template <typename CallbackT> void for_each_set(CallbackT&& callback) const
+  {
+    for (std::size_t word_index = 0; word_index < words_.size(); ++word_index)
+    {
+      for (word_type word = words_[word_index]; word != 0; word &= word - 1UL)
+      {
+        callback(word_index * bits_per_word + detail::lowest_set_bit(word));
+      }
+    }
+  }
+
+  /**
+   * @brief Keeps only bits which are also set in \c other, which must have the same size
+   */
+  BasicBitVector& operator&=(const BasicBitVector& other)
+  {
+    MF_ASSERT(size_ == other.size_);
+    std::transform(words_.begin(), words_.end(), other.words_.begin(), words_.begin(), std::bit_and<word_type>{});
+    return *this;
+  }
+
+  /**
+   * @brief Sets all bits which are set in \c other, which must have the same size
+   */
+  BasicBitVector& operator|=(const BasicBitVector& other)
+  {
+    MF_ASSERT(size_ == other.size_);
+    std::transform(words_.begin(), words_.end(), other.words_.begin(), words_.begin(), std::bit_or<word_type>{});
+    return *this;
+  }
+
+  /**
+   * @brief Returns true if both bit vectors have the same size and the same bits set
+   */
+  inline bool operator==(const BasicBitVector& other) const { return size_ == other.size_ and words_ == other.words_; }
+
+  /**
+   * @brief Returns true if bit vectors differ in size or in the bits which are set
+   */
+  inline bool operator!=(const BasicBitVector& other) const { return !this->operator==(other); }
+
+  /**
+   * @brief Adds a bit with \c value to the end of the vector
+   */
+  inline void push_back(const bool value)
+  {
+    if (size_ % bits_per_word == 0)
+    {
+      words_.push_back(word_type{0});
+    }
+    if (value)
+    {
+      BasicBitVector::set(size_);
+    }
+    ++size_;
+  }
+
+  /**
+   * @brief Removes the last bit
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    --size_;
+    BasicBitVector::reset(size_);
+    if (size_ % bits_per_word == 0)
+    {
+      words_.pop_back();
+    }
+  }
+
+  /**
+   * @brief Resizes to \c new_size bits; new bits are set to \c value
+   */
+  void resize(const std::size_t new_size, const bool value = false)
+  {
+    const std::size_t prev_size = size_;
+    words_.resize(BasicBitVector::word_count(new_size), word_type{0});
+    size_ = new_size;
+
+    if (new_size < prev_size)
+    {
+      BasicBitVector::clear_unused_bits();
+    }
+    else if (value and new_size > prev_size)
+    {
+      // Fill the partial word after the previous last bit, then whole words
+      const std::size_t first_full_word = BasicBitVector::word_count(prev_size);
+      if (prev_size % bits_per_word != 0)
+      {
+        words_[first_full_word - 1UL] |= ~word_type{0} << (prev_size % bits_per_word);
+      }
+      std::fill(words_.begin() + first_full_word, words_.end(), ~word_type{0});
+      BasicBitVector::clear_unused_bits();
+    }
+  }
+
+  /**
+   * @brief Ensures that capacity is at least \c new_capacity bits
+   */
+  inline void reserve(const std::size_t new_capacity) { words_.reserve(BasicBitVector::word_count(new_capacity)); }
+
+  /**
+   * @brief Removes all bits
+   */
+  inline void clear()
+  {
+    words_.clear();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Reduces capacity to the number of words needed for the current size
+   */
+  inline void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  /**
+   * @brief Exchanges the contents of the bit vector with those of other
+   */
+  inline void swap(BasicBitVector& other)
+  {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  /**
+   * @brief Returns true when bit count is zero
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of bits
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of bits which can be held without re-allocating
+   */
+  inline std::size_t capacity() const { return words_.capacity() * bits_per_word; }
+
+  /**
+   * @brief Returns the number of words which hold the bits
+   */
+  inline std::size_t word_count() const { return words_.size(); }
+
+  /**
+   * @brief Returns a pointer to the first word, for word-at-a-time processing
+   */
+  inline word_type* data() { return words_.data(); }
+
+  /**
+   * @copydoc data
+   */
+  inline const word_type* data() const { return words_.data(); }
+
+  /**
+   * @brief Returns iterator to first bit
+   */
+  inline iterator begin() { return iterator{words_.data(), 0UL}; }
+
+  /**
+   * @brief Returns iterator to one past last bit
+   */
+  inline iterator end() { return iterator{words_.data(), size_}; }
+
+  /**
+   * @copydoc begin
+   */
+  inline const_iterator begin() const { return const_iterator{words_.data(), 0UL}; }
+
+  /**
+   * @copydoc end
+   */
+  inline const_iterator end() const { return const_iterator{words_.data(), size_}; }
+
+  /**
+   * @brief Returns a reference to the bit at \c pos. No bounds checking is performed.
+   */
+  inline BitReference operator[](const std::size_t pos)
+  {
+    return BitReference{words_.data() + pos / bits_per_word, BasicBitVector::mask(pos)};
+  }
+
+  /**
+   * @brief Returns the value of the bit at \c pos. No bounds checking is performed.
+   */
+  inline bool operator[](const std::size_t pos) const { return BasicBitVector::test(pos); }
+
+  /**
+   * @brief Returns a reference to the bit at \c pos. Bounds checking is performed.
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the bit vector
+   */
+  inline BitReference at(const std::size_t pos)
+  {
+    BasicBitVector::check_bounds(pos);
+    return (*this)[pos];
+  }
+
+  /**
+   * @copydoc at
+   */
+  inline bool at(const std::size_t pos) const
+  {
+    BasicBitVector::check_bounds(pos);
+    return (*this)[pos];
+  }
+
+private:
+  /**
+   * @brief Returns the number of words needed to hold \c bit_count bits
+   */
+  static constexpr std::size_t word_count(const std::size_t bit_count)
+  {
+    return (bit_count + bits_per_word - 1UL) / bits_per_word;
+  }
+
+  /**
+   * @brief Returns a mask which selects the bit at \c pos within its word
+   */
+  static constexpr word_type mask(const std::size_t pos) { return word_type{1} << (pos % bits_per_word); }
+
+  /**
+   * @brief Clears bits of the last word which are past the end of the vector
+   */
+  inline void clear_unused_bits()
+  {
+    if (size_ % bits_per_word != 0)
+    {
+      words_.back() &= ~(~word_type{0} << (size_ % bits_per_word));
+    }
+  }
+
+  /**
+   * @brief Returns the position of the first set bit at or after \c pos, or \c size() if there is no such bit
+   */
+  std::size_t find_from(const std::size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      return size_;
+    }
+
+    // Ignore bits before 'pos' in its word, then skip words without set bits
+    std::size_t word_index = pos / bits_per_word;
+    word_type word = words_[word_index] & (~word_type{0} << (pos % bits_per_word));
+    while (word == 0)
+    {
+      if (++word_index == words_.size())
+      {
+        return size_;
+      }
+      word = words_[word_index];
+    }
+    return word_index * bits_per_word + detail::lowest_set_bit(word);
+  }
+
+  inline void check_bounds(const std::size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      throw std::out_of_range{"'pos' exceeds valid range of bit vector"};
+    }
+  }
+
+  /// Words which hold bits
+  std::vector<word_type, allocator_type> words_;
+
+  /// Number of bits
+  std::size_t size_ = 0;
+};
+
+/**
+ * @brief Calls \c callback with the position of each bit which is set in \c bits and in all of \c other_bits
+ *
+ *        Bits are combined a word at a time, and words in which no bits are set in all vectors are skipped. All bit
+ *        vectors must have the same size.
+ */
+template <typename CallbackT, typename AllocatorT, typename... OtherAllocatorTs>
+void for_each_set(
+  CallbackT&& callback,
+  const BasicBitVector<AllocatorT>& bits,
+  const BasicBitVector<OtherAllocatorTs>&... other_bits)
+{
+  MF_ASSERT(((bits.size() == other_bits.size()) and ...));
+
+  constexpr std::size_t bits_per_word = BasicBitVector<AllocatorT>::bits_per_word;
+  for (std::size_t word_index = 0; word_index < bits.word_count(); ++word_index)
+  {
+    for (auto word = (bits.data()[word_index] & ... & other_bits.data()[word_index]); word != 0; word &= word - 1UL)
+    {
+      callback(word_index * bits_per_word + detail::lowest_set_bit(word));
+    }
+  }
+}
+
+/**
+ * @brief Bit vector which uses \c std::allocator
+ */
+using bit_vector = BasicBitVector<std::allocator<std::uint64_t>>;
+
+}  // namespace mf
@@ -0,0 +1,147 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/support/single_pass_layout.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Specifies a default capacity-growing policy through the method \c next_capacity
+ */
+struct DefaultCapacityIncreasePolicy
+{
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity) { return 2 * prev_capacity + 2; };
+};
+
+/**
+ * @brief Checks if \c CapacityIncreasePolicy provides <code>next_capacity(prev_capacity, element_bytes)</code>
+ */
+template <typename CapacityIncreasePolicy, typename = void>
+struct has_element_bytes_next_capacity : std::false_type
+{};
+
+/**
+ * @copydoc has_element_bytes_next_capacity
+ */
+template <typename CapacityIncreasePolicy>
+struct has_element_bytes_next_capacity<
+  CapacityIncreasePolicy,
+  std::void_t<decltype(
+    CapacityIncreasePolicy::next_capacity(std::declval<std::size_t>(), std::declval<std::size_t>()))>>
+    : std::true_type
+{};
+
+/**
+ * @brief Returns the next capacity from \c CapacityIncreasePolicy for an array which must hold \c prev_capacity
+ *        elements, each of which occupies \c element_bytes bytes across all fields
+ *
+ *        Policies may provide either <code>next_capacity(prev_capacity)</code> or
+ *        <code>next_capacity(prev_capacity, element_bytes)</code>
+ */
+template <typename CapacityIncreasePolicy>
+constexpr std::size_t next_capacity(const std::size_t prev_capacity, const std::size_t element_bytes)
+{
+  if constexpr (has_element_bytes_next_capacity<CapacityIncreasePolicy>::value)
+  {
+    return CapacityIncreasePolicy::next_capacity(prev_capacity, element_bytes);
+  }
+  else
+  {
+    return CapacityIncreasePolicy::next_capacity(prev_capacity);
+  }
+}
+
+/**
+ * @brief Specifies a capacity-growing policy which multiplies capacity by <code>Numerator / Denominator</code>
+ *
+ *        Capacity is never less than \c MinCapacity, which avoids many small re-allocations for tiny arrays
+ */
+template <std::size_t Numerator = 3UL, std::size_t Denominator = 2UL, std::size_t MinCapacity = 8UL>
+struct GeometricCapacityIncreasePolicy
+{
+  static_assert(Denominator > 0, "Denominator must be greater than zero");
+  static_assert(Numerator > Denominator, "Growth factor must be greater than one");
+
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity)
+  {
+    return std::max(MinCapacity, (prev_capacity * Numerator + Denominator - 1UL) / Denominator);
+  };
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which rounds capacity up to the next multiple of \c Step
+ *
+ *        Bounds unused capacity to fewer than \c Step elements, at the cost of a re-allocation every \c Step elements
+ */
+template <std::size_t Step> struct FixedStepCapacityIncreasePolicy
+{
+  static_assert(Step > 0, "Step must be greater than zero");
+
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity)
+  {
+    return std::max(Step, ((prev_capacity + Step - 1UL) / Step) * Step);
+  };
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which grows geometrically until the byte footprint of the array reaches
+ *        \c ThresholdBytes, then grows in fixed steps of \c StepBytes
+ *
+ *        Small arrays re-allocate rarely, while unused capacity of large arrays is bounded to \c StepBytes
+ */
+template <
+  std::size_t ThresholdBytes,
+  std::size_t StepBytes = ThresholdBytes,
+  std::size_t Numerator = 2UL,
+  std::size_t Denominator = 1UL>
+struct HybridCapacityIncreasePolicy
+{
+  static_assert(StepBytes > 0, "StepBytes must be greater than zero");
+
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity, std::size_t element_bytes)
+  {
+    if (prev_capacity * element_bytes < ThresholdBytes)
+    {
+      return GeometricCapacityIncreasePolicy<Numerator, Denominator, 1UL>::next_capacity(prev_capacity);
+    }
+    const std::size_t step = std::max(1UL, StepBytes / element_bytes);
+    return ((prev_capacity + step - 1UL) / step) * step;
+  };
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which takes capacity from \c BasePolicy, then extends it to fill the
+ *        remainder of the last \c PageSize byte page of its footprint
+ *
+ *        Memory which would otherwise be wasted at the end of a page-granular allocation is used for capacity. Padding
+ *        between field segments is not accounted for.
+ */
+template <typename BasePolicy = DefaultCapacityIncreasePolicy, std::size_t PageSize = page_size>
+struct PageRoundedCapacityIncreasePolicy
+{
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity, std::size_t element_bytes)
+  {
+    const std::size_t base_capacity = ::mf::next_capacity<BasePolicy>(prev_capacity, element_bytes);
+    return align_up(base_capacity * element_bytes, PageSize) / element_bytes;
+  };
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which takes capacity from \c BasePolicy, then extends it to fill the
+ *        remainder of the last huge page of its footprint
+ */
+template <typename BasePolicy = DefaultCapacityIncreasePolicy>
+using HugePageRoundedCapacityIncreasePolicy = PageRoundedCapacityIncreasePolicy<BasePolicy, huge_page_size>;
+
+}  // namespace mf
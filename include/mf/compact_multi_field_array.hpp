@@ -0,0 +1,976 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/trivially_relocatable.hpp>
+#include <mf/support/tuple_for_each.hpp>
+#include <mf/support/tuple_select.hpp>
+#include <mf/support/view.hpp>
+
+namespace mf
+{
+namespace detail
+{
+
+/**
+ * @brief Holds the allocator adapter of a compact container
+ *
+ *        Adapters which are always equal and default constructible carry no state which needs to be kept, so
+ *        nothing is stored for them; a fresh adapter is created whenever one is needed
+ */
+template <
+  typename AllocatorAdapterT,
+  bool IsStateless =
+    AllocatorAdapterT::is_always_equal::value and std::is_default_constructible_v<AllocatorAdapterT>>
+class CompactAllocatorAdapterStorage
+{
+public:
+  CompactAllocatorAdapterStorage() = default;
+
+  explicit CompactAllocatorAdapterStorage(const AllocatorAdapterT& allocator_adapter) :
+      allocator_adapter_{allocator_adapter}
+  {}
+
+  inline AllocatorAdapterT& allocator_adapter() { return allocator_adapter_; }
+
+  inline const AllocatorAdapterT& allocator_adapter() const { return allocator_adapter_; }
+
+private:
+  AllocatorAdapterT allocator_adapter_;
+};
+
+/**
+ * @copydoc CompactAllocatorAdapterStorage
+ */
+template <typename AllocatorAdapterT> class CompactAllocatorAdapterStorage<AllocatorAdapterT, true>
+{
+public:
+  CompactAllocatorAdapterStorage() = default;
+
+  explicit CompactAllocatorAdapterStorage([[maybe_unused]] const AllocatorAdapterT& allocator_adapter) {}
+
+  inline AllocatorAdapterT allocator_adapter() const { return AllocatorAdapterT{}; }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Multi-field array which stores a single pointer to a block holding all field segments
+ *
+ *        Field segments are placed in one block by \c AllocatorAdapterT, as described by its \c layout_type. Capacity
+ *        is always a multiple of the alignment of the block, so no padding is needed between segments, and the
+ *        segment for field \c I starts <code>capacity() * field_strides[I]</code> bytes into the block, where
+ *        \c field_strides are compile-time constants. Field pointers are computed when they are needed, rather than
+ *        stored, so the container holds only the block pointer, the size and the capacity (and the allocator adapter,
+ *        if it is stateful).
+ *
+ *        With a 32-bit \c SizeT and a stateless adapter, the container is 16 bytes, regardless of field count. This
+ *        suits programs which keep very many small arrays, such as per-entity sub-tables.
+ *
+ * @tparam SizeT  unsigned integer type used to store the size and capacity of the container
+ */
+template <typename... Ts, typename AllocatorTs, typename CapacityIncreasePolicy, typename SizeT>
+class BasicCompactMultiFieldArray<
+  std::tuple<Ts...>,
+  BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>,
+  CapacityIncreasePolicy,
+  SizeT> : private detail::CompactAllocatorAdapterStorage<BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>>
+{
+  static_assert(std::is_unsigned_v<SizeT>, "SizeT must be an unsigned integer type");
+
+  static_assert(
+    !BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>::has_inline_storage,
+    "Blocks must not be held within the allocator adapter, since they are taken by moved-to containers");
+
+  /// Holds the allocator adapter, if it has state
+  using allocator_adapter_storage_type =
+    detail::CompactAllocatorAdapterStorage<BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>>;
+
+public:
+  /// Alias for multi-field allocator adapter
+  using allocator_adapter_type = BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>;
+
+  /// Tuple of field value types
+  using value_type = std::tuple<Ts...>;
+
+  /// Type used to store size and capacity
+  using size_type = SizeT;
+
+  /// Describes the placement of each field segment within an allocated block
+  using layout_type = typename allocator_adapter_type::layout_type;
+
+  /// Capacity is always a multiple of this value, such that no padding is needed between field segments
+  static constexpr std::size_t capacity_alignment = layout_type::block_alignment;
+
+  /// Bytes occupied by a single element of all fields which precede each field in the block
+  static constexpr std::array<std::size_t, sizeof...(Ts)> field_strides = [] {
+    constexpr std::array<std::size_t, sizeof...(Ts)> value_sizes = {sizeof(Ts)...};
+    std::array<std::size_t, sizeof...(Ts)> strides{};
+    std::size_t stride = 0UL;
+    for (std::size_t i = 0; i < sizeof...(Ts); ++i)
+    {
+      strides[i] = stride;
+      stride += value_sizes[i];
+    }
+    return strides;
+  }();
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initialize size and capacity to zero
+   */
+  BasicCompactMultiFieldArray() : allocator_adapter_storage_type{}, block_{nullptr}, size_{0}, capacity_{0} {}
+
+  explicit BasicCompactMultiFieldArray(const allocator_adapter_type& allocator_adapter) :
+      allocator_adapter_storage_type{allocator_adapter},
+      block_{nullptr},
+      size_{0},
+      capacity_{0}
+  {}
+
+  explicit BasicCompactMultiFieldArray(std::size_t count) : BasicCompactMultiFieldArray{}
+  {
+    BasicCompactMultiFieldArray::resize(count);
+  }
+
+  BasicCompactMultiFieldArray(std::size_t count, const allocator_adapter_type& allocator_adapter) :
+      BasicCompactMultiFieldArray{allocator_adapter}
+  {
+    BasicCompactMultiFieldArray::resize(count);
+  }
+
+  template <typename CTorArgTupleT>
+  BasicCompactMultiFieldArray(std::size_t count, CTorArgTupleT&& ctor_arg_tuple) : BasicCompactMultiFieldArray{}
+  {
+    BasicCompactMultiFieldArray::resize(count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+  }
+
+  BasicCompactMultiFieldArray(const BasicCompactMultiFieldArray& other) :
+      allocator_adapter_storage_type{other.allocator_adapter().select_on_container_copy_construction()},
+      block_{nullptr},
+      size_{0},
+      capacity_{0}
+  {
+    if (other.empty())
+    {
+      return;
+    }
+
+    // Allocate a new block with the same capacity as "other" array
+    BasicCompactMultiFieldArray::allocate(other.capacity_);
+
+    // Copy-construct new elements from values in "other"
+    BasicCompactMultiFieldArray::copy_construct(other);
+  }
+
+  BasicCompactMultiFieldArray(BasicCompactMultiFieldArray&& other) :
+      allocator_adapter_storage_type{std::move(static_cast<allocator_adapter_storage_type&>(other))},
+      block_{nullptr},
+      size_{0},
+      capacity_{0}
+  {
+    BasicCompactMultiFieldArray::steal(other);
+  }
+
+  ~BasicCompactMultiFieldArray() { BasicCompactMultiFieldArray::release(); }
+
+  /**
+   * @brief Copies elements of \c other into this container
+   *
+   *        The allocator adapter of \c other replaces this container's adapter if
+   *        \c allocator_adapter_type::propagate_on_container_copy_assignment is true
+   */
+  BasicCompactMultiFieldArray& operator=(const BasicCompactMultiFieldArray& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    BasicCompactMultiFieldArray::clear();
+
+    if constexpr (allocator_adapter_type::propagate_on_container_copy_assignment::value)
+    {
+      // Memory allocated by the current adapter must be released before it is replaced
+      if (this->allocator_adapter() != other.allocator_adapter())
+      {
+        BasicCompactMultiFieldArray::release();
+      }
+      static_cast<allocator_adapter_storage_type&>(*this) = static_cast<const allocator_adapter_storage_type&>(other);
+    }
+
+    BasicCompactMultiFieldArray::reserve(other.size_);
+    BasicCompactMultiFieldArray::copy_construct(other);
+    return *this;
+  }
+
+  /**
+   * @brief Moves elements of \c other into this container
+   *
+   *        The block is taken from \c other if \c allocator_adapter_type::propagate_on_container_move_assignment is
+   *        true, or if both allocator adapters are equal. Otherwise, elements are moved one-by-one into memory
+   *        allocated by this container's adapter.
+   */
+  BasicCompactMultiFieldArray& operator=(BasicCompactMultiFieldArray&& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    if constexpr (allocator_adapter_type::propagate_on_container_move_assignment::value)
+    {
+      BasicCompactMultiFieldArray::release();
+      static_cast<allocator_adapter_storage_type&>(*this) =
+        std::move(static_cast<allocator_adapter_storage_type&>(other));
+      BasicCompactMultiFieldArray::steal(other);
+    }
+    else if (allocator_adapter_type::is_always_equal::value or this->allocator_adapter() == other.allocator_adapter())
+    {
+      BasicCompactMultiFieldArray::release();
+      BasicCompactMultiFieldArray::steal(other);
+    }
+    else
+    {
+      BasicCompactMultiFieldArray::clear();
+      BasicCompactMultiFieldArray::reserve(other.size_);
+      auto other_data = other.data();
+      BasicCompactMultiFieldArray::relocate_from(other_data, other.size_);
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   *
+   *        Does not invoke any move, copy, or swap operations on individual elements. Allocator adapters are
+   *        exchanged if \c allocator_adapter_type::propagate_on_container_swap is true; otherwise, both adapters
+   *        must be equal.
+   */
+  inline void swap(BasicCompactMultiFieldArray& other)
+  {
+    if constexpr (allocator_adapter_type::propagate_on_container_swap::value)
+    {
+      std::swap(
+        static_cast<allocator_adapter_storage_type&>(other), static_cast<allocator_adapter_storage_type&>(*this));
+    }
+    else
+    {
+      MF_ASSERT(this->allocator_adapter() == other.allocator_adapter());
+    }
+    std::swap(other.block_, this->block_);
+    std::swap(other.size_, this->size_);
+    std::swap(other.capacity_, this->capacity_);
+  }
+
+  /**
+   * @brief Returns references to values at index for each specified field type
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<SingleValueT&>(BasicCompactMultiFieldArray::template data<SingleValueT>()[index]);
+    }
+    else
+    {
+      return std::tuple<ValueTs&...>{BasicCompactMultiFieldArray::template data<ValueTs>()[index]...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<const SingleValueT&>(BasicCompactMultiFieldArray::template data<SingleValueT>()[index]);
+    }
+    else
+    {
+      return std::tuple<const ValueTs&...>{BasicCompactMultiFieldArray::template data<ValueTs>()[index]...};
+    }
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        All arguments should be lvalue or rvalue references to values used to copy/move construct values for
+   *        each corresponding field type; if no arguments are given, all fields are value-initialized
+   */
+  template <typename... FieldCopyOrMoveCTorTs>
+  inline void emplace_back(FieldCopyOrMoveCTorTs&&... copy_or_move_ctor_args)
+  {
+    static_assert(
+      (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts)) or (sizeof...(FieldCopyOrMoveCTorTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+
+    BasicCompactMultiFieldArray::check_and_realloc_for_elements_added(1);
+
+    // Contruct new element past the previous last element in allocated block
+    if constexpr (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts))
+    {
+      tuple_for_each(
+        [s = size_](auto* const ptr, auto&& ctor_arg) {
+          using ElementType = pointer_element_t<decltype(ptr)>;
+
+          // Simply assign fundamental types
+          if constexpr (std::is_fundamental_v<ElementType>)
+          {
+            *(ptr + s) = std::forward<decltype(ctor_arg)>(ctor_arg);
+          }
+          else
+          {
+            new (ptr + s) ElementType{std::forward<decltype(ctor_arg)>(ctor_arg)};
+          }
+        },
+        BasicCompactMultiFieldArray::data(),
+        std::forward_as_tuple(std::forward<FieldCopyOrMoveCTorTs>(copy_or_move_ctor_args)...));
+    }
+    else
+    {
+      BasicCompactMultiFieldArray::construct(size_, size_ + 1UL);
+    }
+
+    // Increment the known size of the block in terms of effective elements
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   */
+  void push_back(const value_type& value)
+  {
+    std::apply([this](const auto&... fields) { this->emplace_back(fields...); }, value);
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    BasicCompactMultiFieldArray::destroy(size_ - 1UL, size_);
+    --size_;
+  }
+
+  /**
+   * @brief Allocates memory for at least \c new_capacity elements
+   *
+   *        If \c new_capacity is larger than \c capacity(), then the block is reallocated to fit, and elements are
+   *        moved to the new block. Element count, \c size(), is unchanged. If \c new_capacity is smaller than or
+   *        equal to \c capacity(), then capacity is unchanged.
+   *
+   * @throws \c std::length_error  if \c new_capacity exceeds \c max_size()
+   */
+  void reserve(const std::size_t new_capacity)
+  {
+    if (new_capacity <= capacity_)
+    {
+      return;
+    }
+    BasicCompactMultiFieldArray::reallocate(BasicCompactMultiFieldArray::aligned_capacity(new_capacity));
+  }
+
+  /**
+   * @brief Reduces capacity to the smallest multiple of \c capacity_alignment which holds \c size() elements,
+   *        keeping all elements
+   */
+  void shrink_to_fit()
+  {
+    if (size_ == 0)
+    {
+      BasicCompactMultiFieldArray::release();
+      return;
+    }
+
+    const std::size_t new_capacity = BasicCompactMultiFieldArray::aligned_capacity(size_);
+    if (new_capacity < capacity_)
+    {
+      BasicCompactMultiFieldArray::reallocate(new_capacity);
+    }
+  }
+
+  /**
+   * @brief Resizes each field array to the given size, \c new_size
+   *
+   *        If \c new_size is larger than \c size(), then new elements are value-initialized, or copy-constructed
+   *        from each value in \c ctor_arg_tuple, if provided. If \c new_size is smaller than \c size(), then all
+   *        tail elements past \c new_size are destroyed and capacity is unchanged.
+   *
+   * @throws \c std::length_error  if \c new_size exceeds \c max_size()
+   */
+  template <typename... CTorArgTupleT> void resize(const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+
+    if (new_size < size_)
+    {
+      BasicCompactMultiFieldArray::destroy(new_size, size_);
+    }
+    else if (new_size > size_)
+    {
+      BasicCompactMultiFieldArray::reserve(new_size);
+      BasicCompactMultiFieldArray::construct(size_, new_size, ctor_arg_tuple...);
+    }
+
+    size_ = static_cast<SizeT>(new_size);
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0
+   *
+   *        Does not change current \c capacity()
+   */
+  inline void clear()
+  {
+    BasicCompactMultiFieldArray::destroy(0UL, size_);
+    size_ = 0;
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0 and deallocates all memory
+   *
+   *        Sets \c capacity() to 0
+   */
+  inline void release()
+  {
+    BasicCompactMultiFieldArray::clear();
+
+    // Don't deallocate if capacity is zero
+    if (capacity_ == 0)
+    {
+      return;
+    }
+
+    BasicCompactMultiFieldArray::deallocate();
+  }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which the container can hold without reallocating
+   */
+  inline std::size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Returns the largest number of elements which the container can hold
+   */
+  static constexpr std::size_t max_size()
+  {
+    return static_cast<std::size_t>(std::numeric_limits<SizeT>::max()) & ~(capacity_alignment - 1UL);
+  }
+
+  /**
+   * @brief Returns a pointer to the first element of the field at \c Index
+   */
+  template <std::size_t Index> inline auto* data()
+  {
+    using ValueT = std::tuple_element_t<Index, value_type>;
+    return reinterpret_cast<ValueT*>(block_ + static_cast<std::size_t>(capacity_) * field_strides[Index]);
+  }
+
+  /**
+   * @copydoc data
+   */
+  template <std::size_t Index> inline const auto* data() const
+  {
+    using ValueT = std::tuple_element_t<Index, value_type>;
+    return reinterpret_cast<const ValueT*>(block_ + static_cast<std::size_t>(capacity_) * field_strides[Index]);
+  }
+
+  /**
+   * @brief Returns a pointer to the first element of the field with type \c ValueT
+   */
+  template <typename ValueT> inline ValueT* data() { return std::get<ValueT*>(BasicCompactMultiFieldArray::data()); }
+
+  /**
+   * @copydoc data
+   */
+  template <typename ValueT> inline const ValueT* data() const
+  {
+    return std::get<const ValueT*>(BasicCompactMultiFieldArray::data());
+  }
+
+  /**
+   * @brief Returns pointers to the first element of each field
+   */
+  inline std::tuple<Ts*...> data() { return BasicCompactMultiFieldArray::data(std::index_sequence_for<Ts...>{}); }
+
+  /**
+   * @copydoc data
+   */
+  inline std::tuple<const Ts*...> data() const
+  {
+    return BasicCompactMultiFieldArray::data(std::index_sequence_for<Ts...>{});
+  }
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline auto begin() { return view().begin(); }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline auto end() { return view().end(); }
+
+  /**
+   * @copydoc begin
+   */
+  inline auto begin() const { return view().begin(); }
+
+  /**
+   * @copydoc end
+   */
+  inline auto end() const { return view().end(); }
+
+  /**
+   * @brief Returns pointer to first element of a particular field
+   */
+  template <std::size_t Index> inline auto* begin() { return BasicCompactMultiFieldArray::template data<Index>(); }
+
+  /**
+   * @copydoc begin
+   */
+  template <typename ValueT> inline ValueT* begin() { return BasicCompactMultiFieldArray::template data<ValueT>(); }
+
+  /**
+   * @copydoc begin
+   */
+  template <std::size_t Index> inline const auto* begin() const
+  {
+    return BasicCompactMultiFieldArray::template data<Index>();
+  }
+
+  /**
+   * @copydoc begin
+   */
+  template <typename ValueT> inline const ValueT* begin() const
+  {
+    return BasicCompactMultiFieldArray::template data<ValueT>();
+  }
+
+  /**
+   * @brief Returns pointer to one past the last element of a particular field
+   */
+  template <std::size_t Index> inline auto* end()
+  {
+    return BasicCompactMultiFieldArray::template begin<Index>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <typename ValueT> inline ValueT* end()
+  {
+    return BasicCompactMultiFieldArray::template begin<ValueT>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <std::size_t Index> inline const auto* end() const
+  {
+    return BasicCompactMultiFieldArray::template begin<Index>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <typename ValueT> inline const ValueT* end() const
+  {
+    return BasicCompactMultiFieldArray::template begin<ValueT>() + size_;
+  }
+
+  /**
+   * @brief Returns a copy of the allocator adapter used by the container
+   */
+  allocator_adapter_type get_allocator_adapter() const { return this->allocator_adapter(); }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  View<std::tuple<Ts...>> view() { return View<std::tuple<Ts...>>{BasicCompactMultiFieldArray::data(), size_}; }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs> View<std::tuple<ViewValueTs...>> view()
+  {
+    return View<std::tuple<ViewValueTs...>>{
+      std::forward_as_tuple(BasicCompactMultiFieldArray::template data<ViewValueTs>()...), size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> View<tuple_select_t<value_type, Indices...>> view()
+  {
+    return View<tuple_select_t<value_type, Indices...>>{
+      std::forward_as_tuple(BasicCompactMultiFieldArray::template data<Indices>()...), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  View<std::tuple<const Ts...>> view() const
+  {
+    return View<std::tuple<const Ts...>>{BasicCompactMultiFieldArray::data(), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs> View<std::tuple<const ViewValueTs...>> view() const
+  {
+    return View<std::tuple<const ViewValueTs...>>{
+      std::forward_as_tuple(BasicCompactMultiFieldArray::template data<ViewValueTs>()...), size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> View<const_tuple_select_t<value_type, Indices...>> view() const
+  {
+    return View<const_tuple_select_t<value_type, Indices...>>{
+      std::forward_as_tuple(BasicCompactMultiFieldArray::template data<Indices>()...), size_};
+  }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) { return view()[pos]; }
+
+  /**
+   * @copydoc operator[]
+   */
+  inline auto operator[](const std::size_t pos) const { return view()[pos]; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the container
+   */
+  inline auto at(const std::size_t pos) { return view().at(pos); }
+
+  /**
+   * @copydoc at
+   */
+  inline auto at(const std::size_t pos) const { return view().at(pos); }
+
+private:
+  template <std::size_t... Indices> inline std::tuple<Ts*...> data(std::index_sequence<Indices...> _)
+  {
+    return std::tuple<Ts*...>{BasicCompactMultiFieldArray::template data<Indices>()...};
+  }
+
+  template <std::size_t... Indices> inline std::tuple<const Ts*...> data(std::index_sequence<Indices...> _) const
+  {
+    return std::tuple<const Ts*...>{BasicCompactMultiFieldArray::template data<Indices>()...};
+  }
+
+  /**
+   * @brief Returns the smallest valid capacity which holds \c count elements
+   *
+   * @throws \c std::length_error  if \c count exceeds \c max_size()
+   */
+  static std::size_t aligned_capacity(const std::size_t count)
+  {
+    if (count > max_size())
+    {
+      throw std::length_error{"'count' exceeds maximum size of compact multi-field array"};
+    }
+    return align_up(count, capacity_alignment);
+  }
+
+  /**
+   * @brief Allocates a block with capacity for \c new_capacity elements; the container must hold no block
+   */
+  inline void allocate(const std::size_t new_capacity)
+  {
+    const auto new_data = this->allocator_adapter().allocate(new_capacity);
+    block_ = reinterpret_cast<std::uint8_t*>(std::get<0>(new_data));
+    capacity_ = static_cast<SizeT>(new_capacity);
+  }
+
+  /**
+   * @brief Deallocates the block held by the container
+   */
+  inline void deallocate()
+  {
+    this->allocator_adapter().deallocate(BasicCompactMultiFieldArray::data(), capacity_);
+    block_ = nullptr;
+    capacity_ = 0;
+  }
+
+  /**
+   * @brief Value-initializes elements in <code>[first, last)</code>
+   */
+  inline void construct(const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        std::for_each(ptr + first, ptr + last, [](auto& element) { new (std::addressof(element)) ElementType{}; });
+      },
+      BasicCompactMultiFieldArray::data());
+  }
+
+  /**
+   * @brief Copy-constructs elements in <code>[first, last)</code> from each value in \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  inline void construct(const std::size_t first, const std::size_t last, const CTorArgTupleT& ctor_arg_tuple)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr, const auto& other) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        // Simply assign fundamental types
+        if constexpr (std::is_fundamental_v<ElementType>)
+        {
+          std::fill(ptr + first, ptr + last, other);
+        }
+        else
+        {
+          std::for_each(
+            ptr + first, ptr + last, [&other](auto& element) { new (std::addressof(element)) ElementType{other}; });
+        }
+      },
+      BasicCompactMultiFieldArray::data(),
+      ctor_arg_tuple);
+  }
+
+  /**
+   * @brief Copy-constructs all elements of \c other at the start of the block; the container must be empty
+   */
+  inline void copy_construct(const BasicCompactMultiFieldArray& other)
+  {
+    tuple_for_each(
+      [s = other.size()](auto* dst_ptr, const auto* src_ptr) {
+        using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+        // Copy bytes of trivially copyable types, call copy constructor for all others
+        if constexpr (std::is_trivially_copyable_v<ElementType>)
+        {
+          if (s != 0UL)
+          {
+            std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * s);
+          }
+        }
+        else
+        {
+          auto* const dst_last_ptr = dst_ptr + s;
+          for (; dst_ptr != dst_last_ptr; ++dst_ptr, ++src_ptr)
+          {
+            new (dst_ptr) ElementType{*src_ptr};
+          }
+        }
+      },
+      BasicCompactMultiFieldArray::data(),
+      other.data());
+    size_ = other.size_;
+  }
+
+  /**
+   * @brief Calls destructor on elements in <code>[first, last)</code>
+   */
+  inline void destroy(const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+          std::for_each(ptr + first, ptr + last, [](auto& element) { element.~ElementType(); });
+        }
+      },
+      BasicCompactMultiFieldArray::data());
+  }
+
+  /**
+   * @brief Moves \c n elements from \c buffers to the start of the block, ending the lifetimes of the originals
+   *
+   *        Trivially relocatable elements are moved as bytes, without calling any constructors or destructors.
+   *        All other elements are move-constructed then destroyed.
+   */
+  inline void relocate_from(std::tuple<Ts*...>& buffers, const std::size_t n)
+  {
+    tuple_for_each(
+      [n](auto* dst_ptr, auto* src_ptr) {
+        using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+        if constexpr (is_trivially_relocatable_v<ElementType>)
+        {
+          relocate_bytes(dst_ptr, src_ptr, n);
+        }
+        else
+        {
+          const auto* const last_src_ptr = src_ptr + n;
+          while (src_ptr != last_src_ptr)
+          {
+            new (dst_ptr) ElementType{std::move(*src_ptr)};
+            src_ptr->~ElementType();
+            ++src_ptr;
+            ++dst_ptr;
+          }
+        }
+      },
+      BasicCompactMultiFieldArray::data(),
+      buffers);
+  }
+
+  /**
+   * @brief Takes ownership of the block held by \c other, leaving \c other with no elements or capacity
+   *
+   *        Current block must already be released
+   */
+  inline void steal(BasicCompactMultiFieldArray& other)
+  {
+    block_ = other.block_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+
+    // Set "other" to a fully-reset state
+    other.block_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+  }
+
+  /**
+   * @brief Checks if addding \c count elements exceeds capacity; reallocates if it does
+   */
+  inline void check_and_realloc_for_elements_added(const std::size_t count)
+  {
+    const std::size_t required_capacity = static_cast<std::size_t>(size_) + count;
+    if (capacity_ >= required_capacity)
+    {
+      return;
+    }
+
+    // Bytes occupied by a single element across all fields
+    static constexpr std::size_t element_bytes = (sizeof(Ts) + ...);
+
+    // Growth is limited to the largest capacity which may be stored
+    const std::size_t next_capacity =
+      std::min(::mf::next_capacity<CapacityIncreasePolicy>(required_capacity, element_bytes), max_size());
+
+    BasicCompactMultiFieldArray::reallocate(
+      BasicCompactMultiFieldArray::aligned_capacity(std::max(required_capacity, next_capacity)));
+  }
+
+  /**
+   * @brief Moves all elements to a block with capacity for \c new_capacity elements
+   *
+   *        When all fields are trivially relocatable and the allocator adapter supports it, the block is resized with
+   *        \c allocator_adapter_type::reallocate, which may extend it in place, and moves field segments to their
+   *        offsets for \c new_capacity. Otherwise, a new block is allocated, elements are relocated into it, and the
+   *        old block is deallocated. Blocks are never resized with \c allocator_adapter_type::resize_in_place, since
+   *        the offset of every field segment after the first depends on capacity.
+   */
+  inline void reallocate(const std::size_t new_capacity)
+  {
+    MF_ASSERT(new_capacity % capacity_alignment == 0UL);
+
+    if (capacity_ == 0)
+    {
+      BasicCompactMultiFieldArray::allocate(new_capacity);
+      return;
+    }
+
+    if constexpr (allocator_adapter_type::supports_reallocate and (is_trivially_relocatable_v<Ts> and ...))
+    {
+      const auto new_data =
+        this->allocator_adapter().reallocate(BasicCompactMultiFieldArray::data(), size_, capacity_, new_capacity);
+      block_ = reinterpret_cast<std::uint8_t*>(std::get<0>(new_data));
+      capacity_ = static_cast<SizeT>(new_capacity);
+    }
+    else
+    {
+      auto old_data = BasicCompactMultiFieldArray::data();
+      const std::size_t old_capacity = capacity_;
+
+      // Allocate a new block, then move old elements into it
+      BasicCompactMultiFieldArray::allocate(new_capacity);
+      BasicCompactMultiFieldArray::relocate_from(old_data, size_);
+
+      // Deallocate old block
+      this->allocator_adapter().deallocate(old_data, old_capacity);
+    }
+  }
+
+  /// Start of the block which holds all field segments
+  std::uint8_t* block_;
+
+  /// The effective number of elements in each field segment
+  SizeT size_;
+
+  /// The current capacity of each field segment
+  SizeT capacity_;
+};
+
+/**
+ * @brief Convenience alias for a compact multi-field array which stores 32-bit size and capacity, and uses
+ *        \c std::allocator for all fields
+ */
+template <typename... FieldTs>
+using compact_multi_field_array = BasicCompactMultiFieldArray<
+  std::tuple<FieldTs...>,
+  single_allocator_adapter<FieldTs...>,
+  DefaultCapacityIncreasePolicy,
+  std::uint32_t>;
+
+}  // namespace mf
@@ -0,0 +1,467 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// SSE2
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // defined(__SSE2__)
+
+// MF
+#include <mf/bit_vector.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/view.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Predicate which is true for values \c x where <code>CompareT{}(x, value)</code>
+ *
+ *        \c find_if, \c find_all and \c find_all_mask recognize these predicates, and compare many arithmetic values
+ *        at once with vector instructions, where the target supports them. Elements of a type other than \c T are
+ *        compared one at a time, with the usual arithmetic conversions, so <code>equal_to(1)</code> over a \c float
+ *        field matches only elements which are exactly \c 1.0f.
+ */
+template <typename CompareT, typename T> struct ComparePredicate
+{
+  /// Comparison applied to each element and \c value
+  using compare_type = CompareT;
+
+  /// Value which elements are compared against
+  T value;
+
+  /**
+   * @brief Compares \c x against \c value, without converting \c x to \c T
+   */
+  template <typename U> constexpr bool operator()(const U& x) const { return CompareT{}(x, value); }
+};
+
+/**
+ * @brief Returns a predicate which is true for values equal to \c value
+ */
+template <typename T> constexpr ComparePredicate<std::equal_to<>, T> equal_to(const T& value) { return {value}; }
+
+/**
+ * @brief Returns a predicate which is true for values not equal to \c value
+ */
+template <typename T> constexpr ComparePredicate<std::not_equal_to<>, T> not_equal_to(const T& value)
+{
+  return {value};
+}
+
+/**
+ * @brief Returns a predicate which is true for values less than \c value
+ */
+template <typename T> constexpr ComparePredicate<std::less<>, T> less(const T& value) { return {value}; }
+
+/**
+ * @brief Returns a predicate which is true for values less than or equal to \c value
+ */
+template <typename T> constexpr ComparePredicate<std::less_equal<>, T> less_equal(const T& value) { return {value}; }
+
+/**
+ * @brief Returns a predicate which is true for values greater than \c value
+ */
+template <typename T> constexpr ComparePredicate<std::greater<>, T> greater(const T& value) { return {value}; }
+
+/**
+ * @brief Returns a predicate which is true for values greater than or equal to \c value
+ */
+template <typename T> constexpr ComparePredicate<std::greater_equal<>, T> greater_equal(const T& value)
+{
+  return {value};
+}
+
+namespace detail
+{
+
+/**
+ * @brief Compares a vector register of values of type \c T against a single value, producing one mask bit per value
+ *
+ *        Not enabled for types without vector comparisons on the target, which are compared one at a time.
+ */
+template <typename T, typename = void> struct SimdCompare
+{
+  static constexpr bool enabled = false;
+};
+
+#if defined(__SSE2__)
+
+/**
+ * @brief Returns a mask of the lowest \c Lanes bits
+ */
+template <std::size_t Lanes> constexpr unsigned lane_mask() { return (1U << Lanes) - 1U; }
+
+/**
+ * @brief SSE2 comparisons of four \c float values
+ */
+template <> struct SimdCompare<float>
+{
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 4UL;
+
+  using register_type = __m128;
+
+  static register_type broadcast(const float value) { return _mm_set1_ps(value); }
+
+  template <typename CompareT> static unsigned mask(const float* const data, const register_type value)
+  {
+    const register_type x = _mm_loadu_ps(data);
+    if constexpr (std::is_same_v<CompareT, std::equal_to<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::not_equal_to<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpneq_ps(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less_equal<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::greater<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpgt_ps(x, value)));
+    }
+    else
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(x, value)));
+    }
+  }
+};
+
+/**
+ * @brief SSE2 comparisons of two \c double values
+ */
+template <> struct SimdCompare<double>
+{
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 2UL;
+
+  using register_type = __m128d;
+
+  static register_type broadcast(const double value) { return _mm_set1_pd(value); }
+
+  template <typename CompareT> static unsigned mask(const double* const data, const register_type value)
+  {
+    const register_type x = _mm_loadu_pd(data);
+    if constexpr (std::is_same_v<CompareT, std::equal_to<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::not_equal_to<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpneq_pd(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmplt_pd(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less_equal<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmple_pd(x, value)));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::greater<>>)
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(x, value)));
+    }
+    else
+    {
+      return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpge_pd(x, value)));
+    }
+  }
+};
+
+/**
+ * @brief SSE2 comparisons of 8, 16 and 32-bit integers, sixteen bytes at a time
+ *
+ *        SSE2 only compares signed integers for order, so unsigned integers are compared with their sign bits
+ *        flipped.
+ */
+template <typename T>
+struct SimdCompare<
+  T,
+  std::enable_if_t<std::is_integral_v<T> and !std::is_same_v<T, bool> and (sizeof(T) <= 4UL)>>
+{
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 16UL / sizeof(T);
+
+  using register_type = __m128i;
+
+  static register_type broadcast(const T value) { return SimdCompare::bias(SimdCompare::set1(value)); }
+
+  template <typename CompareT> static unsigned mask(const T* const data, const register_type value)
+  {
+    const register_type x = SimdCompare::bias(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+    if constexpr (std::is_same_v<CompareT, std::equal_to<>>)
+    {
+      return SimdCompare::movemask(SimdCompare::cmpeq(x, value));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::not_equal_to<>>)
+    {
+      return SimdCompare::movemask(SimdCompare::cmpeq(x, value)) ^ lane_mask<lanes>();
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less<>>)
+    {
+      return SimdCompare::movemask(SimdCompare::cmpgt(value, x));
+    }
+    else if constexpr (std::is_same_v<CompareT, std::less_equal<>>)
+    {
+      return SimdCompare::movemask(SimdCompare::cmpgt(x, value)) ^ lane_mask<lanes>();
+    }
+    else if constexpr (std::is_same_v<CompareT, std::greater<>>)
+    {
+      return SimdCompare::movemask(SimdCompare::cmpgt(x, value));
+    }
+    else
+    {
+      return SimdCompare::movemask(SimdCompare::cmpgt(value, x)) ^ lane_mask<lanes>();
+    }
+  }
+
+private:
+  static register_type set1(const T value)
+  {
+    if constexpr (sizeof(T) == 1UL)
+    {
+      return _mm_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr (sizeof(T) == 2UL)
+    {
+      return _mm_set1_epi16(static_cast<short>(value));
+    }
+    else
+    {
+      return _mm_set1_epi32(static_cast<int>(value));
+    }
+  }
+
+  static register_type bias(const register_type x)
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      return x;
+    }
+    else
+    {
+      return _mm_xor_si128(x, SimdCompare::set1(static_cast<T>(T{1} << (8UL * sizeof(T) - 1UL))));
+    }
+  }
+
+  static register_type cmpeq(const register_type lhs, const register_type rhs)
+  {
+    if constexpr (sizeof(T) == 1UL)
+    {
+      return _mm_cmpeq_epi8(lhs, rhs);
+    }
+    else if constexpr (sizeof(T) == 2UL)
+    {
+      return _mm_cmpeq_epi16(lhs, rhs);
+    }
+    else
+    {
+      return _mm_cmpeq_epi32(lhs, rhs);
+    }
+  }
+
+  static register_type cmpgt(const register_type lhs, const register_type rhs)
+  {
+    if constexpr (sizeof(T) == 1UL)
+    {
+      return _mm_cmpgt_epi8(lhs, rhs);
+    }
+    else if constexpr (sizeof(T) == 2UL)
+    {
+      return _mm_cmpgt_epi16(lhs, rhs);
+    }
+    else
+    {
+      return _mm_cmpgt_epi32(lhs, rhs);
+    }
+  }
+
+  /// Returns one bit per lane of \c x, from the sign bit of each lane
+  static unsigned movemask(const register_type x)
+  {
+    if constexpr (sizeof(T) == 1UL)
+    {
+      return static_cast<unsigned>(_mm_movemask_epi8(x));
+    }
+    else if constexpr (sizeof(T) == 2UL)
+    {
+      return static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(x, _mm_setzero_si128()))) & lane_mask<lanes>();
+    }
+    else
+    {
+      return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(x)));
+    }
+  }
+};
+
+#endif  // defined(__SSE2__)
+
+/**
+ * @brief True if \c PredicateT is a \c ComparePredicate on values of type \c T which is evaluated with vector
+ *        instructions
+ */
+template <typename PredicateT, typename T> struct is_simd_predicate : std::false_type
+{};
+
+template <typename CompareT, typename T>
+struct is_simd_predicate<ComparePredicate<CompareT, T>, T> : std::bool_constant<SimdCompare<T>::enabled>
+{};
+
+/**
+ * @brief Calls <code>block_fn(first, mask)</code> for each block of elements of <code>[data, data + n)</code>,
+ *        where bit \c i of \c mask is set when <code>predicate(data[first + i])</code>, until \c block_fn returns
+ *        false
+ *
+ *        Each block is at most 64 elements, and \c first is always a multiple of the block size, which divides 64.
+ */
+template <typename T, typename PredicateT, typename BlockFnT>
+void for_each_match_mask(const T* const data, const std::size_t n, const PredicateT& predicate, BlockFnT&& block_fn)
+{
+  std::size_t first = 0;
+  if constexpr (is_simd_predicate<PredicateT, T>::value)
+  {
+    using Simd = SimdCompare<T>;
+    using CompareT = typename PredicateT::compare_type;
+
+    // Four registers of values per block
+    constexpr std::size_t block_size = 4UL * Simd::lanes;
+    const auto value = Simd::broadcast(predicate.value);
+    for (; first + block_size <= n; first += block_size)
+    {
+      const T* const block = data + first;
+      const std::uint64_t mask = std::uint64_t{Simd::template mask<CompareT>(block, value)} |
+        (std::uint64_t{Simd::template mask<CompareT>(block + Simd::lanes, value)} << Simd::lanes) |
+        (std::uint64_t{Simd::template mask<CompareT>(block + 2UL * Simd::lanes, value)} << (2UL * Simd::lanes)) |
+        (std::uint64_t{Simd::template mask<CompareT>(block + 3UL * Simd::lanes, value)} << (3UL * Simd::lanes));
+      if (!block_fn(first, mask))
+      {
+        return;
+      }
+    }
+  }
+  else
+  {
+    constexpr std::size_t block_size = 64UL;
+    for (; first + block_size <= n; first += block_size)
+    {
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < block_size; ++i)
+      {
+        mask |= std::uint64_t{static_cast<bool>(predicate(data[first + i]))} << i;
+      }
+      if (!block_fn(first, mask))
+      {
+        return;
+      }
+    }
+  }
+
+  // Remaining elements, one at a time
+  if (first < n)
+  {
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; first + i < n; ++i)
+    {
+      mask |= std::uint64_t{static_cast<bool>(predicate(data[first + i]))} << i;
+    }
+    block_fn(first, mask);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns the position of the first element of the only field of \c view for which <code>predicate(x)</code>
+ *        is true, or <code>view.size()</code> if there is none
+ *
+ *        Predicates made with \c equal_to, \c less, etc. on fields of arithmetic type are evaluated on many elements
+ *        at once, with compare and move-mask vector instructions where the target supports them (SSE2, for 8, 16
+ *        and 32-bit integers, \c float and \c double); other predicates are evaluated one element at a time.
+ */
+template <typename T, typename PredicateT> std::size_t find_if(const View<std::tuple<T>>& view, PredicateT&& predicate)
+{
+  std::size_t position = view.size();
+  detail::for_each_match_mask(
+    std::get<0>(view.data()), view.size(), predicate, [&position](const std::size_t first, const std::uint64_t mask) {
+      if (mask == 0)
+      {
+        return true;
+      }
+      position = first + detail::lowest_set_bit(mask);
+      return false;
+    });
+  return position;
+}
+
+/**
+ * @brief Returns the position of the first element of the only field of \c view which is equal to \c value, or
+ *        <code>view.size()</code> if there is none
+ *
+ *        Same as <code>find_if(view, equal_to(value))</code>.
+ */
+template <typename T> std::size_t find(const View<std::tuple<T>>& view, const std::remove_const_t<T>& value)
+{
+  return find_if(view, equal_to(value));
+}
+
+/**
+ * @brief Returns the positions of all elements of the only field of \c view for which <code>predicate(x)</code> is
+ *        true, in order
+ *
+ *        Predicates are evaluated as by \c find_if.
+ */
+template <typename T, typename PredicateT>
+std::vector<std::size_t> find_all(const View<std::tuple<T>>& view, PredicateT&& predicate)
+{
+  std::vector<std::size_t> positions;
+  detail::for_each_match_mask(
+    std::get<0>(view.data()), view.size(), predicate, [&positions](const std::size_t first, std::uint64_t mask) {
+      for (; mask != 0; mask &= mask - 1UL)
+      {
+        positions.push_back(first + detail::lowest_set_bit(mask));
+      }
+      return true;
+    });
+  return positions;
+}
+
+/**
+ * @brief Returns a bit for each element of the only field of \c view, which is set where <code>predicate(x)</code>
+ *        is true
+ *
+ *        Predicates are evaluated as by \c find_if. Masks of several fields may be combined with \c operator&= and
+ *        visited with \c for_each_set.
+ */
+template <typename T, typename PredicateT>
+bit_vector find_all_mask(const View<std::tuple<T>>& view, PredicateT&& predicate)
+{
+  bit_vector mask_bits{view.size()};
+  auto* const words = mask_bits.data();
+  detail::for_each_match_mask(
+    std::get<0>(view.data()), view.size(), predicate, [words](const std::size_t first, const std::uint64_t mask) {
+      words[first / bit_vector::bits_per_word] |= mask << (first % bit_vector::bits_per_word);
+      return true;
+    });
+  return mask_bits;
+}
+
+}  // namespace mf
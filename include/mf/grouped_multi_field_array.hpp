@@ -0,0 +1,852 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/trivially_relocatable.hpp>
+#include <mf/support/tuple_ref.hpp>
+#include <mf/support/tuple_select.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Tag used to declare fields which are stored interleaved with each other
+ *
+ *        Used as a field of \c BasicGroupedMultiFieldArray, like so:
+ * \n
+ *        @code{.cpp}
+ *        grouped_multi_field_array<group<Position, Velocity>, Name> entities;
+ *        @endcode
+ */
+template <typename... Ts> struct group
+{
+  static_assert(sizeof...(Ts) != 0, "group must hold at least one field");
+};
+
+/**
+ * @brief Holds one value of each field in a \c group, one after the other
+ */
+template <typename... Ts> struct FieldGroup;
+
+/**
+ * @copydoc FieldGroup
+ */
+template <typename T> struct FieldGroup<T>
+{
+  T head;
+
+  FieldGroup() = default;
+
+  template <
+    typename HeadArgT,
+    typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<std::remove_reference_t<HeadArgT>>, FieldGroup>>>
+  explicit FieldGroup(HeadArgT&& head_arg) : head{std::forward<HeadArgT>(head_arg)}
+  {}
+
+  /**
+   * @brief Returns the distance, in bytes, from the start of the group to the field with type \c ValueT
+   */
+  template <typename ValueT> static constexpr std::size_t offset_of()
+  {
+    static_assert(std::is_same_v<ValueT, T>, "ValueT is not a field of this group");
+    return 0UL;
+  }
+
+  template <typename ValueT> inline ValueT& get()
+  {
+    static_assert(std::is_same_v<ValueT, T>, "ValueT is not a field of this group");
+    return head;
+  }
+
+  template <typename ValueT> inline const ValueT& get() const
+  {
+    static_assert(std::is_same_v<ValueT, T>, "ValueT is not a field of this group");
+    return head;
+  }
+};
+
+/**
+ * @copydoc FieldGroup
+ */
+template <typename T, typename NextT, typename... OtherTs> struct FieldGroup<T, NextT, OtherTs...>
+{
+  T head;
+  FieldGroup<NextT, OtherTs...> tail;
+
+  FieldGroup() = default;
+
+  template <typename HeadArgT, typename NextArgT, typename... OtherArgTs>
+  FieldGroup(HeadArgT&& head_arg, NextArgT&& next_arg, OtherArgTs&&... other_args) :
+      head{std::forward<HeadArgT>(head_arg)},
+      tail{std::forward<NextArgT>(next_arg), std::forward<OtherArgTs>(other_args)...}
+  {}
+
+  /**
+   * @copydoc FieldGroup<T>::offset_of
+   *
+   *          Members are laid out in declaration order, each at the next offset which satisfies its alignment; the
+   *          group has no base classes or virtual functions, so \c head starts the group
+   */
+  template <typename ValueT> static constexpr std::size_t offset_of()
+  {
+    if constexpr (std::is_same_v<ValueT, T>)
+    {
+      return 0UL;
+    }
+    else
+    {
+      constexpr std::size_t tail_alignment = alignof(FieldGroup<NextT, OtherTs...>);
+      constexpr std::size_t tail_offset = ((sizeof(T) + tail_alignment - 1UL) / tail_alignment) * tail_alignment;
+      return tail_offset + FieldGroup<NextT, OtherTs...>::template offset_of<ValueT>();
+    }
+  }
+
+  template <typename ValueT> inline ValueT& get()
+  {
+    if constexpr (std::is_same_v<ValueT, T>)
+    {
+      return head;
+    }
+    else
+    {
+      return tail.template get<ValueT>();
+    }
+  }
+
+  template <typename ValueT> inline const ValueT& get() const
+  {
+    if constexpr (std::is_same_v<ValueT, T>)
+    {
+      return head;
+    }
+    else
+    {
+      return tail.template get<ValueT>();
+    }
+  }
+};
+
+/**
+ * @copydoc is_trivially_relocatable
+ *
+ *          A \c FieldGroup is trivially relocatable if all of its fields are
+ */
+template <typename... Ts>
+struct is_trivially_relocatable<FieldGroup<Ts...>> : std::conjunction<is_trivially_relocatable<Ts>...>
+{};
+
+namespace detail
+{
+
+/**
+ * @brief Describes how a field, or a \c group of fields, of a grouped container is stored
+ */
+template <typename FieldOrGroupT> struct FieldGroupTraits
+{
+  /// Type of the value stored for each element
+  using storage_type = FieldOrGroupT;
+
+  /// Fields held by each stored value
+  using field_types = std::tuple<FieldOrGroupT>;
+
+  /// True if \c ValueT is held by each stored value
+  template <typename ValueT> static constexpr bool contains = std::is_same_v<ValueT, FieldOrGroupT>;
+
+  /// Distance, in bytes, from the start of each stored value to \c ValueT
+  template <typename ValueT> static constexpr std::size_t offset_of = 0UL;
+
+  template <typename ValueT> static inline ValueT& field(storage_type& storage) { return storage; }
+
+  template <typename ValueT> static inline const ValueT& field(const storage_type& storage) { return storage; }
+};
+
+/**
+ * @copydoc FieldGroupTraits
+ */
+template <typename... Ts> struct FieldGroupTraits<group<Ts...>>
+{
+  /// Type of the value stored for each element
+  using storage_type = FieldGroup<Ts...>;
+
+  /// Fields held by each stored value
+  using field_types = std::tuple<Ts...>;
+
+  /// True if \c ValueT is held by each stored value
+  template <typename ValueT> static constexpr bool contains = (std::is_same_v<ValueT, Ts> or ...);
+
+  /// Distance, in bytes, from the start of each stored value to \c ValueT
+  template <typename ValueT> static constexpr std::size_t offset_of = storage_type::template offset_of<ValueT>();
+
+  template <typename ValueT> static inline ValueT& field(storage_type& storage)
+  {
+    return storage.template get<ValueT>();
+  }
+
+  template <typename ValueT> static inline const ValueT& field(const storage_type& storage)
+  {
+    return storage.template get<ValueT>();
+  }
+};
+
+/**
+ * @brief Returns a pointer \c byte_count bytes after \c ptr
+ */
+template <typename T> inline T* advance_bytes(T* const ptr, const std::ptrdiff_t byte_count)
+{
+  using ByteT = std::conditional_t<std::is_const_v<T>, const std::uint8_t, std::uint8_t>;
+  return reinterpret_cast<T*>(reinterpret_cast<ByteT*>(ptr) + byte_count);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Type of the value stored for each element of a field, or a \c group of fields
+ */
+template <typename FieldOrGroupT>
+using field_group_storage_t = typename detail::FieldGroupTraits<FieldOrGroupT>::storage_type;
+
+/**
+ * @brief Iterates over multiple fields simultaneously, where consecutive values of each field are a fixed number
+ *        of bytes apart
+ *
+ * @tparam PointersT  tuple of pointers to each field
+ * @tparam StridesT  \c std::index_sequence of distances, in bytes, between consecutive values of each field
+ */
+template <typename PointersT, typename StridesT> class StridedIterator;
+
+/**
+ * @copydoc StridedIterator
+ */
+template <typename... Ts, std::size_t... Strides>
+class StridedIterator<std::tuple<Ts*...>, std::index_sequence<Strides...>>
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::tuple<Ts*...>;
+  using reference = std::tuple<Ts&...>;
+  using value_type = reference;
+
+  explicit StridedIterator(const std::tuple<Ts*...>& ptr) : ptr_{ptr} {}
+
+  inline bool operator==(const StridedIterator& other) const { return std::get<0>(ptr_) == std::get<0>(other.ptr_); }
+  inline bool operator!=(const StridedIterator& other) const { return !this->operator==(other); }
+  inline bool operator<(const StridedIterator& other) const { return std::get<0>(ptr_) < std::get<0>(other.ptr_); }
+
+  inline std::ptrdiff_t operator-(const StridedIterator& other) const
+  {
+    static constexpr std::ptrdiff_t first_stride = std::get<0>(std::array<std::size_t, sizeof...(Ts)>{Strides...});
+    return (reinterpret_cast<const std::uint8_t*>(std::get<0>(ptr_)) -
+            reinterpret_cast<const std::uint8_t*>(std::get<0>(other.ptr_))) /
+      first_stride;
+  }
+
+  inline StridedIterator operator+(const std::ptrdiff_t offset) const
+  {
+    StridedIterator result{*this};
+    result += offset;
+    return result;
+  }
+
+  inline StridedIterator operator-(const std::ptrdiff_t offset) const
+  {
+    StridedIterator result{*this};
+    result += -offset;
+    return result;
+  }
+
+  inline StridedIterator& operator+=(const std::ptrdiff_t offset)
+  {
+    ptr_ = std::apply(
+      [offset](auto*... ptrs) {
+        return std::tuple<Ts*...>{detail::advance_bytes(ptrs, static_cast<std::ptrdiff_t>(Strides) * offset)...};
+      },
+      ptr_);
+    return *this;
+  }
+
+  inline StridedIterator& operator-=(const std::ptrdiff_t offset) { return *this += -offset; }
+
+  inline StridedIterator& operator++() { return *this += 1; }
+
+  inline StridedIterator operator++(int)
+  {
+    StridedIterator prev{*this};
+    *this += 1;
+    return prev;
+  }
+
+  inline StridedIterator& operator--() { return *this += -1; }
+
+  inline StridedIterator operator--(int)
+  {
+    StridedIterator prev{*this};
+    *this += -1;
+    return prev;
+  }
+
+  inline reference operator*() const { return tuple_dereference(ptr_); }
+
+  inline reference operator[](const std::ptrdiff_t offset) const { return *(*this + offset); }
+
+private:
+  /// Pointers to the current value of each field
+  std::tuple<Ts*...> ptr_;
+};
+
+/**
+ * @brief Iterable view of fields whose consecutive values are a fixed number of bytes apart
+ *
+ *        Fields stored on their own are contiguous, with a stride equal to their size; fields stored in a \c group
+ *        are interleaved with the other fields of that group
+ */
+template <typename FieldTs, typename StridesT> class StridedView;
+
+/**
+ * @copydoc StridedView
+ */
+template <typename... Ts, std::size_t... Strides> class StridedView<std::tuple<Ts...>, std::index_sequence<Strides...>>
+{
+public:
+  /// Iterator over all elements
+  using iterator = StridedIterator<std::tuple<Ts*...>, std::index_sequence<Strides...>>;
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline iterator begin() const { return iterator{data_}; }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline iterator end() const { return iterator{data_} + static_cast<std::ptrdiff_t>(size_); }
+
+  /**
+   * @brief Returns the number of elements in the view
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns true when element count is zero (view is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) const { return begin()[static_cast<std::ptrdiff_t>(pos)]; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the view
+   */
+  inline auto at(const std::size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      throw std::out_of_range{"'pos' exceeds valid range of view"};
+    }
+    return (*this)[pos];
+  }
+
+private:
+  template <typename FieldOrGroupTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy>
+  friend class BasicGroupedMultiFieldArray;
+
+  StridedView(const std::tuple<Ts*...>& data, const std::size_t size) : data_{data}, size_{size} {}
+
+  /// Pointers to the first value of each field
+  std::tuple<Ts*...> data_;
+
+  /// Number of elements
+  std::size_t size_;
+};
+
+/**
+ * @brief Multi-field array where fields in each \c group are stored interleaved (array-of-structures), while each
+ *        \c group, and each field which is not in a \c group, is stored in a separate segment (structure-of-arrays)
+ *
+ *        Fields which are always accessed together share cache lines, while rarely accessed fields are kept out of
+ *        the way. Fields are accessed by type, regardless of how they are grouped, so \c get, \c view and
+ *        \c emplace_back take the flattened list of fields. Each \c group is stored as a \c FieldGroup in a
+ *        \c BasicMultiFieldArray, which is available through \c storage for bulk operations.
+ *
+ * @tparam AllocatorAdapterT  multi-field allocator adapter for the stored type of each field or \c group
+ *                            (see \c field_group_storage_t)
+ */
+template <typename... FieldOrGroupTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy>
+class BasicGroupedMultiFieldArray<std::tuple<FieldOrGroupTs...>, AllocatorAdapterT, CapacityIncreasePolicy>
+{
+public:
+  /// Array which holds a segment for each field or \c group
+  using storage_type = BasicMultiFieldArray<
+    std::tuple<field_group_storage_t<FieldOrGroupTs>...>,
+    AllocatorAdapterT,
+    CapacityIncreasePolicy>;
+
+  /// Alias for multi-field allocator adapter
+  using allocator_adapter_type = AllocatorAdapterT;
+
+  /// Tuple of field value types, with all groups flattened
+  using value_type =
+    decltype(std::tuple_cat(std::declval<typename detail::FieldGroupTraits<FieldOrGroupTs>::field_types>()...));
+
+  /**
+   * @brief Index of the field or \c group which holds a field of type \c ValueT
+   */
+  template <typename ValueT> static constexpr std::size_t group_index_of = [] {
+    constexpr std::array<bool, sizeof...(FieldOrGroupTs)> holds_value = {
+      detail::FieldGroupTraits<FieldOrGroupTs>::template contains<ValueT>...};
+    std::size_t group_index = 0;
+    while (group_index < holds_value.size() and !holds_value[group_index])
+    {
+      ++group_index;
+    }
+    return group_index;
+  }();
+
+  /**
+   * @brief Distance, in bytes, from the start of each stored value to the field of type \c ValueT
+   */
+  template <typename ValueT>
+  static constexpr std::size_t offset_of = detail::FieldGroupTraits<
+    std::tuple_element_t<group_index_of<ValueT>, std::tuple<FieldOrGroupTs...>>>::template offset_of<ValueT>;
+
+  /**
+   * @brief Distance, in bytes, between consecutive values of a field of type \c ValueT
+   */
+  template <typename ValueT>
+  static constexpr std::size_t stride_of =
+    sizeof(std::tuple_element_t<group_index_of<ValueT>, std::tuple<field_group_storage_t<FieldOrGroupTs>...>>);
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size and capacity to zero
+   */
+  BasicGroupedMultiFieldArray() = default;
+
+  /**
+   * @brief Allocator adapter initialization constructor
+   */
+  explicit BasicGroupedMultiFieldArray(const allocator_adapter_type& allocator_adapter) : storage_{allocator_adapter}
+  {}
+
+  /**
+   * @brief Creates \c count value-initialized elements
+   */
+  explicit BasicGroupedMultiFieldArray(std::size_t count) : storage_{count} {}
+
+  /**
+   * @brief Creates \c count elements, copy-constructed from each value in \c ctor_arg_tuple, which holds a value for
+   *        each field, with all groups flattened
+   */
+  template <typename CTorArgTupleT>
+  BasicGroupedMultiFieldArray(std::size_t count, const CTorArgTupleT& ctor_arg_tuple) :
+      storage_{count, BasicGroupedMultiFieldArray::make_storage_values(ctor_arg_tuple, group_indices{})}
+  {}
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   */
+  inline void swap(BasicGroupedMultiFieldArray& other) { storage_.swap(other.storage_); }
+
+  /**
+   * @brief Returns references to values at index for each specified field type
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<SingleValueT&>(BasicGroupedMultiFieldArray::template field<SingleValueT>(index));
+    }
+    else
+    {
+      return std::tuple<ValueTs&...>{BasicGroupedMultiFieldArray::template field<ValueTs>(index)...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<const SingleValueT&>(BasicGroupedMultiFieldArray::template field<SingleValueT>(index));
+    }
+    else
+    {
+      return std::tuple<const ValueTs&...>{BasicGroupedMultiFieldArray::template field<ValueTs>(index)...};
+    }
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        All arguments should be lvalue or rvalue references to values used to copy/move construct values for each
+   *        field, with all groups flattened; if no arguments are given, all fields are value-initialized
+   */
+  template <typename... FieldCopyOrMoveCTorTs>
+  inline void emplace_back(FieldCopyOrMoveCTorTs&&... copy_or_move_ctor_args)
+  {
+    static_assert(
+      (sizeof...(FieldCopyOrMoveCTorTs) == std::tuple_size_v<value_type>) or (sizeof...(FieldCopyOrMoveCTorTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+
+    if constexpr (sizeof...(FieldCopyOrMoveCTorTs) == 0UL)
+    {
+      storage_.emplace_back();
+    }
+    else
+    {
+      BasicGroupedMultiFieldArray::emplace_back_grouped(
+        std::forward_as_tuple(std::forward<FieldCopyOrMoveCTorTs>(copy_or_move_ctor_args)...), group_indices{});
+    }
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   */
+  void push_back(const value_type& value)
+  {
+    std::apply([this](const auto&... fields) { this->emplace_back(fields...); }, value);
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  inline void pop_back() { storage_.pop_back(); }
+
+  /**
+   * @brief Ensures that capacity is at least \c new_capacity elements
+   */
+  inline void reserve(const std::size_t new_capacity) { storage_.reserve(new_capacity); }
+
+  /**
+   * @brief Resizes container to the given size, \c new_size
+   *
+   *        New elements are value-initialized, or copy-constructed from each value in \c ctor_arg_tuple, which holds a
+   *        value for each field, with all groups flattened
+   */
+  template <typename... CTorArgTupleT> void resize(const std::size_t new_size, const CTorArgTupleT&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+    storage_.resize(new_size, BasicGroupedMultiFieldArray::make_storage_values(ctor_arg_tuple, group_indices{})...);
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0
+   */
+  inline void clear() { storage_.clear(); }
+
+  /**
+   * @brief Reduces capacity to the current number of elements
+   */
+  inline void shrink_to_fit() { storage_.shrink_to_fit(); }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return storage_.empty(); }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return storage_.size(); }
+
+  /**
+   * @brief Returns the number of elements which the container can hold without re-allocating
+   */
+  inline std::size_t capacity() const { return storage_.capacity(); }
+
+  /**
+   * @brief Returns the array which holds a segment for each field or \c group
+   */
+  inline storage_type& storage() { return storage_; }
+
+  /**
+   * @copydoc storage
+   */
+  inline const storage_type& storage() const { return storage_; }
+
+  /**
+   * @brief Returns a pointer to the first value of the field with type \c ValueT
+   *
+   *        Consecutive values are \c stride_of<ValueT> bytes apart. The pointer is computed from the start of the
+   *        field's segment, so no element is accessed, and it is valid for a reserved but empty container.
+   */
+  template <typename ValueT> inline ValueT* data()
+  {
+    if (storage_.capacity() == 0UL)
+    {
+      return nullptr;
+    }
+    auto* const ptr = detail::advance_bytes(
+      reinterpret_cast<ValueT*>(std::get<group_index_of<ValueT>>(storage_.data())),
+      static_cast<std::ptrdiff_t>(offset_of<ValueT>));
+    MF_ASSERT(storage_.empty() or ptr == std::addressof(BasicGroupedMultiFieldArray::field<ValueT>(0UL)));
+    return ptr;
+  }
+
+  /**
+   * @copydoc data
+   */
+  template <typename ValueT> inline const ValueT* data() const
+  {
+    if (storage_.capacity() == 0UL)
+    {
+      return nullptr;
+    }
+    const auto* const ptr = detail::advance_bytes(
+      reinterpret_cast<const ValueT*>(storage_.template data<group_index_of<ValueT>>()),
+      static_cast<std::ptrdiff_t>(offset_of<ValueT>));
+    MF_ASSERT(storage_.empty() or ptr == std::addressof(BasicGroupedMultiFieldArray::field<ValueT>(0UL)));
+    return ptr;
+  }
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline auto begin() { return view().begin(); }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline auto end() { return view().end(); }
+
+  /**
+   * @copydoc begin
+   */
+  inline auto begin() const { return view().begin(); }
+
+  /**
+   * @copydoc end
+   */
+  inline auto end() const { return view().end(); }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  inline auto view() { return BasicGroupedMultiFieldArray::view(std::make_index_sequence<field_count>{}); }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs>
+  StridedView<std::tuple<ViewValueTs...>, std::index_sequence<stride_of<ViewValueTs>...>> view()
+  {
+    return StridedView<std::tuple<ViewValueTs...>, std::index_sequence<stride_of<ViewValueTs>...>>{
+      std::tuple<ViewValueTs*...>{BasicGroupedMultiFieldArray::template data<ViewValueTs>()...}, size()};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> inline auto view()
+  {
+    return BasicGroupedMultiFieldArray::template view<std::tuple_element_t<Indices, value_type>...>();
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  inline auto view() const { return BasicGroupedMultiFieldArray::view(std::make_index_sequence<field_count>{}); }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs>
+  StridedView<std::tuple<const ViewValueTs...>, std::index_sequence<stride_of<ViewValueTs>...>> view() const
+  {
+    return StridedView<std::tuple<const ViewValueTs...>, std::index_sequence<stride_of<ViewValueTs>...>>{
+      std::tuple<const ViewValueTs*...>{BasicGroupedMultiFieldArray::template data<ViewValueTs>()...}, size()};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> inline auto view() const
+  {
+    return BasicGroupedMultiFieldArray::template view<std::tuple_element_t<Indices, value_type>...>();
+  }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) { return view()[pos]; }
+
+  /**
+   * @copydoc operator[]
+   */
+  inline auto operator[](const std::size_t pos) const { return view()[pos]; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the container
+   */
+  inline auto at(const std::size_t pos) { return view().at(pos); }
+
+  /**
+   * @copydoc at
+   */
+  inline auto at(const std::size_t pos) const { return view().at(pos); }
+
+private:
+  /// Number of fields, with all groups flattened
+  static constexpr std::size_t field_count = std::tuple_size_v<value_type>;
+
+  /// Indices of each field or \c group
+  using group_indices = std::make_index_sequence<sizeof...(FieldOrGroupTs)>;
+
+  /// Index of the first field of each field or \c group, with all groups flattened
+  static constexpr std::array<std::size_t, sizeof...(FieldOrGroupTs)> first_field_indices = [] {
+    constexpr std::array<std::size_t, sizeof...(FieldOrGroupTs)> field_counts = {
+      std::tuple_size_v<typename detail::FieldGroupTraits<FieldOrGroupTs>::field_types>...};
+    std::array<std::size_t, sizeof...(FieldOrGroupTs)> indices{};
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < field_counts.size(); ++i)
+    {
+      indices[i] = index;
+      index += field_counts[i];
+    }
+    return indices;
+  }();
+
+  /**
+   * @brief Returns a reference to the field with type \c ValueT of the element at \c index
+   */
+  template <typename ValueT> inline ValueT& field(const std::size_t index)
+  {
+    static_assert(group_index_of<ValueT> < sizeof...(FieldOrGroupTs), "ValueT is not a field of this container");
+    using TraitsT =
+      detail::FieldGroupTraits<std::tuple_element_t<group_index_of<ValueT>, std::tuple<FieldOrGroupTs...>>>;
+    return TraitsT::template field<ValueT>(std::get<group_index_of<ValueT>>(storage_.data())[index]);
+  }
+
+  /**
+   * @copydoc field
+   */
+  template <typename ValueT> inline const ValueT& field(const std::size_t index) const
+  {
+    static_assert(group_index_of<ValueT> < sizeof...(FieldOrGroupTs), "ValueT is not a field of this container");
+    using TraitsT =
+      detail::FieldGroupTraits<std::tuple_element_t<group_index_of<ValueT>, std::tuple<FieldOrGroupTs...>>>;
+    return TraitsT::template field<ValueT>(storage_.template data<group_index_of<ValueT>>()[index]);
+  }
+
+  template <std::size_t... FieldIndices> inline auto view(std::index_sequence<FieldIndices...> _)
+  {
+    return BasicGroupedMultiFieldArray::template view<std::tuple_element_t<FieldIndices, value_type>...>();
+  }
+
+  template <std::size_t... FieldIndices> inline auto view(std::index_sequence<FieldIndices...> _) const
+  {
+    return BasicGroupedMultiFieldArray::template view<std::tuple_element_t<FieldIndices, value_type>...>();
+  }
+
+  /**
+   * @brief Returns references to the arguments in \c args for each field of the field or \c group at \c GroupIndex
+   */
+  template <std::size_t GroupIndex, typename ArgTupleT, std::size_t... Indices>
+  static inline auto group_args(ArgTupleT&& args, std::index_sequence<Indices...> _)
+  {
+    static constexpr std::size_t first_field_index = first_field_indices[GroupIndex];
+    return std::forward_as_tuple(std::get<first_field_index + Indices>(std::forward<ArgTupleT>(args))...);
+  }
+
+  /**
+   * @copydoc group_args
+   */
+  template <std::size_t GroupIndex, typename ArgTupleT> static inline auto group_args(ArgTupleT&& args)
+  {
+    using FieldTypes =
+      typename detail::FieldGroupTraits<std::tuple_element_t<GroupIndex, std::tuple<FieldOrGroupTs...>>>::field_types;
+    return group_args<GroupIndex>(
+      std::forward<ArgTupleT>(args), std::make_index_sequence<std::tuple_size_v<FieldTypes>>{});
+  }
+
+  /**
+   * @brief Constructs the value stored for each field or \c group, in place, from flattened arguments
+   */
+  template <typename ArgTupleT, std::size_t... GroupIndices>
+  inline void emplace_back_grouped(ArgTupleT&& args, std::index_sequence<GroupIndices...> _)
+  {
+    // Each stored value is constructed in place from references to its own arguments; each argument is only
+    // forwarded once, so it is never used after being moved
+    storage_.emplace_back(
+      std::piecewise_construct,
+      BasicGroupedMultiFieldArray::group_args<GroupIndices>(std::forward<ArgTupleT>(args))...);
+  }
+
+  /**
+   * @brief Returns the value stored for each field or \c group, from a tuple with a value for each flattened field
+   */
+  template <typename CTorArgTupleT, std::size_t... GroupIndices>
+  static inline std::tuple<field_group_storage_t<FieldOrGroupTs>...>
+  make_storage_values(const CTorArgTupleT& ctor_arg_tuple, std::index_sequence<GroupIndices...> _)
+  {
+    return std::tuple<field_group_storage_t<FieldOrGroupTs>...>{std::make_from_tuple<field_group_storage_t<
+      std::tuple_element_t<GroupIndices, std::tuple<FieldOrGroupTs...>>>>(group_args<GroupIndices>(ctor_arg_tuple))...};
+  }
+
+  /// Holds a segment for each field or \c group
+  storage_type storage_;
+};
+
+/**
+ * @brief Convenience alias for a grouped multi-field array which uses \c std::allocator for each field or \c group
+ */
+template <typename... FieldOrGroupTs>
+using grouped_multi_field_array = BasicGroupedMultiFieldArray<
+  std::tuple<FieldOrGroupTs...>,
+  default_allocator_adapter<field_group_storage_t<FieldOrGroupTs>...>,
+  DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
@@ -0,0 +1,255 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+// POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/support/single_pass_layout.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Tag type used to specify a single-allocation strategy which backs field segments with huge pages
+ *
+ * @tparam Prefault  if true, all pages are faulted in when memory is allocated, rather than on first touch
+ * @tparam Lock  if true, allocated pages are locked into physical memory with \c mlock, where permitted
+ * @tparam SegmentAlignment  minimum alignment of the start of each field segment
+ */
+template <bool Prefault = false, bool Lock = false, std::size_t SegmentAlignment = 1UL>
+struct HugePageAllocationStrategy
+{};
+
+/**
+ * @copydoc BasicMultiAllocatorAdapter
+ *
+ *          Allocates memory for all fields at once, with the same layout as \c SinglePassAllocationStrategy, from a
+ *          private mapping which is a whole number of huge pages long. Explicit huge pages (\c MAP_HUGETLB) are used
+ *          when the system has them reserved; otherwise, a huge-page aligned mapping is requested from transparent
+ *          huge page support with \c madvise(MADV_HUGEPAGE).
+ *
+ * @note every allocation occupies at least one huge page, so this strategy is only suited to very large arrays
+ */
+template <typename... ValueTs, bool Prefault, bool Lock, std::size_t SegmentAlignment>
+class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, HugePageAllocationStrategy<Prefault, Lock, SegmentAlignment>>
+{
+public:
+  using allocator_types = std::tuple<>;
+
+  /// Describes the placement of each field segment within an allocated block
+  using layout_type = SinglePassLayout<std::tuple<ValueTs...>, SegmentAlignment>;
+
+  static_assert(layout_type::block_alignment <= huge_page_size, "SegmentAlignment must not exceed huge_page_size");
+
+  /// Memory cannot be resized with \c reallocate
+  static constexpr bool supports_reallocate = false;
+
+  /// Memory cannot be resized without moving elements
+  static constexpr bool supports_resize_in_place = false;
+
+  /// Newly mapped memory is always filled with zero bytes
+  static constexpr bool supports_allocate_zeroed = true;
+
+  /// Memory is mapped outside of the adapter, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment = std::false_type;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is move-assigned
+  using propagate_on_container_move_assignment = std::true_type;
+
+  /// Adapter is stateless; it never needs to be exchanged when containers are swapped
+  using propagate_on_container_swap = std::false_type;
+
+  /// Memory allocated by any adapter of this type may be de-allocated by any other
+  using is_always_equal = std::true_type;
+
+  BasicMultiAllocatorAdapter() = default;
+  BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const { return *this; }
+
+  /**
+   * @brief Always true, since adapters of this type are stateless
+   */
+  constexpr bool operator==([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return true; }
+
+  /**
+   * @brief Always false, since adapters of this type are stateless
+   */
+  constexpr bool operator!=([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return false; }
+
+  /**
+   * @brief Maps huge pages for \c n elements of each type in \c ValueTs
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   *
+   * @throws \c std::bad_alloc  if memory could not be mapped
+   */
+  std::tuple<ValueTs*...> allocate(const std::size_t n)
+  {
+    const std::size_t length = mapped_length(n);
+    if (length == 0UL)
+    {
+      return layout_type::segments(nullptr, n);
+    }
+
+    auto* const block = BasicMultiAllocatorAdapter::map(length);
+
+    if constexpr (Prefault)
+    {
+      BasicMultiAllocatorAdapter::prefault(block, length);
+    }
+
+    if constexpr (Lock)
+    {
+      // Best effort; locking fails if it would exceed RLIMIT_MEMLOCK
+      ::mlock(block, length);
+    }
+
+    return layout_type::segments(block, n);
+  }
+
+  /**
+   * @brief Maps huge pages for \c n elements of each type in \c ValueTs
+   *
+   *        Equivalent to \c allocate, since newly mapped pages are filled with zero bytes
+   */
+  std::tuple<ValueTs*...> allocate_zeroed(const std::size_t n) { return BasicMultiAllocatorAdapter::allocate(n); }
+
+  /**
+   * @brief Unmaps memory for \c n elements of each type in \c ValueTs
+   *
+   * @param ptr  points to memory segments to be de-allocated
+   * @param n  number of elements to de-allocate
+   */
+  void deallocate(const std::tuple<ValueTs*...>& ptrs, const std::size_t n)
+  {
+    auto* const block = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
+
+    // Nothing was allocated for this block
+    if (block == nullptr)
+    {
+      return;
+    }
+
+    ::munmap(block, mapped_length(n));
+  }
+
+private:
+  /**
+   * @brief Returns the length of the mapping which holds \c n values of each field
+   */
+  static constexpr std::size_t mapped_length(const std::size_t n)
+  {
+    return align_up(layout_type::length(n), huge_page_size);
+  }
+
+  /**
+   * @brief Maps \c length bytes, starting on a huge page boundary
+   *
+   * @throws \c std::bad_alloc  if memory could not be mapped
+   */
+  static std::uint8_t* map(const std::size_t length)
+  {
+#ifdef MAP_HUGETLB
+    {
+      // Fails unless huge pages have been reserved by the system (vm.nr_hugepages)
+      void* const addr =
+        ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (addr != MAP_FAILED)
+      {
+        return static_cast<std::uint8_t*>(addr);
+      }
+    }
+#endif  // MAP_HUGETLB
+
+    // Over-map by a huge page, then trim the mapping to a huge page boundary on either side
+    void* const addr =
+      ::mmap(nullptr, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED)
+    {
+      throw std::bad_alloc{};
+    }
+
+    auto* const raw_block = static_cast<std::uint8_t*>(addr);
+    const auto raw_value = reinterpret_cast<std::uintptr_t>(raw_block);
+    const std::size_t head = align_up(raw_value, huge_page_size) - raw_value;
+    if (head != 0UL)
+    {
+      ::munmap(raw_block, head);
+    }
+    ::munmap(raw_block + head + length, huge_page_size - head);
+
+    auto* const block = raw_block + head;
+#ifdef MADV_HUGEPAGE
+    ::madvise(block, length, MADV_HUGEPAGE);
+#endif  // MADV_HUGEPAGE
+    return block;
+  }
+
+  /**
+   * @brief Faults in all pages of a mapped \c block of \c length bytes
+   */
+  static void prefault(std::uint8_t* const block, const std::size_t length)
+  {
+#ifdef MADV_POPULATE_WRITE
+    if (::madvise(block, length, MADV_POPULATE_WRITE) == 0)
+    {
+      return;
+    }
+#endif  // MADV_POPULATE_WRITE
+
+    // Write to each base page; anonymous memory is already zeroed, so this does not change its contents
+    static const std::size_t base_page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    for (std::size_t offset = 0UL; offset < length; offset += base_page_size)
+    {
+      static_cast<volatile std::uint8_t*>(block)[offset] = 0;
+    }
+  }
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which backs fields with huge pages
+ */
+template <typename... ValueTs>
+using huge_page_allocator_adapter = BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, HugePageAllocationStrategy<>>;
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which backs fields with huge pages, which
+ * are faulted in and locked into physical memory up front
+ */
+template <typename... ValueTs>
+using prefaulted_huge_page_allocator_adapter =
+  BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, HugePageAllocationStrategy<true, true>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which backs fields with huge pages
+ */
+template <typename... FieldTs>
+using huge_page_multi_field_array =
+  BasicMultiFieldArray<std::tuple<FieldTs...>, huge_page_allocator_adapter<FieldTs...>, DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
@@ -0,0 +1,246 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+// MF
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/support/single_pass_layout.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Tag type used to specify a strategy which holds up to \c N elements of each field within the adapter
+ *
+ * @tparam N  number of elements of each field held inline
+ * @tparam UpstreamStrategyT  strategy used to allocate memory for more than \c N elements
+ */
+template <std::size_t N, typename UpstreamStrategyT = SinglePassAllocationStrategy<std::allocator<std::uint8_t>>>
+struct InlineAllocationStrategy
+{};
+
+/**
+ * @copydoc BasicMultiAllocatorAdapter
+ *
+ *          Holds a block with room for \c N elements of each field within the adapter itself. Requests for up to
+ *          \c N elements are served from that block while it is unused; all other requests are forwarded to an
+ *          adapter using \c UpstreamStrategyT. Field segments within the inline block are always laid out for \c N
+ *          elements, so memory held inline can be resized in place up to \c N elements.
+ *
+ *          Copying or moving an adapter only copies or moves its upstream adapter; the inline block always starts out
+ *          unused. Containers must move elements out of the inline block, rather than take its memory, when they are
+ *          moved (see \c has_inline_storage and \c is_inline).
+ */
+template <typename... ValueTs, std::size_t N, typename UpstreamStrategyT>
+class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, InlineAllocationStrategy<N, UpstreamStrategyT>>
+{
+  static_assert(N > 0, "N must be greater than zero");
+
+  /// Allocates memory for more than \c N elements
+  using upstream_type = BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, UpstreamStrategyT>;
+
+public:
+  using allocator_types = typename upstream_type::allocator_types;
+
+  /// Describes the placement of each field segment within the inline block
+  using layout_type = SinglePassLayout<std::tuple<ValueTs...>, 1UL>;
+
+  /// Number of elements of each field held inline
+  static constexpr std::size_t inline_capacity = N;
+
+  /// Memory cannot be resized with \c reallocate
+  static constexpr bool supports_reallocate = false;
+
+  /// Memory held inline may be resized up to \c N elements without moving elements
+  static constexpr bool supports_resize_in_place = true;
+
+  /// Inline memory may be reused, so it is not known to be zero-filled
+  static constexpr bool supports_allocate_zeroed = false;
+
+  /// Memory for up to \c N elements is held within the adapter itself
+  static constexpr bool has_inline_storage = true;
+
+  /// True if the upstream adapter is replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment = typename upstream_type::propagate_on_container_copy_assignment;
+
+  /// True if the upstream adapter is replaced when its container is move-assigned
+  using propagate_on_container_move_assignment = typename upstream_type::propagate_on_container_move_assignment;
+
+  /// True if upstream adapters are exchanged when containers are swapped
+  using propagate_on_container_swap = typename upstream_type::propagate_on_container_swap;
+
+  /// Inline memory may only be de-allocated by the adapter which holds it
+  using is_always_equal = std::false_type;
+
+  BasicMultiAllocatorAdapter() : upstream_{}, inline_in_use_{false} {}
+
+  BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&& other) :
+      upstream_{std::move(other.upstream_)},
+      inline_in_use_{false}
+  {}
+
+  BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter& other) :
+      upstream_{other.upstream_},
+      inline_in_use_{false}
+  {}
+
+  /**
+   * @brief Upstream adapter initialization constructor
+   */
+  explicit BasicMultiAllocatorAdapter(const upstream_type& upstream) : upstream_{upstream}, inline_in_use_{false} {}
+
+  /**
+   * @brief Replaces the upstream adapter; the inline block is unchanged
+   */
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&& other)
+  {
+    upstream_ = std::move(other.upstream_);
+    return *this;
+  }
+
+  /**
+   * @copydoc operator=
+   */
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter& other)
+  {
+    upstream_ = other.upstream_;
+    return *this;
+  }
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const
+  {
+    return BasicMultiAllocatorAdapter{upstream_.select_on_container_copy_construction()};
+  }
+
+  /**
+   * @brief Returns true if memory allocated upstream by this adapter may be de-allocated by \c other, and vice versa
+   */
+  bool operator==(const BasicMultiAllocatorAdapter& other) const { return upstream_ == other.upstream_; }
+
+  /**
+   * @brief Returns true if memory allocated upstream by this adapter may not be de-allocated by \c other
+   */
+  bool operator!=(const BasicMultiAllocatorAdapter& other) const { return !(*this == other); }
+
+  /**
+   * @brief Allocates memory for \c n elements of each type in \c ValueTs, from the inline block if possible
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> allocate(const std::size_t n)
+  {
+    if (n <= N and !inline_in_use_)
+    {
+      inline_in_use_ = true;
+      return layout_type::segments(inline_block_, N);
+    }
+    return upstream_.allocate(n);
+  }
+
+  /**
+   * @brief De-allocates memory for \c n elements of each type in \c ValueTs
+   *
+   * @param ptr  points to memory segments to be de-allocated
+   * @param n  number of elements to de-allocate
+   */
+  void deallocate(const std::tuple<ValueTs*...>& ptrs, const std::size_t n)
+  {
+    if (BasicMultiAllocatorAdapter::is_inline(ptrs))
+    {
+      inline_in_use_ = false;
+      return;
+    }
+    upstream_.deallocate(ptrs, n);
+  }
+
+  /**
+   * @brief Resizes memory for \c old_n elements to \c new_n elements, without moving any elements
+   *
+   * @param ptrs  points to memory segments previously allocated with this adapter
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @retval true  if memory was resized
+   * @retval false  if memory could not be resized without moving elements
+   */
+  bool resize_in_place(const std::tuple<ValueTs*...>& ptrs, const std::size_t old_n, const std::size_t new_n)
+  {
+    if (BasicMultiAllocatorAdapter::is_inline(ptrs))
+    {
+      return new_n <= N;
+    }
+    else if constexpr (upstream_type::supports_resize_in_place)
+    {
+      return upstream_.resize_in_place(ptrs, old_n, new_n);
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Returns true if \c ptrs point into the inline block of this adapter
+   */
+  bool is_inline(const std::tuple<ValueTs*...>& ptrs) const
+  {
+    return reinterpret_cast<const std::uint8_t*>(std::get<0>(ptrs)) == inline_block_;
+  }
+
+private:
+  /// Allocates memory for more than \c N elements
+  upstream_type upstream_;
+
+  /// True if the inline block holds elements of a container
+  bool inline_in_use_;
+
+  /// Memory for \c N elements of each field
+  alignas(layout_type::block_alignment) std::uint8_t inline_block_[layout_type::length(N)];
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which first grows to exactly \c N elements, then grows according to
+ *        \c BasePolicy
+ *
+ *        Used with \c InlineAllocationStrategy, so that arrays fill their inline block before spilling upstream
+ */
+template <std::size_t N, typename BasePolicy = DefaultCapacityIncreasePolicy> struct InlineCapacityIncreasePolicy
+{
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity, std::size_t element_bytes)
+  {
+    return (prev_capacity <= N) ? N : ::mf::next_capacity<BasePolicy>(prev_capacity, element_bytes);
+  }
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which holds up to \c N elements inline
+ */
+template <std::size_t N, typename... ValueTs>
+using inline_allocator_adapter = BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, InlineAllocationStrategy<N>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which holds up to \c N elements inline, and only allocates memory
+ *        when it holds more
+ */
+template <std::size_t N, typename... FieldTs>
+using small_multi_field_array = BasicMultiFieldArray<
+  std::tuple<FieldTs...>,
+  inline_allocator_adapter<N, FieldTs...>,
+  InlineCapacityIncreasePolicy<N>>;
+
+}  // namespace mf
@@ -0,0 +1,119 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Allocator which uses \c std::malloc and \c std::free, and which can resize allocations with \c std::realloc
+ *
+ *        \c std::realloc may extend an allocation in place, avoiding a copy altogether. For large allocations
+ *        which are backed by their own memory mapping, glibc resizes the mapping with \c mremap, which remaps
+ *        pages rather than copying them.
+ */
+template <typename T> class MallocAllocator
+{
+  static_assert(alignof(T) <= alignof(std::max_align_t), "T must not be over-aligned");
+
+public:
+  using value_type = T;
+
+  MallocAllocator() = default;
+
+  template <typename U> constexpr MallocAllocator(const MallocAllocator<U>& _) noexcept {}
+
+  /**
+   * @brief Allocates memory for \c n values
+   *
+   * @throws \c std::bad_alloc  if allocation fails
+   */
+  [[nodiscard]] T* allocate(const std::size_t n) { return MallocAllocator::checked(std::malloc(sizeof(T) * n), n); }
+
+  /**
+   * @brief Allocates memory for \c n values, filled with zero bytes
+   *
+   *        Large allocations are mapped directly from the system, in which case they are not written to; untouched
+   *        pages are backed by the shared zero page
+   *
+   * @throws \c std::bad_alloc  if allocation fails
+   */
+  [[nodiscard]] T* allocate_zeroed(const std::size_t n)
+  {
+    return MallocAllocator::checked(std::calloc(n, sizeof(T)), n);
+  }
+
+  /**
+   * @brief De-allocates memory for \c n values previously allocated with this allocator
+   */
+  void deallocate(T* const ptr, [[maybe_unused]] const std::size_t n) noexcept { std::free(ptr); }
+
+  /**
+   * @brief Resizes memory previously allocated for \c old_n values to hold \c new_n values
+   *
+   *        The first <code>min(old_n, new_n)</code> values are preserved as bytes. The returned memory may
+   *        not begin at \c ptr.
+   *
+   * @throws \c std::bad_alloc  if re-allocation fails, in which case \c ptr is left unchanged
+   */
+  [[nodiscard]] T* reallocate(T* const ptr, [[maybe_unused]] const std::size_t old_n, const std::size_t new_n)
+  {
+    return MallocAllocator::checked(std::realloc(static_cast<void*>(ptr), sizeof(T) * new_n), new_n);
+  }
+
+  template <typename U> constexpr bool operator==(const MallocAllocator<U>& _) const noexcept { return true; }
+
+  template <typename U> constexpr bool operator!=(const MallocAllocator<U>& _) const noexcept { return false; }
+
+private:
+  static T* checked(void* const ptr, const std::size_t n)
+  {
+    if (ptr == nullptr and n != 0UL)
+    {
+      throw std::bad_alloc{};
+    }
+    return static_cast<T*>(ptr);
+  }
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter with \c MallocAllocator for each
+ * provided type
+ */
+template <typename... ValueTs>
+using multi_malloc_allocator_adapter =
+  BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, std::tuple<MallocAllocator<ValueTs>...>>;
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter for single-pass allocation with \c
+ * MallocAllocator<std::uint8_t>
+ */
+template <typename... ValueTs>
+using single_malloc_allocator_adapter =
+  BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStrategy<MallocAllocator<std::uint8_t>>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which allocates with \c std::malloc, and which can resize and
+ * zero-fill memory without writing to it
+ */
+template <typename... FieldTs>
+using malloc_multi_field_array = BasicMultiFieldArray<
+  std::tuple<FieldTs...>,
+  single_malloc_allocator_adapter<FieldTs...>,
+  DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
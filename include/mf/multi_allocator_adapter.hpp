@@ -5,14 +5,21 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <memory_resource>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
 // MF
+#include <mf/support/allocator_traits.hpp>
 #include <mf/support/pointer_element_type.hpp>
 #include <mf/support/reverse_iterator_adapter.hpp>
+#include <mf/support/single_pass_layout.hpp>
 #include <mf/support/tuple_for_each.hpp>
 
 namespace mf
@@ -36,15 +43,73 @@ class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, std::tuple<AllocatorTs.
 public:
   using allocator_types = std::tuple<AllocatorTs...>;
 
+  /// True if memory for each field may be resized with \c reallocate
+  static constexpr bool supports_reallocate = (has_reallocate_v<AllocatorTs> and ...);
+
+  /// Memory cannot be resized without moving elements
+  static constexpr bool supports_resize_in_place = false;
+
+  /// True if zero-filled memory for each field may be allocated with \c allocate_zeroed
+  static constexpr bool supports_allocate_zeroed = (has_allocate_zeroed_v<AllocatorTs> and ...);
+
+  /// Memory comes from \c AllocatorTs, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// True if the adapter is replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment =
+    std::conjunction<typename std::allocator_traits<AllocatorTs>::propagate_on_container_copy_assignment...>;
+
+  /// True if the adapter is replaced when its container is move-assigned
+  using propagate_on_container_move_assignment =
+    std::conjunction<typename std::allocator_traits<AllocatorTs>::propagate_on_container_move_assignment...>;
+
+  /// True if adapters are exchanged when containers are swapped
+  using propagate_on_container_swap =
+    std::conjunction<typename std::allocator_traits<AllocatorTs>::propagate_on_container_swap...>;
+
+  /// True if memory allocated by any adapter of this type may be de-allocated by any other
+  using is_always_equal = std::conjunction<typename std::allocator_traits<AllocatorTs>::is_always_equal...>;
+
   BasicMultiAllocatorAdapter() = default;
   BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
   BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
 
   /**
    * @brief Allocator state initialization constructor
    */
   explicit BasicMultiAllocatorAdapter(const std::tuple<AllocatorTs...>& initial_state) : allocators_{initial_state} {}
 
+  /**
+   * @brief Memory resource initialization constructor; all field allocators allocate from \c resource
+   */
+  explicit BasicMultiAllocatorAdapter(std::pmr::memory_resource* const resource) : allocators_{AllocatorTs{resource}...}
+  {}
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const
+  {
+    return BasicMultiAllocatorAdapter{std::apply(
+      [](const auto&... allocators) {
+        return allocator_types{
+          std::allocator_traits<AllocatorTs>::select_on_container_copy_construction(allocators)...};
+      },
+      allocators_)};
+  }
+
+  /**
+   * @brief Returns true if memory allocated by this adapter may be de-allocated by \c other, and vice versa
+   */
+  bool operator==(const BasicMultiAllocatorAdapter& other) const { return allocators_ == other.allocators_; }
+
+  /**
+   * @brief Returns true if memory allocated by this adapter may not be de-allocated by \c other
+   */
+  bool operator!=(const BasicMultiAllocatorAdapter& other) const { return !(*this == other); }
+
   /**
    * @brief Allocates memory for \c n elements of each type in \c ValueTs
    *
@@ -56,9 +121,22 @@ public:
    */
   std::tuple<ValueTs*...> allocate(const std::size_t n)
   {
-    std::tuple<ValueTs*...> ptrs;
-    tuple_for_each([n](auto& allocator, auto& ptr) { ptr = allocator.allocate(n); }, allocators_, ptrs);
-    return ptrs;
+    return BasicMultiAllocatorAdapter::allocate_each(n, [n](auto& allocator) { return allocator.allocate(n); });
+  }
+
+  /**
+   * @brief Allocates memory for \c n elements of each type in \c ValueTs, filled with zero bytes
+   *
+   *        Allocation is performed per-field type
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> allocate_zeroed(const std::size_t n)
+  {
+    static_assert(supports_allocate_zeroed, "All allocators must provide allocate_zeroed(n)");
+    return BasicMultiAllocatorAdapter::allocate_each(n, [n](auto& allocator) { return allocator.allocate_zeroed(n); });
   }
 
   /**
@@ -74,14 +152,92 @@ public:
     tuple_for_each([n](auto& allocator, auto& ptr) { allocator.deallocate(ptr, n); }, allocators_, ptrs);
   }
 
+  /**
+   * @brief Resizes memory for each type in \c ValueTs from \c old_n to \c new_n elements
+   *
+   *        Leading elements are preserved as bytes, and must be trivially relocatable. A single field is resized
+   *        with its allocator's \c reallocate, which may extend it in place. Several fields are resized by
+   *        allocating all new segments before any old segment is released, since a field which was already
+   *        re-allocated could not be restored if a later one failed; use a single-pass adapter to extend all
+   *        fields in place.
+   *
+   * @param ptrs  points to memory segments to be re-allocated
+   * @param size  number of leading elements to preserve
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @return tuple of pointers to re-allocated memory each type in \c ValueTs
+   *
+   * @throws any exception thrown by an allocator, in which case \c ptrs are left unchanged
+   */
+  std::tuple<ValueTs*...> reallocate(
+    const std::tuple<ValueTs*...>& ptrs,
+    [[maybe_unused]] const std::size_t size,
+    const std::size_t old_n,
+    const std::size_t new_n)
+  {
+    static_assert(supports_reallocate, "All allocators must provide reallocate(pointer, old_n, new_n)");
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      return std::make_tuple(std::get<0>(allocators_).reallocate(std::get<0>(ptrs), old_n, new_n));
+    }
+    else
+    {
+      const auto new_ptrs = BasicMultiAllocatorAdapter::allocate(new_n);
+      tuple_for_each(
+        [n = std::min(size, new_n)](auto* const ptr, auto* const new_ptr) {
+          if (n != 0)
+          {
+            std::memcpy(static_cast<void*>(new_ptr), static_cast<const void*>(ptr), sizeof(*ptr) * n);
+          }
+        },
+        ptrs,
+        new_ptrs);
+      BasicMultiAllocatorAdapter::deallocate(ptrs, old_n);
+      return new_ptrs;
+    }
+  }
+
 private:
+  /**
+   * @brief Returns <code>allocate_fn(allocator)</code> for the allocator of each field
+   *
+   *        If any allocation throws, segments already allocated are released before the exception is rethrown.
+   */
+  template <typename AllocateFnT> std::tuple<ValueTs*...> allocate_each(const std::size_t n, AllocateFnT&& allocate_fn)
+  {
+    std::tuple<ValueTs*...> ptrs{static_cast<ValueTs*>(nullptr)...};
+    try
+    {
+      tuple_for_each([&allocate_fn](auto& allocator, auto& ptr) { ptr = allocate_fn(allocator); }, allocators_, ptrs);
+    }
+    catch (...)
+    {
+      tuple_for_each(
+        [n](auto& allocator, auto* const ptr) {
+          if (ptr != nullptr)
+          {
+            allocator.deallocate(ptr, n);
+          }
+        },
+        allocators_,
+        ptrs);
+      throw;
+    }
+    return ptrs;
+  }
+
   allocator_types allocators_;
 };
 
 /**
  * @brief Tag type used to specify single-allocation strategy, and which allocator type, \c AllocatorT to use
+ *
+ * @tparam AllocatorT  byte allocator used to allocate the single memory segment
+ * @tparam SegmentAlignment  minimum alignment of the start of each field segment (e.g. \c cache_line_size);
+ *                           each segment is always aligned to at least the alignment of its own value type
  */
-template <typename AllocatorT> struct SinglePassAllocationStrategy
+template <typename AllocatorT, std::size_t SegmentAlignment = 1UL> struct SinglePassAllocationStrategy
 {};
 
 /**
@@ -89,11 +245,11 @@ template <typename AllocatorT> struct SinglePassAllocationStrategy
  *
  *          Allocates memory for all fields at once by requesting a single memory segment
  *          which can contain all prospective elements. This memory segment will be as large
- *          as the sum of the sizes of all element value types (accounting for alignment requirements)
- *          times the number of elements requested, \c n.
+ *          as the sum of the sizes of all element value types times the number of elements requested, \c n,
+ *          plus any padding needed to align the start of each field segment.
  */
-template <typename... ValueTs, typename ByteAllocatorT>
-class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStrategy<ByteAllocatorT>>
+template <typename... ValueTs, typename ByteAllocatorT, std::size_t SegmentAlignment>
+class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStrategy<ByteAllocatorT, SegmentAlignment>>
 {
   static_assert(
     sizeof(typename std::allocator_traits<ByteAllocatorT>::value_type) == sizeof(std::uint8_t),
@@ -102,15 +258,71 @@ class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStr
 public:
   using allocator_types = std::tuple<ByteAllocatorT>;
 
+  /// Describes the placement of each field segment within an allocated block
+  using layout_type = SinglePassLayout<std::tuple<ValueTs...>, SegmentAlignment>;
+
+  /// True if memory for all fields may be resized with \c reallocate
+  static constexpr bool supports_reallocate = has_reallocate_v<ByteAllocatorT> and
+    layout_type::block_alignment <= aligned_allocator_traits<ByteAllocatorT>::max_alignment;
+
+  /// Memory cannot be resized without moving elements
+  static constexpr bool supports_resize_in_place = false;
+
+  /// True if zero-filled memory for all fields may be allocated with \c allocate_zeroed
+  static constexpr bool supports_allocate_zeroed = has_allocate_zeroed_v<ByteAllocatorT>;
+
+  /// Memory comes from \c ByteAllocatorT, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// True if the adapter is replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment =
+    typename std::allocator_traits<ByteAllocatorT>::propagate_on_container_copy_assignment;
+
+  /// True if the adapter is replaced when its container is move-assigned
+  using propagate_on_container_move_assignment =
+    typename std::allocator_traits<ByteAllocatorT>::propagate_on_container_move_assignment;
+
+  /// True if adapters are exchanged when containers are swapped
+  using propagate_on_container_swap = typename std::allocator_traits<ByteAllocatorT>::propagate_on_container_swap;
+
+  /// True if memory allocated by any adapter of this type may be de-allocated by any other
+  using is_always_equal = typename std::allocator_traits<ByteAllocatorT>::is_always_equal;
+
   BasicMultiAllocatorAdapter() = default;
   BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
   BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
 
   /**
    * @brief Allocator state initialization constructor
    */
   explicit BasicMultiAllocatorAdapter(const ByteAllocatorT& initial_state) : byte_allocator_{initial_state} {}
 
+  /**
+   * @brief Memory resource initialization constructor; the byte allocator allocates from \c resource
+   */
+  explicit BasicMultiAllocatorAdapter(std::pmr::memory_resource* const resource) : byte_allocator_{resource} {}
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const
+  {
+    return BasicMultiAllocatorAdapter{
+      std::allocator_traits<ByteAllocatorT>::select_on_container_copy_construction(byte_allocator_)};
+  }
+
+  /**
+   * @brief Returns true if memory allocated by this adapter may be de-allocated by \c other, and vice versa
+   */
+  bool operator==(const BasicMultiAllocatorAdapter& other) const { return byte_allocator_ == other.byte_allocator_; }
+
+  /**
+   * @brief Returns true if memory allocated by this adapter may not be de-allocated by \c other
+   */
+  bool operator!=(const BasicMultiAllocatorAdapter& other) const { return !(*this == other); }
+
   /**
    * @brief Allocates memory for \c n elements of each type in \c ValueTs
    *
@@ -122,21 +334,25 @@ public:
    */
   std::tuple<ValueTs*...> allocate(const std::size_t n)
   {
-    std::tuple<ValueTs*...> ptrs;
-
-    auto* byte_addr = byte_allocator_.allocate(total_allocation_length(n));
-
-    std::size_t offset = 0UL;
-
-    tuple_for_each(
-      [byte_addr, n, &offset](auto& ptr) {
-        using element_type = pointer_element_t<decltype(ptr)>;
-        ptr = reinterpret_cast<element_type*>(byte_addr + offset);
-        offset += (sizeof(element_type) * n);
-      },
-      ptrs);
+    auto* const raw_addr = aligned_allocator_traits<ByteAllocatorT>::allocate(
+      byte_allocator_, total_allocation_length(n), layout_type::block_alignment);
+    return layout_type::segments(BasicMultiAllocatorAdapter::align_block(raw_addr), n);
+  }
 
-    return ptrs;
+  /**
+   * @brief Allocates memory for \c n elements of each type in \c ValueTs, filled with zero bytes
+   *
+   *        Allocation is performed *ONCE* using a single, byte-allocator
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> allocate_zeroed(const std::size_t n)
+  {
+    static_assert(supports_allocate_zeroed, "Allocator must provide allocate_zeroed(n)");
+    auto* const raw_addr = byte_allocator_.allocate_zeroed(total_allocation_length(n));
+    return layout_type::segments(BasicMultiAllocatorAdapter::align_block(raw_addr), n);
   }
 
   /**
@@ -150,18 +366,129 @@ public:
   void deallocate(const std::tuple<ValueTs*...>& ptrs, const std::size_t n)
   {
     auto* const byte_addr = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
-    byte_allocator_.deallocate(byte_addr, total_allocation_length(n));
+
+    // Nothing was allocated for this block
+    if (byte_addr == nullptr)
+    {
+      return;
+    }
+
+    aligned_allocator_traits<ByteAllocatorT>::deallocate(
+      byte_allocator_,
+      BasicMultiAllocatorAdapter::unalign_block(byte_addr),
+      total_allocation_length(n),
+      layout_type::block_alignment);
+  }
+
+  /**
+   * @brief Resizes memory for all types in \c ValueTs from \c old_n to \c new_n elements
+   *
+   *        Re-allocation is performed *ONCE* using a single, byte-allocator, and may extend the block in place.
+   *        Leading elements of each field segment are then shifted to their positions in the resized layout.
+   *        Elements are preserved as bytes, and must be trivially relocatable. If re-allocation fails, segments are
+   *        left at their original positions in the original block.
+   *
+   * @param ptrs  points to memory segments to be re-allocated
+   * @param size  number of leading elements to preserve
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @return tuple of pointers to re-allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> reallocate(
+    const std::tuple<ValueTs*...>& ptrs,
+    const std::size_t size,
+    const std::size_t old_n,
+    const std::size_t new_n)
+  {
+    static_assert(supports_reallocate, "Allocator must provide reallocate(pointer, old_n, new_n)");
+
+    auto* byte_addr = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
+
+    // Pack segments before the tail of the block is released
+    if (new_n < old_n)
+    {
+      layout_type::move_segments(byte_addr, size, old_n, new_n);
+    }
+
+    try
+    {
+      byte_addr =
+        byte_allocator_.reallocate(byte_addr, total_allocation_length(old_n), total_allocation_length(new_n));
+    }
+    catch (...)
+    {
+      // Restore packed segments to their original positions, which the old block still covers
+      if (new_n < old_n)
+      {
+        layout_type::move_segments(byte_addr, size, new_n, old_n);
+      }
+      throw;
+    }
+
+    // Spread segments out once the block has been extended
+    if (new_n > old_n)
+    {
+      layout_type::move_segments(byte_addr, size, old_n, new_n);
+    }
+
+    return layout_type::segments(byte_addr, new_n);
   }
 
 private:
+  /// True if the byte allocator cannot be relied on to return blocks which satisfy the layout alignment
+  static constexpr bool is_over_aligned =
+    layout_type::block_alignment > aligned_allocator_traits<ByteAllocatorT>::max_alignment;
+
+  /// Extra bytes allocated to align an over-aligned block and record its offset from the allocated address
+  static constexpr std::size_t block_padding =
+    is_over_aligned ? (layout_type::block_alignment + sizeof(std::size_t)) : 0UL;
+
   /**
    * @brief Returns the required length of an allocated buffer which can \c n values of each type
    *
-   *        Length should account for alignment
+   *        Length accounts for the alignment of each segment
    */
   static constexpr std::size_t total_allocation_length(const std::size_t n)
   {
-    return sizeof(std::tuple<ValueTs...>) * n;
+    return layout_type::length(n) + block_padding;
+  }
+
+  /**
+   * @brief Returns start of the aligned block within an allocated buffer starting at \c raw_addr
+   *
+   *        For over-aligned layouts, the offset from \c raw_addr is recorded just before the returned address
+   */
+  static std::uint8_t* align_block(std::uint8_t* const raw_addr)
+  {
+    if constexpr (is_over_aligned)
+    {
+      const auto raw_value = reinterpret_cast<std::uintptr_t>(raw_addr);
+      const std::size_t shift = align_up(raw_value + sizeof(std::size_t), layout_type::block_alignment) - raw_value;
+      std::memcpy(raw_addr + shift - sizeof(std::size_t), &shift, sizeof(std::size_t));
+      return raw_addr + shift;
+    }
+    else
+    {
+      return raw_addr;
+    }
+  }
+
+  /**
+   * @brief Returns start of the allocated buffer from a block previously returned from \c align_block
+   */
+  static std::uint8_t* unalign_block(std::uint8_t* const block_addr)
+  {
+    if constexpr (is_over_aligned)
+    {
+      std::size_t shift;
+      std::memcpy(&shift, block_addr - sizeof(std::size_t), sizeof(std::size_t));
+      return block_addr - shift;
+    }
+    else
+    {
+      return block_addr;
+    }
   }
 
   ByteAllocatorT byte_allocator_;
@@ -183,4 +510,35 @@ template <typename... ValueTs>
 using single_allocator_adapter =
   BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStrategy<std::allocator<std::uint8_t>>>;
 
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter for single-pass allocation with \c
+ * std::allocator<std::uint8_t>, where each field segment starts on a \c SegmentAlignment byte boundary
+ */
+template <std::size_t SegmentAlignment, typename... ValueTs>
+using aligned_single_allocator_adapter = BasicMultiAllocatorAdapter<
+  std::tuple<ValueTs...>,
+  SinglePassAllocationStrategy<std::allocator<std::uint8_t>, SegmentAlignment>>;
+
+namespace pmr
+{
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter with \c std::pmr::polymorphic_allocator
+ * for each provided type
+ */
+template <typename... ValueTs>
+using multi_allocator_adapter =
+  BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, std::tuple<std::pmr::polymorphic_allocator<ValueTs>...>>;
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter for single-pass allocation with \c
+ * std::pmr::polymorphic_allocator<std::uint8_t>
+ */
+template <typename... ValueTs>
+using single_allocator_adapter = BasicMultiAllocatorAdapter<
+  std::tuple<ValueTs...>,
+  SinglePassAllocationStrategy<std::pmr::polymorphic_allocator<std::uint8_t>>>;
+
+}  // namespace pmr
+
 }  // namespace mf
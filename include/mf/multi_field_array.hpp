@@ -13,17 +13,36 @@
 #include <utility>
 
 // MF
+#include <mf/capacity_increase_policy.hpp>
 #include <mf/multi_allocator_adapter.hpp>
 #include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
 #include <mf/support/placement_new.hpp>
 #include <mf/support/pointer_element_type.hpp>
 #include <mf/support/tuple_for_each.hpp>
+#include <mf/support/trivially_relocatable.hpp>
 #include <mf/support/tuple_select.hpp>
 #include <mf/support/view.hpp>
+#include <mf/thread_pool.hpp>
 
 namespace mf
 {
 
+/**
+ * @brief Tag type used to select constructors which default-initialize elements
+ *
+ *        Fields which are trivially default constructible are left uninitialized
+ */
+struct default_init_t
+{
+  explicit default_init_t() = default;
+};
+
+/**
+ * @copydoc default_init_t
+ */
+inline constexpr default_init_t default_init{};
+
 template <typename... Ts, typename AllocatorTs, typename CapacityIncreasePolicy>
 class BasicMultiFieldArray<
   std::tuple<Ts...>,
@@ -57,7 +76,7 @@ public:
 
   explicit BasicMultiFieldArray(std::size_t count) : allocator_adapter_{}, size_{count}, capacity_{count}
   {
-    BasicMultiFieldArray::allocate_and_construct(data_, count);
+    BasicMultiFieldArray::allocate_and_construct(nullptr, data_, count);
   }
 
   BasicMultiFieldArray(std::size_t count, const allocator_adapter_type& allocator_adapter) :
@@ -65,7 +84,37 @@ public:
       size_{count},
       capacity_{count}
   {
-    BasicMultiFieldArray::allocate_and_construct(data_, count);
+    BasicMultiFieldArray::allocate_and_construct(nullptr, data_, count);
+  }
+
+  /**
+   * @brief Creates \c count default-initialized elements
+   *
+   *        Fields which are trivially default constructible are left uninitialized, and must be assigned before
+   *        they are read
+   */
+  BasicMultiFieldArray([[maybe_unused]] default_init_t _, std::size_t count) :
+      allocator_adapter_{},
+      size_{count},
+      capacity_{count}
+  {
+    BasicMultiFieldArray::allocate(data_, count);
+    BasicMultiFieldArray::construct_default_init(data_, count);
+  }
+
+  /**
+   * @copydoc BasicMultiFieldArray(default_init_t, std::size_t)
+   */
+  BasicMultiFieldArray(
+    [[maybe_unused]] default_init_t _,
+    std::size_t count,
+    const allocator_adapter_type& allocator_adapter) :
+      allocator_adapter_{allocator_adapter},
+      size_{count},
+      capacity_{count}
+  {
+    BasicMultiFieldArray::allocate(data_, count);
+    BasicMultiFieldArray::construct_default_init(data_, count);
   }
 
   template <typename CTorArgTupleT>
@@ -74,7 +123,7 @@ public:
       size_{count},
       capacity_{count}
   {
-    BasicMultiFieldArray::allocate_and_construct(data_, count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+    BasicMultiFieldArray::allocate_and_construct(nullptr, data_, count, ctor_arg_tuple);
   }
 
   template <typename CTorArgTupleT>
@@ -86,11 +135,61 @@ public:
       size_{count},
       capacity_{count}
   {
-    BasicMultiFieldArray::allocate_and_construct(data_, count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+    BasicMultiFieldArray::allocate_and_construct(nullptr, data_, count, ctor_arg_tuple);
+  }
+
+  /**
+   * @brief Creates \c count elements, where construction is partitioned across threads in \c pool
+   *
+   *        Each thread also performs the first write to (and so places the pages of) the memory for the elements it
+   *        constructs
+   */
+  BasicMultiFieldArray(ThreadPool& pool, std::size_t count) : allocator_adapter_{}, size_{count}, capacity_{count}
+  {
+    BasicMultiFieldArray::allocate_and_construct(std::addressof(pool), data_, count);
+  }
+
+  /**
+   * @copydoc BasicMultiFieldArray(ThreadPool&, std::size_t)
+   */
+  BasicMultiFieldArray(ThreadPool& pool, std::size_t count, const allocator_adapter_type& allocator_adapter) :
+      allocator_adapter_{allocator_adapter},
+      size_{count},
+      capacity_{count}
+  {
+    BasicMultiFieldArray::allocate_and_construct(std::addressof(pool), data_, count);
+  }
+
+  /**
+   * @copydoc BasicMultiFieldArray(ThreadPool&, std::size_t)
+   */
+  template <typename CTorArgTupleT>
+  BasicMultiFieldArray(ThreadPool& pool, std::size_t count, CTorArgTupleT&& ctor_arg_tuple) :
+      allocator_adapter_{},
+      size_{count},
+      capacity_{count}
+  {
+    BasicMultiFieldArray::allocate_and_construct(std::addressof(pool), data_, count, ctor_arg_tuple);
+  }
+
+  /**
+   * @copydoc BasicMultiFieldArray(ThreadPool&, std::size_t)
+   */
+  template <typename CTorArgTupleT>
+  BasicMultiFieldArray(
+    ThreadPool& pool,
+    std::size_t count,
+    const allocator_adapter_type& allocator_adapter,
+    CTorArgTupleT&& ctor_arg_tuple) :
+      allocator_adapter_{allocator_adapter},
+      size_{count},
+      capacity_{count}
+  {
+    BasicMultiFieldArray::allocate_and_construct(std::addressof(pool), data_, count, ctor_arg_tuple);
   }
 
   BasicMultiFieldArray(const BasicMultiFieldArray& other) :
-      allocator_adapter_{other.allocator_adapter_},
+      allocator_adapter_{other.allocator_adapter_.select_on_container_copy_construction()},
       size_{other.size_},
       capacity_{other.capacity_}
   {
@@ -109,10 +208,10 @@ public:
         [s = size_](auto* dst_ptr, const auto* src_ptr) {
           using ElementType = pointer_element_t<decltype(dst_ptr)>;
 
-          // Call default constructor for non-fundamental types
-          if constexpr (std::is_fundamental_v<ElementType>)
+          // Copy bytes of trivially copyable types, call copy constructor for all others
+          if constexpr (std::is_trivially_copyable_v<ElementType>)
           {
-            std::memcpy(dst_ptr, src_ptr, sizeof(ElementType) * s);
+            std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * s);
           }
           else
           {
@@ -128,23 +227,25 @@ public:
     }
   }
 
+  /**
+   * @brief Moves elements of \c other into a new container
+   *
+   *        Buffers are taken from \c other, unless they are held within the allocator adapter of \c other, in which
+   *        case elements are moved one-by-one into memory allocated by the new container's adapter
+   */
   BasicMultiFieldArray(BasicMultiFieldArray&& other) :
       allocator_adapter_{std::move(other.allocator_adapter_)},
       size_{other.size_},
       capacity_{other.capacity_}
   {
-    // "Steal" data pointer from "other"
-    tuple_for_each(
-      [](auto& dst_ptr, auto& src_ptr) {
-        dst_ptr = src_ptr;
-        src_ptr = nullptr;
-      },
-      data_,
-      other.data_);
-
-    // Set "other" to a fully-reset state
-    other.size_ = 0UL;
-    other.capacity_ = 0UL;
+    if (BasicMultiFieldArray::is_inline(other))
+    {
+      BasicMultiFieldArray::allocate(data_, capacity_);
+      BasicMultiFieldArray::move_construct(other.data_, size_);
+      other.clear();
+      return;
+    }
+    BasicMultiFieldArray::steal(other);
   }
 
   ~BasicMultiFieldArray()
@@ -162,8 +263,29 @@ public:
     BasicMultiFieldArray::deallocate(data_, capacity_);
   }
 
+  /**
+   * @brief Copies elements of \c other into this container
+   *
+   *        The allocator adapter of \c other replaces this container's adapter if
+   *        \c allocator_adapter_type::propagate_on_container_copy_assignment is true
+   */
   BasicMultiFieldArray& operator=(const BasicMultiFieldArray& other)
   {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    if constexpr (allocator_adapter_type::propagate_on_container_copy_assignment::value)
+    {
+      // Memory allocated by the current adapter must be released before it is replaced
+      if (allocator_adapter_ != other.allocator_adapter_)
+      {
+        BasicMultiFieldArray::release();
+      }
+      allocator_adapter_ = other.allocator_adapter_;
+    }
+
     BasicMultiFieldArray::resize(other.size());
     tuple_for_each(
       [s = other.size()](auto* const dst_ptr, auto* const src_ptr) { std::copy(src_ptr, src_ptr + s, dst_ptr); },
@@ -172,19 +294,76 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Moves elements of \c other into this container
+   *
+   *        Buffers are taken from \c other if \c allocator_adapter_type::propagate_on_container_move_assignment is
+   *        true, or if both allocator adapters are equal, unless they are held within the allocator adapter of
+   *        \c other. Otherwise, elements are moved one-by-one into memory allocated by this container's adapter.
+   */
   BasicMultiFieldArray& operator=(BasicMultiFieldArray&& other)
   {
-    new (this) BasicMultiFieldArray{std::move(other)};
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    if (BasicMultiFieldArray::is_inline(other))
+    {
+      BasicMultiFieldArray::clear();
+      BasicMultiFieldArray::reserve(other.size_);
+      BasicMultiFieldArray::move_construct(other.data_, other.size_);
+      size_ = other.size_;
+      other.clear();
+    }
+    else if constexpr (allocator_adapter_type::propagate_on_container_move_assignment::value)
+    {
+      BasicMultiFieldArray::release();
+      allocator_adapter_ = std::move(other.allocator_adapter_);
+      BasicMultiFieldArray::steal(other);
+    }
+    else if (allocator_adapter_type::is_always_equal::value or allocator_adapter_ == other.allocator_adapter_)
+    {
+      BasicMultiFieldArray::release();
+      BasicMultiFieldArray::steal(other);
+    }
+    else
+    {
+      BasicMultiFieldArray::clear();
+      BasicMultiFieldArray::reserve(other.size_);
+      BasicMultiFieldArray::move_construct(other.data_, other.size_);
+      size_ = other.size_;
+      other.clear();
+    }
     return *this;
   }
 
   /**
    * @brief Exchanges the contents of the container with those of other
    *
-   *        Does not invoke any move, copy, or swap operations on individual elements
+   *        Does not invoke any move, copy, or swap operations on individual elements, unless either container holds
+   *        elements within its allocator adapter. Allocator adapters are exchanged if
+   *        \c allocator_adapter_type::propagate_on_container_swap is true; otherwise, both adapters must be equal.
    */
   inline void swap(BasicMultiFieldArray& other)
   {
+    // Elements held within an adapter cannot change owners, so must be moved
+    if (BasicMultiFieldArray::is_inline(*this) or BasicMultiFieldArray::is_inline(other))
+    {
+      BasicMultiFieldArray other_moved{std::move(other)};
+      other = std::move(*this);
+      *this = std::move(other_moved);
+      return;
+    }
+
+    if constexpr (allocator_adapter_type::propagate_on_container_swap::value)
+    {
+      std::swap(other.allocator_adapter_, this->allocator_adapter_);
+    }
+    else
+    {
+      MF_ASSERT(allocator_adapter_type::is_always_equal::value or allocator_adapter_ == other.allocator_adapter_);
+    }
     std::swap(other.data_, this->data_);
     std::swap(other.size_, this->size_);
     std::swap(other.capacity_, this->capacity_);
@@ -339,45 +518,58 @@ public:
         // End of new sequence
         auto* const end_array_ptr = dptr + size_;
 
-        // End of new sequence
-        auto* const end_new_array_ptr = dptr + new_size;
+        // Shift trailing elements as bytes, then construct inserted elements in the vacated region
+        if constexpr (is_trivially_relocatable_v<ElementType>)
+        {
+          relocate_bytes(end_insert_ptr, beg_insert_ptr, end_array_ptr - beg_insert_ptr);
 
-        // End of new elements to move
-        auto* const end_spill_over_ptr = std::max(end_array_ptr, end_insert_ptr);
+          for (auto* dst_ptr = beg_insert_ptr; dst_ptr != end_insert_ptr; ++dst_ptr)
+          {
+            new (dst_ptr) ElementType{copy_ctor_args};
+          }
+        }
+        else
+        {
+          // End of new sequence
+          auto* const end_new_array_ptr = dptr + new_size;
 
-        auto* dst_ptr = end_new_array_ptr;
-        auto* src_ptr = end_array_ptr;
+          // End of new elements to move
+          auto* const end_spill_over_ptr = std::max(end_array_ptr, end_insert_ptr);
 
-        // Move construct in-place into newly allocated regions
-        while (dst_ptr != end_spill_over_ptr)
-        {
-          --dst_ptr;
-          --src_ptr;
-          new (dst_ptr) ElementType{std::move(*src_ptr)};
-        }
+          auto* dst_ptr = end_new_array_ptr;
+          auto* src_ptr = end_array_ptr;
 
-        // Move elements beyond insertion region which have previously been constructed
-        while (dst_ptr != end_insert_ptr)
-        {
-          --dst_ptr;
-          --src_ptr;
-          (*dst_ptr) = std::move(*src_ptr);
-        }
+          // Move construct in-place into newly allocated regions
+          while (dst_ptr != end_spill_over_ptr)
+          {
+            --dst_ptr;
+            --src_ptr;
+            new (dst_ptr) ElementType{std::move(*src_ptr)};
+          }
+
+          // Move elements beyond insertion region which have previously been constructed
+          while (dst_ptr != end_insert_ptr)
+          {
+            --dst_ptr;
+            --src_ptr;
+            (*dst_ptr) = std::move(*src_ptr);
+          }
 
-        dst_ptr = end_insert_ptr;
+          dst_ptr = end_insert_ptr;
 
-        // Copy construct into newly allocated regions
-        while (dst_ptr > end_array_ptr)
-        {
-          --dst_ptr;
-          new (dst_ptr) ElementType{copy_ctor_args};
-        }
+          // Copy construct into newly allocated regions
+          while (dst_ptr > end_array_ptr)
+          {
+            --dst_ptr;
+            new (dst_ptr) ElementType{copy_ctor_args};
+          }
 
-        // Copy construct into previously constructed regions
-        while (dst_ptr != beg_insert_ptr)
-        {
-          --dst_ptr;
-          (*dst_ptr) = ElementType{copy_ctor_args};
+          // Copy construct into previously constructed regions
+          while (dst_ptr != beg_insert_ptr)
+          {
+            --dst_ptr;
+            (*dst_ptr) = ElementType{copy_ctor_args};
+          }
         }
       },
       data_,
@@ -399,7 +591,7 @@ public:
         using ElementType = pointer_element_t<decltype(dptr)>;
 
         // Destroy trailing element
-        if constexpr (!std::is_fundamental_v<ElementType>)
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
         {
           (dptr + size_ - 1)->~ElementType();
         }
@@ -432,13 +624,25 @@ public:
         // Location of the first element to be erased
         auto* const element_ptr = dptr + position_as_offset;
 
-        // Copy elements after erased element
-        std::move(element_ptr + 1, dptr + size_, element_ptr);
-
-        // Destroy trailing element
-        if constexpr (!std::is_fundamental_v<ElementType>)
+        // Destroy erased element and shift elements after it as bytes
+        if constexpr (is_trivially_relocatable_v<ElementType>)
         {
-          (dptr + size_ - 1)->~ElementType();
+          if constexpr (!std::is_trivially_destructible_v<ElementType>)
+          {
+            element_ptr->~ElementType();
+          }
+          relocate_bytes(element_ptr, element_ptr + 1, size_ - position_as_offset - 1);
+        }
+        else
+        {
+          // Copy elements after erased element
+          std::move(element_ptr + 1, dptr + size_, element_ptr);
+
+          // Destroy trailing element
+          if constexpr (!std::is_trivially_destructible_v<ElementType>)
+          {
+            (dptr + size_ - 1)->~ElementType();
+          }
         }
       },
       data_);
@@ -481,13 +685,25 @@ public:
         // Location of the first element to be erased
         auto* const element_ptr = dptr + first_as_offset;
 
-        // Copy elements after erased element
-        std::move(element_ptr + distance, dptr + size_, element_ptr);
-
-        // Destroy trailing elements
-        if constexpr (!std::is_fundamental_v<ElementType>)
+        // Destroy erased elements and shift elements after them as bytes
+        if constexpr (is_trivially_relocatable_v<ElementType>)
+        {
+          if constexpr (!std::is_trivially_destructible_v<ElementType>)
+          {
+            std::for_each(element_ptr, element_ptr + distance, [](auto& e) { e.~ElementType(); });
+          }
+          relocate_bytes(element_ptr, element_ptr + distance, size_ - last_as_offset);
+        }
+        else
         {
-          std::for_each(dptr + last_as_offset, dptr + size_, [](auto& e) { e.~ElementType(); });
+          // Copy elements after erased element
+          std::move(element_ptr + distance, dptr + size_, element_ptr);
+
+          // Destroy trailing elements
+          if constexpr (!std::is_trivially_destructible_v<ElementType>)
+          {
+            std::for_each(dptr + size_ - distance, dptr + size_, [](auto& e) { e.~ElementType(); });
+          }
         }
       },
       data_);
@@ -659,27 +875,45 @@ public:
     // Increase capacity if new capacity is larger than previous capacity
     else if (new_capacity > capacity_)
     {
-      // Pointers to new data
-      std::tuple<Ts*...> new_data;
-
-      // Allocate new memory and default construct
-      BasicMultiFieldArray::allocate(new_data, new_capacity);
-
-      // Move old data to new buffers
-      BasicMultiFieldArray::move_construct(new_data, size_);
-
-      // Destroy old elements
-      BasicMultiFieldArray::destroy(data_, size_);
+      BasicMultiFieldArray::reallocate(new_capacity);
+    }
+  }
 
-      // Deallocate old buffers
-      BasicMultiFieldArray::deallocate(data_, capacity_);
+  /**
+   * @brief Reduces capacity to \c new_capacity elements, keeping all elements
+   *
+   *        If \c new_capacity is smaller than \c capacity(), then array memory is reallocated to fit, and elements
+   *        are moved to the new memory (or kept in place, where the allocator adapter can shrink memory without
+   *        moving it, e.g. by returning tail pages to the system). Capacity is never reduced below \c size(). If
+   *        \c new_capacity is larger than or equal to \c capacity(), then capacity is unchanged.
+   */
+  void shrink_to(const std::size_t new_capacity)
+  {
+    const std::size_t trimmed_capacity = std::max(new_capacity, size_);
 
-      // Reassign buffers
-      data_ = new_data;
-      capacity_ = new_capacity;
+    // Do nothing if requested capacity is the greater than or equal to our previous capacity
+    if (trimmed_capacity >= capacity_)
+    {
+      return;
+    }
+    // Release all memory if there are no elements to keep
+    else if (trimmed_capacity == 0UL)
+    {
+      BasicMultiFieldArray::release();
+    }
+    else
+    {
+      BasicMultiFieldArray::reallocate(trimmed_capacity);
     }
   }
 
+  /**
+   * @brief Reduces capacity to \c size(), keeping all elements
+   *
+   * @see shrink_to
+   */
+  void shrink_to_fit() { BasicMultiFieldArray::shrink_to(size_); }
+
   /**
    * @brief Resizes each field array to the given size, \c new_size
    *
@@ -708,56 +942,53 @@ public:
   template <typename... CTorArgTupleT> void resize(const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
   {
     static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+    BasicMultiFieldArray::resize_on(nullptr, new_size, ctor_arg_tuple...);
+  }
 
-    // Do nothing if requested size is the same as our previous size
-    if (new_size == size_)
+  /**
+   * @copydoc resize
+   *
+   * @note construction and destruction of elements are partitioned across threads in \c pool
+   */
+  template <typename... CTorArgTupleT>
+  void resize(ThreadPool& pool, const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+    BasicMultiFieldArray::resize_on(std::addressof(pool), new_size, ctor_arg_tuple...);
+  }
+
+  /**
+   * @brief Resizes each field array to the given size, \c new_size, default-initializing new elements
+   *
+   *        Behaves like \c resize, except that new elements of fields which are trivially default constructible
+   *        are left uninitialized. This avoids writing memory twice when all new elements will be assigned
+   *        immediately afterwards, e.g. when loading from a file:
+   * \n
+   *        @code{.cpp}
+   *        multi_field_array<float, int, std::string> array;
+   *        array.resize_default_init(n);
+   *        std::memcpy(array.data<float>(), float_buffer, sizeof(float) * n);
+   *        @endcode
+   */
+  void resize_default_init(const std::size_t new_size)
+  {
+    // Destroy trailing elements if new size is not larger than previous size
+    if (new_size <= size_)
     {
+      BasicMultiFieldArray::resize(new_size);
       return;
     }
     // Increase capacity if new size is larger than previous capacity
-    else if (new_size >= capacity_)
+    else if (new_size > capacity_)
     {
-      // Pointers to new data
-      std::tuple<Ts*...> new_data;
-
-      // Allocate new memory and default construct
-      BasicMultiFieldArray::allocate(new_data, new_size);
-
-      // Move old elements to new buffer
-      BasicMultiFieldArray::move_construct(new_data, size_);
-
-      // Construct new elements at the end of the buffer
-      {
-        auto start_p = new_data;
-        tuple_for_each([offset = size_](auto& ptr) { ptr += offset; }, start_p);
-        BasicMultiFieldArray::construct(start_p, new_size - size_, std::forward<CTorArgTupleT>(ctor_arg_tuple)...);
-      }
-
-      // Destroy old elements
-      BasicMultiFieldArray::destroy(data_, size_);
-
-      // Deallocate old buffers
-      BasicMultiFieldArray::deallocate(data_, capacity_);
-
-      // Reassign buffers
-      data_ = new_data;
-      capacity_ = new_size;
-    }
-    // Destroy trailing elements if new size is smaller than previous size
-    else if (new_size < size_)
-    {
-      auto start_p = data_;
-      tuple_for_each([offset = new_size](auto& ptr) { ptr += offset; }, start_p);
-      BasicMultiFieldArray::destroy(start_p, size_ - new_size);
-    }
-    // Default-construct trailing elements if new size is larger than previous size
-    else  // (new_size > size_)
-    {
-      auto start_p = data_;
-      tuple_for_each([offset = size_](auto& ptr) { ptr += offset; }, start_p);
-      BasicMultiFieldArray::construct(start_p, new_size - size_, std::forward<CTorArgTupleT>(ctor_arg_tuple)...);
+      BasicMultiFieldArray::reallocate(new_size);
     }
 
+    // Default-initialize trailing elements
+    auto start_p = data_;
+    tuple_for_each([offset = size_](auto& ptr) { ptr += offset; }, start_p);
+    BasicMultiFieldArray::construct_default_init(start_p, new_size - size_);
+
     // Set new size
     size_ = new_size;
   }
@@ -782,6 +1013,17 @@ public:
     size_ = 0UL;
   }
 
+  /**
+   * @copydoc clear
+   *
+   * @note destruction of elements is partitioned across threads in \c pool
+   */
+  inline void clear(ThreadPool& pool)
+  {
+    BasicMultiFieldArray::destroy_range(std::addressof(pool), 0UL, size_);
+    size_ = 0UL;
+  }
+
   /**
    * @brief Clears all elements, setting effective size to 0 and deallocates all memory
    *
@@ -792,6 +1034,12 @@ public:
     // Clear all elements
     BasicMultiFieldArray::clear();
 
+    // Don't deallocate if capacity is zero
+    if (capacity_ == 0UL)
+    {
+      return;
+    }
+
     // Deallocate old buffers
     BasicMultiFieldArray::deallocate(data_, capacity_);
     capacity_ = 0UL;
@@ -1193,16 +1441,59 @@ private:
     buffers = allocator_adapter_.allocate(capacity);
   };
 
+  /**
+   * @brief Allocates memory to \c buffers, which is filled with zero bytes if the allocator adapter supports it
+   *
+   * @retval true  if memory is filled with zero bytes
+   */
+  inline bool allocate_maybe_zeroed(std::tuple<Ts*...>& buffers, const std::size_t capacity)
+  {
+    if constexpr (allocator_adapter_type::supports_allocate_zeroed)
+    {
+      buffers = allocator_adapter_.allocate_zeroed(capacity);
+      return true;
+    }
+    else
+    {
+      buffers = allocator_adapter_.allocate(capacity);
+      return false;
+    }
+  };
+
+  /**
+   * @brief Returns true if every byte of \c value is zero
+   */
+  template <typename ValueT> static bool is_zero_filled(const ValueT& value)
+  {
+    static_assert(std::is_trivially_copyable_v<ValueT>, "ValueT must be trivially copyable");
+    const auto* const bytes = reinterpret_cast<const unsigned char*>(std::addressof(value));
+    return std::all_of(bytes, bytes + sizeof(ValueT), [](const unsigned char byte) { return byte == 0; });
+  }
+
   /**
    * @brief Invokes default constructor on \n n element in \c buffers
+   *
+   *        If \c zeroed is true, then \c buffers are known to be filled with zero bytes, and elements which would be
+   *        zero-initialized are not written
    */
-  inline void construct(std::tuple<Ts*...>& buffers, const std::size_t n)
+  inline void construct(std::tuple<Ts*...>& buffers, const std::size_t n, const bool zeroed)
   {
     // Default construct new elements
     tuple_for_each(
-      [n](auto& ptr) {
+      [n, zeroed](auto& ptr) {
         using ElementType = pointer_element_t<decltype(ptr)>;
 
+        // Value-initialization of arithmetic, enum and (non-member) pointer types writes zeros; null member pointers
+        // are not zero bytes on all ABIs, and other trivial types may hold them
+        if constexpr (
+          std::is_arithmetic_v<ElementType> or std::is_enum_v<ElementType> or std::is_pointer_v<ElementType>)
+        {
+          if (zeroed)
+          {
+            return;
+          }
+        }
+
         // Call default constructor for non-fundamental types
         if constexpr (!std::is_fundamental_v<ElementType>)
         {
@@ -1212,17 +1503,60 @@ private:
       buffers);
   };
 
+  /**
+   * @brief Default-initializes \n n element in \c buffers
+   *
+   *        Elements of trivially default constructible types are left uninitialized
+   */
+  inline void construct_default_init(std::tuple<Ts*...>& buffers, const std::size_t n)
+  {
+    tuple_for_each(
+      [n](auto& ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        // Call default constructor only for types where it has an effect
+        if constexpr (!std::is_trivially_default_constructible_v<ElementType>)
+        {
+          std::for_each(ptr, ptr + n, [](auto& element) { new (std::addressof(element)) ElementType; });
+        }
+      },
+      buffers);
+  };
+
   /**
    * @brief Invokes copy constructor on \n n element in \c buffers
+   *
+   *        If \c zeroed is true, then \c buffers are known to be filled with zero bytes, and elements of trivially
+   *        copyable types which would be copied from a value with all zero bytes are not written
    */
   template <typename CTorArgTupleT>
-  inline void construct(std::tuple<Ts*...>& buffers, const std::size_t n, CTorArgTupleT&& ctor_arg_tuple)
+  inline void
+  construct(std::tuple<Ts*...>& buffers, const std::size_t n, const bool zeroed, CTorArgTupleT&& ctor_arg_tuple)
   {
     // Value construct new elements
     tuple_for_each(
-      [n](auto& ptr, const auto& other) {
+      [n, zeroed](auto& ptr, const auto& other) {
         using ElementType = pointer_element_t<decltype(ptr)>;
 
+        // Skip writing values whose bytes are already in place; probe values are built as they are constructed below
+        if constexpr (allocator_adapter_type::supports_allocate_zeroed and std::is_trivially_copyable_v<ElementType>)
+        {
+          if (zeroed)
+          {
+            if constexpr (std::is_fundamental_v<ElementType>)
+            {
+              if (BasicMultiFieldArray::is_zero_filled(static_cast<ElementType>(other)))
+              {
+                return;
+              }
+            }
+            else if (BasicMultiFieldArray::is_zero_filled(ElementType{other}))
+            {
+              return;
+            }
+          }
+        }
+
         // Call default constructor for non-fundamental types
         if constexpr (std::is_fundamental_v<ElementType>)
         {
@@ -1238,29 +1572,128 @@ private:
   };
 
   /**
-   * @brief Allocates memory to \c buffers and constructs those values
+   * @brief Allocates memory to \c buffers and constructs those values, on threads in \c pool, if provided
    */
-  inline void allocate_and_construct(std::tuple<Ts*...>& buffers, const std::size_t n)
+  template <typename... CTorArgTupleT>
+  inline void allocate_and_construct(
+    ThreadPool* const pool,
+    std::tuple<Ts*...>& buffers,
+    const std::size_t n,
+    const CTorArgTupleT&... ctor_arg_tuple)
   {
-    // Allocate new memory with specified capacity
-    BasicMultiFieldArray::allocate(buffers, n);
-
-    // Default construct new elements
-    BasicMultiFieldArray::construct(buffers, n);
+    // Allocate new (possibly zero-filled) memory with specified capacity
+    const bool zeroed = BasicMultiFieldArray::allocate_maybe_zeroed(buffers, n);
+
+    // Construct new elements
+    const auto construct_fn = [&](const std::size_t first, const std::size_t last) {
+      auto first_p = buffers;
+      tuple_for_each([first](auto& ptr) { ptr += first; }, first_p);
+      BasicMultiFieldArray::construct(first_p, last - first, zeroed, ctor_arg_tuple...);
+    };
+    BasicMultiFieldArray::for_each_range(pool, 0UL, n, construct_fn);
   };
 
   /**
-   * @brief Allocates memory to \c buffers and constructs those values
+   * @brief Calls <code>range_fn(first, last)</code> on <code>[first_index, last_index)</code>, partitioned across
+   *        threads in \c pool if provided, or on the calling thread otherwise
    */
-  template <typename CTorArgTupleT>
-  inline void allocate_and_construct(std::tuple<Ts*...>& buffers, const std::size_t n, CTorArgTupleT&& ctor_arg_tuple)
+  template <typename RangeFnT>
+  static void for_each_range(
+    ThreadPool* const pool,
+    const std::size_t first_index,
+    const std::size_t last_index,
+    RangeFnT&& range_fn)
   {
-    // Allocate new memory with specified capacity
-    BasicMultiFieldArray::allocate(buffers, n);
+    if (pool == nullptr)
+    {
+      range_fn(first_index, last_index);
+      return;
+    }
 
-    // Value construct new elements
-    BasicMultiFieldArray::construct(buffers, n, std::forward<CTorArgTupleT>(ctor_arg_tuple));
-  };
+    const auto offset_range_fn = [first_index, &range_fn](const std::size_t first, const std::size_t last) {
+      range_fn(first_index + first, first_index + last);
+    };
+    pool->parallel_for(last_index - first_index, offset_range_fn);
+  }
+
+  /**
+   * @brief Constructs elements in <code>[first_index, last_index)</code> of current buffers, on threads in \c pool,
+   *        if provided
+   */
+  template <typename... CTorArgTupleT>
+  inline void construct_range(
+    ThreadPool* const pool,
+    const std::size_t first_index,
+    const std::size_t last_index,
+    const bool zeroed,
+    const CTorArgTupleT&... ctor_arg_tuple)
+  {
+    const auto construct_fn = [&](const std::size_t first, const std::size_t last) {
+      auto first_p = data_;
+      tuple_for_each([first](auto& ptr) { ptr += first; }, first_p);
+      BasicMultiFieldArray::construct(first_p, last - first, zeroed, ctor_arg_tuple...);
+    };
+    BasicMultiFieldArray::for_each_range(pool, first_index, last_index, construct_fn);
+  }
+
+  /**
+   * @brief Destroys elements in <code>[first_index, last_index)</code> of current buffers, on threads in \c pool,
+   *        if provided
+   */
+  inline void destroy_range(ThreadPool* const pool, const std::size_t first_index, const std::size_t last_index)
+  {
+    const auto destroy_fn = [this](const std::size_t first, const std::size_t last) {
+      auto first_p = data_;
+      tuple_for_each([first](auto& ptr) { ptr += first; }, first_p);
+      BasicMultiFieldArray::destroy(first_p, last - first);
+    };
+    BasicMultiFieldArray::for_each_range(pool, first_index, last_index, destroy_fn);
+  }
+
+  /**
+   * @brief Implements \c resize, where elements are constructed and destroyed on threads in \c pool, if provided
+   */
+  template <typename... CTorArgTupleT>
+  inline void resize_on(ThreadPool* const pool, const std::size_t new_size, const CTorArgTupleT&... ctor_arg_tuple)
+  {
+    // Do nothing if requested size is the same as our previous size
+    if (new_size == size_)
+    {
+      return;
+    }
+    // Replace buffers if new size is larger than previous capacity, and there are no elements to keep
+    else if (new_size > capacity_ and size_ == 0UL)
+    {
+      BasicMultiFieldArray::release();
+
+      // Allocate new (possibly zero-filled) memory and construct new elements
+      const bool zeroed = BasicMultiFieldArray::allocate_maybe_zeroed(data_, new_size);
+      capacity_ = new_size;
+      BasicMultiFieldArray::construct_range(pool, 0UL, new_size, zeroed, ctor_arg_tuple...);
+    }
+    // Increase capacity if new size is larger than previous capacity
+    else if (new_size > capacity_)
+    {
+      // Move old elements to new buffers
+      BasicMultiFieldArray::reallocate(new_size);
+
+      // Construct new elements at the end of the buffer
+      BasicMultiFieldArray::construct_range(pool, size_, new_size, false, ctor_arg_tuple...);
+    }
+    // Destroy trailing elements if new size is smaller than previous size
+    else if (new_size < size_)
+    {
+      BasicMultiFieldArray::destroy_range(pool, new_size, size_);
+    }
+    // Default-construct trailing elements if new size is larger than previous size
+    else  // (new_size > size_)
+    {
+      BasicMultiFieldArray::construct_range(pool, size_, new_size, false, ctor_arg_tuple...);
+    }
+
+    // Set new size
+    size_ = new_size;
+  }
 
   /**
    * @brief Deallocates memory from \c buffers
@@ -1272,17 +1705,20 @@ private:
   };
 
   /**
-   * @brief Moves-constructor elements to \c buffers
+   * @brief Moves \c n elements from current buffers to \c buffers, ending the lifetimes of the originals
+   *
+   *        Trivially relocatable elements are moved as bytes, without calling any constructors or destructors.
+   *        All other elements are move-constructed into \c buffers then destroyed.
    */
-  inline void move_construct(std::tuple<Ts*...>& buffers, const std::size_t n)
+  inline void relocate(std::tuple<Ts*...>& buffers, const std::size_t n)
   {
     tuple_for_each(
       [n](auto* dst_ptr, auto* src_ptr) {
         using ElementType = pointer_element_t<decltype(dst_ptr)>;
 
-        if constexpr (std::is_fundamental_v<ElementType>)
+        if constexpr (is_trivially_relocatable_v<ElementType>)
         {
-          std::memcpy(dst_ptr, src_ptr, sizeof(ElementType) * n);
+          relocate_bytes(dst_ptr, src_ptr, n);
         }
         else
         {
@@ -1290,6 +1726,7 @@ private:
           while (src_ptr != last_src_ptr)
           {
             new (dst_ptr) ElementType{std::move(*src_ptr)};
+            src_ptr->~ElementType();
             ++src_ptr;
             ++dst_ptr;
           }
@@ -1299,6 +1736,76 @@ private:
       data_);
   }
 
+  /**
+   * @brief Move-constructs the first \c n elements of current buffers from elements in \c buffers
+   *
+   *        Trivially copyable elements are copied as bytes. Elements in \c buffers are left in a moved-from state.
+   */
+  inline void move_construct(std::tuple<Ts*...>& buffers, const std::size_t n)
+  {
+    tuple_for_each(
+      [n](auto* dst_ptr, auto* src_ptr) {
+        using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+        if constexpr (std::is_trivially_copyable_v<ElementType>)
+        {
+          if (n != 0UL)
+          {
+            std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * n);
+          }
+        }
+        else
+        {
+          auto* const dst_last_ptr = dst_ptr + n;
+          for (; dst_ptr != dst_last_ptr; ++dst_ptr, ++src_ptr)
+          {
+            new (dst_ptr) ElementType{std::move(*src_ptr)};
+          }
+        }
+      },
+      data_,
+      buffers);
+  }
+
+  /**
+   * @brief Returns true if the buffers of \c array are held within its allocator adapter
+   */
+  static bool is_inline([[maybe_unused]] const BasicMultiFieldArray& array)
+  {
+    if constexpr (allocator_adapter_type::has_inline_storage)
+    {
+      return array.allocator_adapter_.is_inline(array.data_);
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Takes ownership of buffers held by \c other, leaving \c other with no elements or capacity
+   *
+   *        Current buffers must already be released
+   */
+  inline void steal(BasicMultiFieldArray& other)
+  {
+    // "Steal" data pointer from "other"
+    tuple_for_each(
+      [](auto& dst_ptr, auto& src_ptr) {
+        dst_ptr = src_ptr;
+        src_ptr = nullptr;
+      },
+      data_,
+      other.data_);
+
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+
+    // Set "other" to a fully-reset state
+    other.size_ = 0UL;
+    other.capacity_ = 0UL;
+  }
+
   /**
    * @brief Calls destructor on elements from \c buffers
    */
@@ -1308,7 +1815,7 @@ private:
       [n](auto& ptr) {
         using ElementType = pointer_element_t<decltype(ptr)>;
 
-        if constexpr (!std::is_fundamental<ElementType>())
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
         {
           std::for_each(ptr, ptr + n, [](auto& element) { element.~ElementType(); });
         }
@@ -1327,25 +1834,54 @@ private:
       return;
     }
 
-    const std::size_t new_capacity = CapacityIncreasePolicy::next_capacity(size_ + count);
+    // Bytes occupied by a single element across all fields
+    static constexpr std::size_t element_bytes = (sizeof(Ts) + ...);
 
-    // Pointers to new data
-    std::tuple<Ts*...> new_data;
+    BasicMultiFieldArray::reallocate(::mf::next_capacity<CapacityIncreasePolicy>(size_ + count, element_bytes));
+  }
 
-    // Allocate new memory with increase capacity
-    BasicMultiFieldArray::allocate(new_data, new_capacity);
+  /**
+   * @brief Moves all elements to buffers with capacity for \c new_capacity elements
+   *
+   *        When the allocator adapter supports it, buffers are first resized in place with
+   *        \c allocator_adapter_type::resize_in_place, in which case no elements are moved. When all fields are
+   *        trivially relocatable and the allocator adapter supports it, buffers are resized with
+   *        \c allocator_adapter_type::reallocate, which may extend them in place. Otherwise, new buffers are
+   *        allocated, elements are relocated into them, and old buffers are deallocated.
+   */
+  inline void reallocate(const std::size_t new_capacity)
+  {
+    if constexpr (allocator_adapter_type::supports_resize_in_place)
+    {
+      if (allocator_adapter_.resize_in_place(data_, capacity_, new_capacity))
+      {
+        capacity_ = new_capacity;
+        return;
+      }
+    }
 
-    // Move old elements to new buffer
-    BasicMultiFieldArray::move_construct(new_data, size_);
+    if constexpr (allocator_adapter_type::supports_reallocate and (is_trivially_relocatable_v<Ts> and ...))
+    {
+      data_ = allocator_adapter_.reallocate(data_, size_, capacity_, new_capacity);
+    }
+    else
+    {
+      // Pointers to new data
+      std::tuple<Ts*...> new_data;
 
-    // Destroy old elements
-    BasicMultiFieldArray::destroy(data_, size_);
+      // Allocate new memory with new capacity
+      BasicMultiFieldArray::allocate(new_data, new_capacity);
 
-    // Deallocate old buffers
-    BasicMultiFieldArray::deallocate(data_, capacity_);
+      // Move old elements to new buffer
+      BasicMultiFieldArray::relocate(new_data, size_);
+
+      // Deallocate old buffers
+      BasicMultiFieldArray::deallocate(data_, capacity_);
+
+      // Reassign buffers
+      data_ = new_data;
+    }
 
-    // Reassign buffers
-    data_ = new_data;
     capacity_ = new_capacity;
   }
 
@@ -1362,14 +1898,6 @@ private:
   std::size_t capacity_;
 };
 
-/**
- * @brief Specifies a default capacity-growing policy through the method \c next_capacity
- */
-struct DefaultCapacityIncreasePolicy
-{
-  static constexpr std::size_t next_capacity(std::size_t prev_capacity) { return 2 * prev_capacity + 2; };
-};
-
 /// Selects which allocator-adaptation strategy to use by default. If left unspecified, then
 /// a single-pass allocation/de-allocation strategy is used, since it will be more efficient
 /// in most cases.
@@ -1390,4 +1918,28 @@ template <typename... FieldTs>
 using multi_field_array =
   BasicMultiFieldArray<std::tuple<FieldTs...>, default_allocator_adapter<FieldTs...>, DefaultCapacityIncreasePolicy>;
 
+namespace pmr
+{
+
+#ifdef MF_DEFAULT_TO_PER_FIELD_ALLOCATION
+
+template <typename... FieldTs> using default_allocator_adapter = pmr::multi_allocator_adapter<FieldTs...>;
+
+#else
+
+template <typename... FieldTs> using default_allocator_adapter = pmr::single_allocator_adapter<FieldTs...>;
+
+#endif  // MF_DEFAULT_TO_PER_FIELD_ALLOCATION
+
+/**
+ * @brief Convenience alias which allocates from a \c std::pmr::memory_resource selected at runtime
+ */
+template <typename... FieldTs>
+using multi_field_array = BasicMultiFieldArray<
+  std::tuple<FieldTs...>,
+  pmr::default_allocator_adapter<FieldTs...>,
+  DefaultCapacityIncreasePolicy>;
+
+}  // namespace pmr
+
 }  // namespace mf
@@ -4,11 +4,23 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <cstddef>
+
 namespace mf
 {
 
 template <typename FieldTs> class View;
 template <typename FieldTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy> class BasicMultiFieldArray;
 template <typename ValueTs, typename AllocatorTs> class BasicMultiAllocatorAdapter;
+template <typename FieldTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy, typename SizeT>
+class BasicCompactMultiFieldArray;
+template <typename FieldTs, std::size_t Capacity> class BasicStaticMultiFieldArray;
+template <typename FieldTs, typename AllocatorAdapterT, std::size_t ChunkSize> class BasicSegmentedMultiFieldArray;
+template <typename FieldTs, std::size_t TileSize, typename ByteAllocatorT, typename CapacityIncreasePolicy>
+class BasicTiledMultiFieldArray;
+template <typename FieldOrGroupTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy>
+class BasicGroupedMultiFieldArray;
+template <typename FieldTs, typename AllocatorT, typename CapacityIncreasePolicy> class BasicPackedMultiFieldArray;
 
 }  // namespace mf
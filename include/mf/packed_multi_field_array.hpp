@@ -0,0 +1,972 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/bit_vector.hpp>
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/tuple_for_each.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Tag used to declare a field which may not hold a value for every element
+ *
+ *        Used as a field of \c BasicPackedMultiFieldArray, like so:
+ * \n
+ *        @code{.cpp}
+ *        packed_multi_field_array<bool, nullable<Sword>, nullable<Shield>> entities;
+ *        @endcode
+ */
+template <typename T> struct nullable
+{};
+
+/**
+ * @brief Column of values which may be absent, stored densely, with presence tracked by a separate bitmap
+ *
+ *        Unlike a column of \c std::optional<T>, no flag or padding is stored alongside each value. Storage for an
+ *        absent value is left uninitialized.
+ *
+ * @tparam AllocatorT  allocator type; rebound to allocate values and presence words
+ */
+template <typename T, typename AllocatorT> class NullableColumn
+{
+public:
+  /// Allocator type used to allocate values
+  using allocator_type = typename std::allocator_traits<AllocatorT>::template rebind_alloc<T>;
+
+  /// Bitmap type used to track which values are present
+  using presence_type = BasicBitVector<AllocatorT>;
+
+  NullableColumn() = default;
+
+  /**
+   * @brief Copies present values of \c other into a new column with the same capacity
+   *
+   *        If allocation or copying a value throws, values copied so far are destroyed and storage is de-allocated
+   */
+  NullableColumn(const NullableColumn& other) :
+      allocator_{std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.allocator_)}
+  {
+    try
+    {
+      NullableColumn::reserve(other.capacity_);
+      presence_.resize(other.presence_.size());
+
+      // Presence bits are set as values are copied, so that only copied values are destroyed on failure
+      other.presence_.for_each_set([this, &other](const std::size_t pos) {
+        new (data_ + pos) T{other.data_[pos]};
+        presence_.set(pos);
+      });
+    }
+    catch (...)
+    {
+      NullableColumn::release();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Moves values of \c other into a new column, leaving \c other empty
+   */
+  NullableColumn(NullableColumn&& other) :
+      allocator_{std::move(other.allocator_)},
+      data_{std::exchange(other.data_, nullptr)},
+      capacity_{std::exchange(other.capacity_, 0UL)},
+      presence_{std::move(other.presence_)}
+  {}
+
+  ~NullableColumn() { NullableColumn::release(); }
+
+  NullableColumn& operator=(const NullableColumn& other)
+  {
+    NullableColumn copied{other};
+    NullableColumn::swap(copied);
+    return *this;
+  }
+
+  NullableColumn& operator=(NullableColumn&& other)
+  {
+    NullableColumn moved{std::move(other)};
+    NullableColumn::swap(moved);
+    return *this;
+  }
+
+  /**
+   * @brief Returns true if a value is present at \c pos
+   */
+  inline bool has(const std::size_t pos) const { return presence_.test(pos); }
+
+  /**
+   * @brief Returns the value at \c pos, which must be present
+   */
+  inline T& value(const std::size_t pos)
+  {
+    MF_ASSERT(NullableColumn::has(pos));
+    return data_[pos];
+  }
+
+  /**
+   * @copydoc value
+   */
+  inline const T& value(const std::size_t pos) const
+  {
+    MF_ASSERT(NullableColumn::has(pos));
+    return data_[pos];
+  }
+
+  /**
+   * @brief Constructs a value at \c pos from \c ctor_args, replacing any value which was present
+   */
+  template <typename... CTorArgTs> T& emplace(const std::size_t pos, CTorArgTs&&... ctor_args)
+  {
+    NullableColumn::reset(pos);
+    new (data_ + pos) T{std::forward<CTorArgTs>(ctor_args)...};
+    presence_.set(pos);
+    return data_[pos];
+  }
+
+  /**
+   * @brief Destroys the value at \c pos, if one is present
+   */
+  inline void reset(const std::size_t pos)
+  {
+    if (presence_.test(pos))
+    {
+      data_[pos].~T();
+      presence_.reset(pos);
+    }
+  }
+
+  /**
+   * @brief Adds an element at the end of the column, which holds a value constructed from \c ctor_args, if any
+   *
+   *        Column capacity must be large enough to hold the new element
+   */
+  template <typename... CTorArgTs> inline void emplace_back(CTorArgTs&&... ctor_args)
+  {
+    MF_ASSERT(presence_.size() < capacity_);
+    if constexpr (sizeof...(CTorArgTs) == 0)
+    {
+      presence_.push_back(false);
+    }
+    else
+    {
+      new (data_ + presence_.size()) T{std::forward<CTorArgTs>(ctor_args)...};
+      presence_.push_back(true);
+    }
+  }
+
+  /**
+   * @brief Removes the last element
+   */
+  inline void pop_back()
+  {
+    NullableColumn::reset(presence_.size() - 1UL);
+    presence_.pop_back();
+  }
+
+  /**
+   * @brief Resizes column to \c new_size elements; new elements hold no value
+   *
+   *        Column capacity must be large enough to hold \c new_size elements
+   */
+  inline void resize(const std::size_t new_size)
+  {
+    MF_ASSERT(new_size <= capacity_);
+    NullableColumn::destroy_from(new_size);
+    presence_.resize(new_size);
+  }
+
+  /**
+   * @brief Ensures that capacity is at least \c new_capacity elements
+   */
+  inline void reserve(const std::size_t new_capacity)
+  {
+    if (new_capacity > capacity_)
+    {
+      NullableColumn::reallocate(new_capacity);
+    }
+    presence_.reserve(new_capacity);
+  }
+
+  /**
+   * @brief Reduces capacity to the current number of elements
+   */
+  inline void shrink_to_fit()
+  {
+    if (capacity_ > presence_.size())
+    {
+      NullableColumn::reallocate(presence_.size());
+    }
+    presence_.shrink_to_fit();
+  }
+
+  /**
+   * @brief Removes all elements
+   */
+  inline void clear()
+  {
+    NullableColumn::destroy_from(0UL);
+    presence_.clear();
+  }
+
+  /**
+   * @brief Exchanges the contents of the column with those of other
+   */
+  inline void swap(NullableColumn& other)
+  {
+    std::swap(allocator_, other.allocator_);
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    presence_.swap(other.presence_);
+  }
+
+  /**
+   * @brief Returns the number of elements, whether or not they hold values
+   */
+  inline std::size_t size() const { return presence_.size(); }
+
+  /**
+   * @brief Returns the number of elements which can be held without re-allocating
+   */
+  inline std::size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Returns the bitmap in which each bit is set if a value is present in the corresponding element
+   */
+  inline const presence_type& presence() const { return presence_; }
+
+private:
+  /**
+   * @brief Destroys all values at or after \c first, leaving their presence bits unchanged
+   */
+  inline void destroy_from(const std::size_t first)
+  {
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+      const std::size_t last = presence_.size();
+      for (std::size_t pos = (first == 0UL) ? presence_.find_first() : presence_.find_next(first - 1UL); pos < last;
+           pos = presence_.find_next(pos))
+      {
+        data_[pos].~T();
+      }
+    }
+  }
+
+  /**
+   * @brief Moves present values into new storage which holds \c new_capacity elements
+   */
+  void reallocate(const std::size_t new_capacity)
+  {
+    T* const new_data =
+      (new_capacity == 0UL) ? nullptr : std::allocator_traits<allocator_type>::allocate(allocator_, new_capacity);
+    presence_.for_each_set([this, new_data](const std::size_t pos) {
+      new (new_data + pos) T{std::move(data_[pos])};
+      data_[pos].~T();
+    });
+    if (capacity_ != 0UL)
+    {
+      std::allocator_traits<allocator_type>::deallocate(allocator_, data_, capacity_);
+    }
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  /**
+   * @brief Destroys all values and deallocates storage
+   */
+  void release()
+  {
+    NullableColumn::destroy_from(0UL);
+    if (capacity_ != 0UL)
+    {
+      std::allocator_traits<allocator_type>::deallocate(allocator_, data_, capacity_);
+    }
+    data_ = nullptr;
+    capacity_ = 0UL;
+    presence_.clear();
+  }
+
+  /// Allocates storage for values
+  allocator_type allocator_;
+
+  /// Storage for one value per element
+  T* data_ = nullptr;
+
+  /// Number of elements which can be held in \c data_
+  std::size_t capacity_ = 0UL;
+
+  /// Set bits mark elements which hold a value
+  presence_type presence_;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Placeholder column for a field which is stored in a \c BasicMultiFieldArray, rather than packed
+ */
+struct UnpackedFieldColumn
+{
+  inline void pop_back() {}
+  inline void resize(const std::size_t) {}
+  inline void reserve(const std::size_t) {}
+  inline void shrink_to_fit() {}
+  inline void clear() {}
+};
+
+/**
+ * @brief Describes how a field of a \c BasicPackedMultiFieldArray is stored
+ */
+template <typename FieldT, typename AllocatorT> struct PackedFieldTraits
+{
+  /// Type of value accessed through the field
+  using value_type = FieldT;
+
+  /// Column type which holds the field, if it is packed
+  using column_type = UnpackedFieldColumn;
+
+  static constexpr bool is_bit_packed = false;
+  static constexpr bool is_nullable = false;
+};
+
+/**
+ * @copydoc PackedFieldTraits
+ */
+template <typename AllocatorT> struct PackedFieldTraits<bool, AllocatorT>
+{
+  /// Type of value accessed through the field
+  using value_type = bool;
+
+  /// Column type which holds the field, if it is packed
+  using column_type = BasicBitVector<AllocatorT>;
+
+  static constexpr bool is_bit_packed = true;
+  static constexpr bool is_nullable = false;
+};
+
+/**
+ * @copydoc PackedFieldTraits
+ */
+template <typename T, typename AllocatorT> struct PackedFieldTraits<nullable<T>, AllocatorT>
+{
+  /// Type of value accessed through the field
+  using value_type = T;
+
+  /// Column type which holds the field, if it is packed
+  using column_type = NullableColumn<T, AllocatorT>;
+
+  static constexpr bool is_bit_packed = false;
+  static constexpr bool is_nullable = true;
+};
+
+/**
+ * @brief Array type which holds fields which are not packed, or an empty tuple if there are none
+ */
+template <typename UnpackedFieldTs, typename AllocatorT, typename CapacityIncreasePolicy> struct UnpackedFieldStorage
+{
+  using type = BasicMultiFieldArray<
+    UnpackedFieldTs,
+    BasicMultiAllocatorAdapter<UnpackedFieldTs, SinglePassAllocationStrategy<AllocatorT>>,
+    CapacityIncreasePolicy>;
+};
+
+/**
+ * @copydoc UnpackedFieldStorage
+ */
+template <typename AllocatorT, typename CapacityIncreasePolicy>
+struct UnpackedFieldStorage<std::tuple<>, AllocatorT, CapacityIncreasePolicy>
+{
+  using type = std::tuple<>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Multi-field array in which \c bool fields are packed 64 to a word, and \c nullable fields keep values
+ *        densely, with presence tracked in a separate bitmap
+ *
+ *        All other fields are stored in a \c BasicMultiFieldArray. Fields are accessed by value type: \c get<bool>
+ *        returns a \c BitReference, and \c get<T> of a \c nullable<T> field returns the value, which must be present.
+ *        Bitmaps are available through \c bits and \c presence for word-at-a-time queries (see \c for_each_set).
+ *
+ * @tparam AllocatorT  byte allocator type; rebound to allocate each column
+ */
+template <typename... FieldTs, typename AllocatorT, typename CapacityIncreasePolicy>
+class BasicPackedMultiFieldArray<std::tuple<FieldTs...>, AllocatorT, CapacityIncreasePolicy>
+{
+  template <typename FieldT> using traits = detail::PackedFieldTraits<FieldT, AllocatorT>;
+
+public:
+  /// Tuple of value types accessed through each field
+  using value_type = std::tuple<typename traits<FieldTs>::value_type...>;
+
+  /// Tuple of fields which are not packed
+  using unpacked_field_types = decltype(std::tuple_cat(std::declval<std::conditional_t<
+                                                        traits<FieldTs>::is_bit_packed or traits<FieldTs>::is_nullable,
+                                                        std::tuple<>,
+                                                        std::tuple<FieldTs>>>()...));
+
+  /// Array which holds fields which are not packed
+  using unpacked_storage_type =
+    typename detail::UnpackedFieldStorage<unpacked_field_types, AllocatorT, CapacityIncreasePolicy>::type;
+
+  /**
+   * @brief Index of the field whose value type is \c ValueT
+   */
+  template <typename ValueT> static constexpr std::size_t field_index_of = [] {
+    constexpr std::array<bool, sizeof...(FieldTs)> is_value = {
+      std::is_same_v<ValueT, typename traits<FieldTs>::value_type>...};
+    std::size_t field_index = 0;
+    while (field_index < is_value.size() and !is_value[field_index])
+    {
+      ++field_index;
+    }
+    return field_index;
+  }();
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size and capacity to zero
+   */
+  BasicPackedMultiFieldArray() = default;
+
+  /**
+   * @brief Creates \c count elements; \c bool fields are cleared, \c nullable fields hold no value and all other
+   *        fields are constructed as by \c BasicMultiFieldArray::resize
+   */
+  explicit BasicPackedMultiFieldArray(const std::size_t count) { BasicPackedMultiFieldArray::resize(count); }
+
+  BasicPackedMultiFieldArray(const BasicPackedMultiFieldArray& other) = default;
+
+  /**
+   * @brief Moves elements of \c other into a new container, leaving \c other empty
+   */
+  BasicPackedMultiFieldArray(BasicPackedMultiFieldArray&& other) :
+      columns_{std::move(other.columns_)},
+      unpacked_{std::move(other.unpacked_)},
+      size_{std::exchange(other.size_, 0UL)},
+      capacity_{std::exchange(other.capacity_, 0UL)}
+  {}
+
+  BasicPackedMultiFieldArray& operator=(const BasicPackedMultiFieldArray& other)
+  {
+    BasicPackedMultiFieldArray copied{other};
+    BasicPackedMultiFieldArray::swap(copied);
+    return *this;
+  }
+
+  BasicPackedMultiFieldArray& operator=(BasicPackedMultiFieldArray&& other)
+  {
+    BasicPackedMultiFieldArray moved{std::move(other)};
+    BasicPackedMultiFieldArray::swap(moved);
+    return *this;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   */
+  inline void swap(BasicPackedMultiFieldArray& other)
+  {
+    std::swap(columns_, other.columns_);
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.swap(other.unpacked_);
+    }
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  /**
+   * @brief Returns references to values at index for each specified value type
+   *
+   *        Values of \c bool fields are returned as \c BitReference proxies; values of \c nullable fields must be
+   *        present
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      return BasicPackedMultiFieldArray::template field<ValueTs...>(index);
+    }
+    else
+    {
+      return std::tuple<decltype(BasicPackedMultiFieldArray::template field<ValueTs>(index))...>{
+        BasicPackedMultiFieldArray::template field<ValueTs>(index)...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version; values of \c bool fields are returned by value
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      return BasicPackedMultiFieldArray::template field<ValueTs...>(index);
+    }
+    else
+    {
+      return std::tuple<decltype(BasicPackedMultiFieldArray::template field<ValueTs>(index))...>{
+        BasicPackedMultiFieldArray::template field<ValueTs>(index)...};
+    }
+  }
+
+  /**
+   * @brief Returns true if element at \c index holds a value for each \c nullable field of the specified value types
+   */
+  template <typename... ValueTs> inline bool has(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+    return (BasicPackedMultiFieldArray::template nullable_column<ValueTs>().has(index) and ...);
+  }
+
+  /**
+   * @brief Constructs the value of the \c nullable field with value type \c ValueT at \c index, replacing any value
+   *        which was present
+   */
+  template <typename ValueT, typename... CTorArgTs>
+  inline ValueT& emplace(const std::size_t index, CTorArgTs&&... ctor_args)
+  {
+    MF_ASSERT(index < size_);
+    return BasicPackedMultiFieldArray::template nullable_column<ValueT>().emplace(
+      index, std::forward<CTorArgTs>(ctor_args)...);
+  }
+
+  /**
+   * @brief Destroys the value of the \c nullable field with value type \c ValueT at \c index, if one is present
+   */
+  template <typename ValueT> inline void reset(const std::size_t index)
+  {
+    MF_ASSERT(index < size_);
+    BasicPackedMultiFieldArray::template nullable_column<ValueT>().reset(index);
+  }
+
+  /**
+   * @brief Returns the bitmap which holds the \c bool field at \c FieldIndex
+   */
+  template <std::size_t FieldIndex> inline auto& bits()
+  {
+    static_assert(
+      traits<std::tuple_element_t<FieldIndex, std::tuple<FieldTs...>>>::is_bit_packed, "Field must be a bool field");
+    return std::get<FieldIndex>(columns_);
+  }
+
+  /**
+   * @copydoc bits
+   */
+  template <std::size_t FieldIndex> inline const auto& bits() const
+  {
+    static_assert(
+      traits<std::tuple_element_t<FieldIndex, std::tuple<FieldTs...>>>::is_bit_packed, "Field must be a bool field");
+    return std::get<FieldIndex>(columns_);
+  }
+
+  /**
+   * @brief Returns the bitmap which marks elements that hold a value for the \c nullable field with value type
+   *        \c ValueT
+   */
+  template <typename ValueT> inline const auto& presence() const
+  {
+    return BasicPackedMultiFieldArray::template nullable_column<ValueT>().presence();
+  }
+
+  /**
+   * @brief Calls \c callback with references to values of each specified field, for each element which holds a value
+   *        for every \c nullable field among them
+   *
+   *        Elements are found by combining presence bitmaps a word at a time; words without matching elements are
+   *        skipped
+   */
+  template <typename... ValueTs, typename CallbackT> void for_each_present(CallbackT&& callback)
+  {
+    static_assert(
+      (traits<std::tuple_element_t<field_index_of<ValueTs>, std::tuple<FieldTs...>>>::is_nullable or ...),
+      "At least one field must be nullable");
+    BasicPackedMultiFieldArray::for_each_present_of(
+      [this, &callback](const std::size_t index) {
+        callback(BasicPackedMultiFieldArray::template field<ValueTs>(index)...);
+      },
+      presence_columns<ValueTs...>());
+  }
+
+  /**
+   * @copydoc for_each_present
+   */
+  template <typename... ValueTs, typename CallbackT> void for_each_present(CallbackT&& callback) const
+  {
+    static_assert(
+      (traits<std::tuple_element_t<field_index_of<ValueTs>, std::tuple<FieldTs...>>>::is_nullable or ...),
+      "At least one field must be nullable");
+    BasicPackedMultiFieldArray::for_each_present_of(
+      [this, &callback](const std::size_t index) {
+        callback(BasicPackedMultiFieldArray::template field<ValueTs>(index)...);
+      },
+      presence_columns<ValueTs...>());
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more fields which are not packed
+   */
+  template <typename... ViewValueTs> inline auto view()
+  {
+    return unpacked_.template view<ViewValueTs...>();
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <typename... ViewValueTs> inline auto view() const
+  {
+    return unpacked_.template view<ViewValueTs...>();
+  }
+
+  /**
+   * @brief Creates a new element at the end of the container
+   *
+   *        Takes one argument per field, or none; \c std::nullopt leaves a \c nullable field without a value. With no
+   *        arguments, \c bool fields are cleared, \c nullable fields hold no value and all other fields are
+   *        value-initialized, as by \c BasicMultiFieldArray::emplace_back.
+   */
+  template <typename... FieldArgTs> void emplace_back(FieldArgTs&&... field_args)
+  {
+    static_assert(
+      (sizeof...(FieldArgTs) == sizeof...(FieldTs)) or (sizeof...(FieldArgTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+
+    if (size_ == capacity_)
+    {
+      // Policies are given the required capacity, and may return it unchanged
+      const std::size_t required_capacity = size_ + 1UL;
+      BasicPackedMultiFieldArray::reserve(
+        std::max(required_capacity, ::mf::next_capacity<CapacityIncreasePolicy>(required_capacity, element_bytes)));
+    }
+
+    if constexpr (sizeof...(FieldArgTs) == 0UL)
+    {
+      if constexpr (has_unpacked_fields)
+      {
+        unpacked_.emplace_back();
+      }
+      tuple_for_each(
+        [](auto& column) {
+          using ColumnT = std::decay_t<decltype(column)>;
+          if constexpr (std::is_same_v<ColumnT, BasicBitVector<AllocatorT>>)
+          {
+            column.push_back(false);
+          }
+          else if constexpr (!std::is_same_v<ColumnT, detail::UnpackedFieldColumn>)
+          {
+            column.emplace_back();
+          }
+        },
+        columns_);
+    }
+    else
+    {
+      BasicPackedMultiFieldArray::emplace_back_fields(
+        std::forward_as_tuple(std::forward<FieldArgTs>(field_args)...),
+        std::make_index_sequence<sizeof...(FieldTs)>{},
+        std::make_index_sequence<std::tuple_size_v<unpacked_field_types>>{});
+    }
+    ++size_;
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.pop_back();
+    }
+    tuple_for_each([](auto& column) { column.pop_back(); }, columns_);
+    --size_;
+  }
+
+  /**
+   * @brief Resizes container to the given size, \c new_size
+   *
+   *        New elements of \c bool fields are cleared, \c nullable fields hold no value and all other fields are
+   *        constructed as by \c BasicMultiFieldArray::resize
+   */
+  void resize(const std::size_t new_size)
+  {
+    BasicPackedMultiFieldArray::reserve(new_size);
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.resize(new_size);
+    }
+    tuple_for_each([new_size](auto& column) { column.resize(new_size); }, columns_);
+    size_ = new_size;
+  }
+
+  /**
+   * @brief Ensures that capacity is at least \c new_capacity elements
+   */
+  void reserve(const std::size_t new_capacity)
+  {
+    if (new_capacity <= capacity_)
+    {
+      return;
+    }
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.reserve(new_capacity);
+    }
+    tuple_for_each([new_capacity](auto& column) { column.reserve(new_capacity); }, columns_);
+    capacity_ = new_capacity;
+  }
+
+  /**
+   * @brief Reduces capacity to the current number of elements
+   */
+  void shrink_to_fit()
+  {
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.shrink_to_fit();
+    }
+    tuple_for_each([](auto& column) { column.shrink_to_fit(); }, columns_);
+    capacity_ = size_;
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0
+   */
+  void clear()
+  {
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.clear();
+    }
+    tuple_for_each([](auto& column) { column.clear(); }, columns_);
+    size_ = 0;
+  }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which the container can hold without re-allocating
+   */
+  inline std::size_t capacity() const { return capacity_; }
+
+private:
+  /// True if any field is stored in \c unpacked_
+  static constexpr bool has_unpacked_fields = std::tuple_size_v<unpacked_field_types> != 0;
+
+  /// Approximate number of bytes used by each element, across all fields, for capacity increase policies
+  static constexpr std::size_t element_bytes = std::max<std::size_t>(
+    1UL,
+    ((traits<FieldTs>::is_bit_packed ? 0UL : sizeof(typename traits<FieldTs>::value_type)) + ...));
+
+  /// Indices of fields which are not packed
+  static constexpr std::array<std::size_t, std::tuple_size_v<unpacked_field_types>> unpacked_field_indices = [] {
+    constexpr std::array<bool, sizeof...(FieldTs)> is_packed = {
+      (traits<FieldTs>::is_bit_packed or traits<FieldTs>::is_nullable)...};
+    std::array<std::size_t, std::tuple_size_v<unpacked_field_types>> indices{};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < is_packed.size(); ++i)
+    {
+      if (!is_packed[i])
+      {
+        indices[count++] = i;
+      }
+    }
+    return indices;
+  }();
+
+  /**
+   * @brief Returns a reference to the value of the field with value type \c ValueT at \c index
+   */
+  template <typename ValueT> inline decltype(auto) field(const std::size_t index)
+  {
+    static_assert(field_index_of<ValueT> < sizeof...(FieldTs), "ValueT is not a field of this container");
+    using FieldT = std::tuple_element_t<field_index_of<ValueT>, std::tuple<FieldTs...>>;
+    if constexpr (traits<FieldT>::is_bit_packed)
+    {
+      return std::get<field_index_of<ValueT>>(columns_)[index];
+    }
+    else if constexpr (traits<FieldT>::is_nullable)
+    {
+      return static_cast<ValueT&>(std::get<field_index_of<ValueT>>(columns_).value(index));
+    }
+    else
+    {
+      return static_cast<ValueT&>(unpacked_.template get<ValueT>(index));
+    }
+  }
+
+  /**
+   * @copydoc field
+   */
+  template <typename ValueT> inline decltype(auto) field(const std::size_t index) const
+  {
+    static_assert(field_index_of<ValueT> < sizeof...(FieldTs), "ValueT is not a field of this container");
+    using FieldT = std::tuple_element_t<field_index_of<ValueT>, std::tuple<FieldTs...>>;
+    if constexpr (traits<FieldT>::is_bit_packed)
+    {
+      return static_cast<bool>(std::get<field_index_of<ValueT>>(columns_)[index]);
+    }
+    else if constexpr (traits<FieldT>::is_nullable)
+    {
+      return static_cast<const ValueT&>(std::get<field_index_of<ValueT>>(columns_).value(index));
+    }
+    else
+    {
+      return static_cast<const ValueT&>(unpacked_.template get<ValueT>(index));
+    }
+  }
+
+  /**
+   * @brief Returns the column which holds the \c nullable field with value type \c ValueT
+   */
+  template <typename ValueT> inline auto& nullable_column()
+  {
+    static_assert(field_index_of<ValueT> < sizeof...(FieldTs), "ValueT is not a field of this container");
+    static_assert(
+      traits<std::tuple_element_t<field_index_of<ValueT>, std::tuple<FieldTs...>>>::is_nullable,
+      "ValueT must be the value type of a nullable field");
+    return std::get<field_index_of<ValueT>>(columns_);
+  }
+
+  /**
+   * @copydoc nullable_column
+   */
+  template <typename ValueT> inline const auto& nullable_column() const
+  {
+    static_assert(field_index_of<ValueT> < sizeof...(FieldTs), "ValueT is not a field of this container");
+    static_assert(
+      traits<std::tuple_element_t<field_index_of<ValueT>, std::tuple<FieldTs...>>>::is_nullable,
+      "ValueT must be the value type of a nullable field");
+    return std::get<field_index_of<ValueT>>(columns_);
+  }
+
+  /**
+   * @brief Returns a tuple of presence bitmaps for each \c nullable field among \c ValueTs
+   */
+  template <typename... ValueTs> inline auto presence_columns() const
+  {
+    return std::tuple_cat([this](auto* value_ptr) {
+      using ValueT = std::remove_pointer_t<decltype(value_ptr)>;
+      if constexpr (traits<std::tuple_element_t<field_index_of<ValueT>, std::tuple<FieldTs...>>>::is_nullable)
+      {
+        return std::tuple<const BasicBitVector<AllocatorT>&>{BasicPackedMultiFieldArray::template presence<ValueT>()};
+      }
+      else
+      {
+        return std::tuple<>{};
+      }
+    }(static_cast<ValueTs*>(nullptr))...);
+  }
+
+  /**
+   * @brief Calls \c callback with the index of each element whose bit is set in all \c presence bitmaps
+   */
+  template <typename CallbackT, typename PresenceTupleT>
+  static inline void for_each_present_of(CallbackT&& callback, const PresenceTupleT& presence)
+  {
+    std::apply(
+      [&callback](const auto&... bitmaps) { for_each_set(std::forward<CallbackT>(callback), bitmaps...); }, presence);
+  }
+
+  /**
+   * @brief Adds one value to each field, from one argument per field
+   */
+  template <typename FieldArgTupleT, std::size_t... FieldIndices, std::size_t... UnpackedIndices>
+  inline void emplace_back_fields(
+    FieldArgTupleT&& field_args,
+    std::index_sequence<FieldIndices...> _,
+    std::index_sequence<UnpackedIndices...> __)
+  {
+    if constexpr (has_unpacked_fields)
+    {
+      unpacked_.emplace_back(std::get<unpacked_field_indices[UnpackedIndices]>(std::move(field_args))...);
+    }
+    (BasicPackedMultiFieldArray::emplace_back_packed(
+       std::get<FieldIndices>(columns_), std::get<FieldIndices>(std::move(field_args))),
+     ...);
+  }
+
+  /**
+   * @brief Adds one value to a packed column from \c field_arg; does nothing for fields which are not packed
+   */
+  template <typename ColumnT, typename FieldArgT>
+  static inline void emplace_back_packed(ColumnT& column, FieldArgT&& field_arg)
+  {
+    if constexpr (std::is_same_v<ColumnT, detail::UnpackedFieldColumn>)
+    {
+      // Added to 'unpacked_'
+    }
+    else if constexpr (std::is_same_v<ColumnT, BasicBitVector<AllocatorT>>)
+    {
+      column.push_back(static_cast<bool>(field_arg));
+    }
+    else if constexpr (std::is_same_v<std::decay_t<FieldArgT>, std::nullopt_t>)
+    {
+      column.emplace_back();
+    }
+    else
+    {
+      column.emplace_back(std::forward<FieldArgT>(field_arg));
+    }
+  }
+
+  /// Bitmap for each \c bool field, dense values and presence bitmap for each \c nullable field
+  std::tuple<typename traits<FieldTs>::column_type...> columns_;
+
+  /// Holds fields which are not packed
+  unpacked_storage_type unpacked_;
+
+  /// Number of elements
+  std::size_t size_ = 0;
+
+  /// Number of elements which can be held by all columns without re-allocating
+  std::size_t capacity_ = 0;
+};
+
+/**
+ * @brief Convenience alias for a packed multi-field array which uses \c std::allocator for all columns
+ */
+template <typename... FieldTs>
+using packed_multi_field_array =
+  BasicPackedMultiFieldArray<std::tuple<FieldTs...>, std::allocator<std::uint8_t>, DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
@@ -0,0 +1,173 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+// MF
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/single_pass_layout.hpp>
+#include <mf/support/view.hpp>
+#include <mf/thread_pool.hpp>
+
+namespace mf
+{
+namespace detail
+{
+
+/**
+ * @brief Returns the smallest number of elements which spans whole cache lines in a field of each of \c Ts
+ */
+template <typename... Ts> constexpr std::size_t cache_line_span()
+{
+  std::size_t span = 1UL;
+  ((span = std::lcm(span, cache_line_size / std::gcd(cache_line_size, sizeof(Ts)))), ...);
+  return span;
+}
+
+/**
+ * @brief Returns the smallest index at which an element of every field in \c data starts a cache line, or
+ *        \c cache_line_span<Ts...>() if there is no such index
+ *
+ *        Indices which differ from the result by a multiple of \c cache_line_span<Ts...>() also start a cache line in
+ *        every field.
+ */
+template <typename... Ts> std::size_t common_cache_line_index(const std::tuple<Ts*...>& data)
+{
+  constexpr std::size_t span = cache_line_span<Ts...>();
+  const auto starts_cache_line = [](const std::size_t index, const auto* const ptr) {
+    return (reinterpret_cast<std::uintptr_t>(ptr) + index * sizeof(*ptr)) % cache_line_size == 0UL;
+  };
+  for (std::size_t index = 0; index < span; ++index)
+  {
+    if (std::apply([&](const auto* const... ptrs) { return (starts_cache_line(index, ptrs) and ...); }, data))
+    {
+      return index;
+    }
+  }
+  return span;
+}
+
+/**
+ * @brief Calls <code>range_fn(first, last)</code> on ranges of a view of \c size elements of \c Ts, with field
+ *        pointers \c data, across threads in \c pool
+ *
+ *        Ranges are split on multiples of \c cache_line_span<Ts...>() elements, counted from the first index at
+ *        which every field starts a cache line, so no two threads write to the same line. Segments which are not
+ *        aligned to each other may have no such index, in which case ranges are counted from the first cache line
+ *        of the first field, and only that field is split on cache line boundaries.
+ */
+template <typename... Ts, typename RangeFnT>
+void parallel_for_aligned_ranges(
+  ThreadPool& pool,
+  const std::tuple<Ts*...>& data,
+  const std::size_t size,
+  RangeFnT&& range_fn,
+  const std::size_t min_block_size)
+{
+  constexpr std::size_t span = cache_line_span<Ts...>();
+  const std::size_t block_size = ((std::max(min_block_size, span) + span - 1UL) / span) * span;
+  std::size_t block_offset = common_cache_line_index(data);
+  if (block_offset == span)
+  {
+    // A field which never starts a cache line is counted from its first element
+    constexpr std::size_t first_field_span = cache_line_span<std::tuple_element_t<0, std::tuple<Ts...>>>();
+    block_offset = common_cache_line_index(std::make_tuple(std::get<0>(data))) % first_field_span;
+  }
+  pool.parallel_for_stealing(size, std::forward<RangeFnT>(range_fn), block_size, block_offset);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Calls <code>fn(fields...)</code> with references to the fields of each element of \c view, on threads in
+ *        \c pool, and waits for all elements to finish
+ *
+ *        \c view is split into ranges of at least \c min_block_size elements which begin and end on cache line
+ *        boundaries of its fields, so that threads writing to adjacent ranges never write to the same cache line.
+ *        This holds for every field only when the field segments can be split on common cache line boundaries, as
+ *        when each segment starts on a cache line (see \c aligned_single_allocator_adapter); otherwise, only the
+ *        first field of \c view is split on cache line boundaries. Ranges are balanced between threads by work
+ *        stealing, and the number of ranges each thread claims at once adapts to the cost of calling \c fn. Elements
+ *        are visited in no particular order.
+ *
+ * @throws any exception thrown by \c fn, once all other elements have been visited
+ */
+template <typename... Ts, typename FnT>
+void parallel_for_each(
+  ThreadPool& pool,
+  View<std::tuple<Ts...>> view,
+  FnT&& fn,
+  const std::size_t min_block_size = ThreadPool::default_block_size)
+{
+  const std::tuple<Ts*...> data = view.data();
+  const auto range_fn = [&data, &fn](const std::size_t first, const std::size_t last) {
+    std::apply(
+      [&fn, first, last](auto* const... ptrs) {
+        for (std::size_t i = first; i < last; ++i)
+        {
+          fn(ptrs[i]...);
+        }
+      },
+      data);
+  };
+  detail::parallel_for_aligned_ranges(pool, data, view.size(), range_fn, min_block_size);
+}
+
+/**
+ * @brief Assigns <code>fn(input_fields...)</code> to the fields of each element of \c output, for the fields of the
+ *        corresponding element of \c input, on threads in \c pool, and waits for all elements to finish
+ *
+ *        If \c output has more than one field, \c fn must return a tuple with a value for each. Work is split as by
+ *        \c parallel_for_each, on cache line boundaries of the fields of \c output. \c input and \c output must be
+ *        the same size, and may be views of the same multi-field array.
+ *
+ * @throws any exception thrown by \c fn, once all other elements have been visited
+ */
+template <typename... InputTs, typename... OutputTs, typename FnT>
+void parallel_transform(
+  ThreadPool& pool,
+  const View<std::tuple<InputTs...>>& input,
+  View<std::tuple<OutputTs...>> output,
+  FnT&& fn,
+  const std::size_t min_block_size = ThreadPool::default_block_size)
+{
+  static_assert(sizeof...(OutputTs) > 0, "'output' must have at least one field");
+  MF_ASSERT(input.size() == output.size());
+
+  const std::tuple<const InputTs*...> input_data = input.data();
+  const std::tuple<OutputTs*...> output_data = output.data();
+  const auto range_fn = [&input_data, &output_data, &fn](const std::size_t first, const std::size_t last) {
+    std::apply(
+      [&input_data, &fn, first, last](auto* const... output_ptrs) {
+        std::apply(
+          [&fn, first, last, output_ptrs...](auto* const... input_ptrs) {
+            for (std::size_t i = first; i < last; ++i)
+            {
+              if constexpr (sizeof...(OutputTs) == 1)
+              {
+                ((output_ptrs[i] = fn(input_ptrs[i]...)), ...);
+              }
+              else
+              {
+                std::tie(output_ptrs[i]...) = fn(input_ptrs[i]...);
+              }
+            }
+          },
+          input_data);
+      },
+      output_data);
+  };
+  detail::parallel_for_aligned_ranges(pool, output_data, output.size(), range_fn, min_block_size);
+}
+
+}  // namespace mf
@@ -0,0 +1,367 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/support/single_pass_layout.hpp>
+#include <mf/support/tuple_for_each.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Returns the smallest power of two which is greater than or equal to \c value
+ */
+constexpr std::size_t next_power_of_two(const std::size_t value)
+{
+  std::size_t power = 1UL;
+  while (power < value)
+  {
+    power <<= 1UL;
+  }
+  return power;
+}
+
+/**
+ * @brief Tag type used to specify a single-allocation strategy which recycles released blocks
+ *
+ * @tparam AllocatorT  byte allocator used to allocate blocks which are not available from the pool
+ * @tparam MaxCachedBlocks  maximum number of released blocks kept per size class, per thread
+ * @tparam SegmentAlignment  minimum alignment of the start of each field segment
+ */
+template <
+  typename AllocatorT = std::allocator<std::uint8_t>,
+  std::size_t MaxCachedBlocks = 8UL,
+  std::size_t SegmentAlignment = 1UL>
+struct PooledAllocationStrategy
+{};
+
+/**
+ * @copydoc BasicMultiAllocatorAdapter
+ *
+ *          Allocates memory for all fields at once, with the same layout as \c SinglePassAllocationStrategy. Block
+ *          lengths are rounded up to hold a power-of-two number of elements (a size class). Released blocks are kept
+ *          on per-thread free lists, one for each size class, and are handed out again before any new memory is
+ *          requested from \c ByteAllocatorT. Since free lists are shared by all adapters for the same field types,
+ *          repeatedly creating and destroying arrays of the same shape stops allocating once the pool is warm.
+ *
+ *          Cached blocks are returned to \c ByteAllocatorT when their thread exits, or with \c trim. Blocks released
+ *          by a thread after its pool has been destroyed, such as by \c static or \c thread_local arrays destroyed
+ *          late in thread or program exit, are returned directly to \c ByteAllocatorT.
+ */
+template <typename... ValueTs, typename ByteAllocatorT, std::size_t MaxCachedBlocks, std::size_t SegmentAlignment>
+class BasicMultiAllocatorAdapter<
+  std::tuple<ValueTs...>,
+  PooledAllocationStrategy<ByteAllocatorT, MaxCachedBlocks, SegmentAlignment>>
+{
+  static_assert(
+    std::allocator_traits<ByteAllocatorT>::is_always_equal::value,
+    "ByteAllocatorT must be stateless, since pooled blocks are shared between adapters");
+
+  /// Allocates blocks which are not available from the pool
+  using upstream_type =
+    BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, SinglePassAllocationStrategy<ByteAllocatorT, SegmentAlignment>>;
+
+public:
+  using allocator_types = std::tuple<ByteAllocatorT>;
+
+  /// Describes the placement of each field segment within an allocated block
+  using layout_type = typename upstream_type::layout_type;
+
+  /// Memory for all fields may be resized with \c reallocate
+  static constexpr bool supports_reallocate = true;
+
+  /// Memory cannot be resized without moving elements
+  static constexpr bool supports_resize_in_place = false;
+
+  /// Recycled blocks are not zero-filled
+  static constexpr bool supports_allocate_zeroed = false;
+
+  /// Blocks come from the pool or \c ByteAllocatorT, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment = std::false_type;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is move-assigned
+  using propagate_on_container_move_assignment = std::true_type;
+
+  /// Adapter is stateless; it never needs to be exchanged when containers are swapped
+  using propagate_on_container_swap = std::false_type;
+
+  /// Memory allocated by any adapter of this type may be de-allocated by any other
+  using is_always_equal = std::true_type;
+
+  BasicMultiAllocatorAdapter() = default;
+  BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const { return *this; }
+
+  /**
+   * @brief Always true, since adapters of this type are stateless
+   */
+  constexpr bool operator==([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return true; }
+
+  /**
+   * @brief Always false, since adapters of this type are stateless
+   */
+  constexpr bool operator!=([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return false; }
+
+  /**
+   * @brief Allocates memory for \c n elements of each type in \c ValueTs, reusing a released block if available
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> allocate(const std::size_t n)
+  {
+    if (n == 0UL)
+    {
+      return layout_type::segments(nullptr, n);
+    }
+    return layout_type::segments(BasicMultiAllocatorAdapter::acquire(size_class(n)), n);
+  }
+
+  /**
+   * @brief Returns memory for \c n elements of each type in \c ValueTs to the pool
+   *
+   * @param ptr  points to memory segments to be de-allocated
+   * @param n  number of elements to de-allocate
+   */
+  void deallocate(const std::tuple<ValueTs*...>& ptrs, const std::size_t n)
+  {
+    auto* const block = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
+
+    // Nothing was allocated for this block
+    if (block == nullptr)
+    {
+      return;
+    }
+
+    BasicMultiAllocatorAdapter::recycle(block, size_class(n));
+  }
+
+  /**
+   * @brief Resizes memory for all types in \c ValueTs from \c old_n to \c new_n elements
+   *
+   *        If \c old_n and \c new_n are in the same size class, the existing block is kept and leading elements of
+   *        each field segment are shifted to their positions in the resized layout. Otherwise, a block is acquired
+   *        from the new size class and leading elements are copied into it. Elements are preserved as bytes, and
+   *        must be trivially relocatable.
+   *
+   * @param ptrs  points to memory segments to be re-allocated
+   * @param size  number of leading elements to preserve
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @return tuple of pointers to re-allocated memory each type in \c ValueTs
+   */
+  std::tuple<ValueTs*...> reallocate(
+    const std::tuple<ValueTs*...>& ptrs,
+    const std::size_t size,
+    const std::size_t old_n,
+    const std::size_t new_n)
+  {
+    auto* const block = reinterpret_cast<std::uint8_t*>(std::get<0>(ptrs));
+
+    if (block != nullptr and new_n != 0UL and size_class(old_n) == size_class(new_n))
+    {
+      layout_type::move_segments(block, size, old_n, new_n);
+      return layout_type::segments(block, new_n);
+    }
+
+    const auto new_ptrs = BasicMultiAllocatorAdapter::allocate(new_n);
+    if (size != 0UL)
+    {
+      tuple_for_each(
+        [size](auto* const dst_ptr, const auto* const src_ptr) {
+          std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(*src_ptr) * size);
+        },
+        new_ptrs,
+        ptrs);
+    }
+    BasicMultiAllocatorAdapter::deallocate(ptrs, old_n);
+    return new_ptrs;
+  }
+
+  /**
+   * @brief Returns all blocks cached by the calling thread to \c ByteAllocatorT
+   */
+  static void trim()
+  {
+    if (auto* const thread_pool = BasicMultiAllocatorAdapter::pool(); thread_pool != nullptr)
+    {
+      thread_pool->release();
+    }
+  }
+
+  /**
+   * @brief Returns the number of blocks cached by the calling thread
+   */
+  static std::size_t cached_block_count()
+  {
+    const auto* const thread_pool = BasicMultiAllocatorAdapter::pool();
+    std::size_t total = 0UL;
+    if (thread_pool == nullptr)
+    {
+      return total;
+    }
+    for (const auto count : thread_pool->counts)
+    {
+      total += count;
+    }
+    return total;
+  }
+
+private:
+  /// Number of size classes; size class \c c holds <code>2^c</code> elements of each field
+  static constexpr std::size_t size_class_count = std::numeric_limits<std::size_t>::digits;
+
+  /**
+   * @brief Per-thread free lists of released blocks, for each size class
+   */
+  struct Pool
+  {
+    /// Released blocks for each size class
+    std::array<std::array<std::uint8_t*, MaxCachedBlocks>, size_class_count> blocks = {};
+
+    /// Number of released blocks in each size class
+    std::array<std::size_t, size_class_count> counts = {};
+
+    ~Pool()
+    {
+      release();
+      BasicMultiAllocatorAdapter::pool_destroyed() = true;
+    }
+
+    void release()
+    {
+      upstream_type upstream;
+      for (std::size_t c = 0; c < size_class_count; ++c)
+      {
+        for (std::size_t i = 0; i < counts[c]; ++i)
+        {
+          upstream.deallocate(layout_type::segments(blocks[c][i], class_capacity(c)), class_capacity(c));
+        }
+        counts[c] = 0UL;
+      }
+    }
+  };
+
+  /**
+   * @brief Returns a flag which is set once the pool of the calling thread has been destroyed
+   *
+   *        The flag is trivially destructible, so it remains valid while other \c thread_local and \c static objects
+   *        are destroyed.
+   */
+  static bool& pool_destroyed()
+  {
+    static thread_local bool destroyed = false;
+    return destroyed;
+  }
+
+  /**
+   * @brief Returns the pool of released blocks for the calling thread, or \c nullptr if it has been destroyed
+   */
+  static Pool* pool()
+  {
+    if (BasicMultiAllocatorAdapter::pool_destroyed())
+    {
+      return nullptr;
+    }
+    static thread_local Pool thread_pool;
+    return &thread_pool;
+  }
+
+  /**
+   * @brief Returns the size class of a block which holds at least \c n elements of each field
+   */
+  static constexpr std::size_t size_class(const std::size_t n)
+  {
+    std::size_t c = 0UL;
+    while (class_capacity(c) < n)
+    {
+      ++c;
+    }
+    return c;
+  }
+
+  /**
+   * @brief Returns the number of elements of each field which a block in size class \c c holds
+   */
+  static constexpr std::size_t class_capacity(const std::size_t c) { return 1UL << c; }
+
+  /**
+   * @brief Returns a block from size class \c c, from the pool if one is available
+   */
+  static std::uint8_t* acquire(const std::size_t c)
+  {
+    auto* const thread_pool = BasicMultiAllocatorAdapter::pool();
+    if (thread_pool != nullptr and thread_pool->counts[c] != 0UL)
+    {
+      return thread_pool->blocks[c][--thread_pool->counts[c]];
+    }
+
+    upstream_type upstream;
+    return reinterpret_cast<std::uint8_t*>(std::get<0>(upstream.allocate(class_capacity(c))));
+  }
+
+  /**
+   * @brief Returns a block from size class \c c to the pool, or to \c ByteAllocatorT if the pool is full
+   */
+  static void recycle(std::uint8_t* const block, const std::size_t c)
+  {
+    auto* const thread_pool = BasicMultiAllocatorAdapter::pool();
+    if (thread_pool != nullptr and thread_pool->counts[c] < MaxCachedBlocks)
+    {
+      thread_pool->blocks[c][thread_pool->counts[c]++] = block;
+      return;
+    }
+
+    upstream_type upstream;
+    upstream.deallocate(layout_type::segments(block, class_capacity(c)), class_capacity(c));
+  }
+};
+
+/**
+ * @brief Specifies a capacity-growing policy which fills pooled size classes exactly
+ */
+struct PooledCapacityIncreasePolicy
+{
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity) { return next_power_of_two(prev_capacity); }
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which recycles released blocks
+ */
+template <typename... ValueTs>
+using pooled_allocator_adapter = BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, PooledAllocationStrategy<>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which recycles released blocks
+ */
+template <typename... FieldTs>
+using pooled_multi_field_array =
+  BasicMultiFieldArray<std::tuple<FieldTs...>, pooled_allocator_adapter<FieldTs...>, PooledCapacityIncreasePolicy>;
+
+}  // namespace mf
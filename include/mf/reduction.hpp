@@ -0,0 +1,581 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MF
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/single_pass_layout.hpp>
+#include <mf/support/view.hpp>
+#include <mf/thread_pool.hpp>
+
+namespace mf
+{
+
+/// Number of elements in each block of a reduction, whose partial results are combined in a fixed tree order
+static constexpr std::size_t reduction_block_size = 4096UL;
+
+namespace detail
+{
+
+/**
+ * @brief Value and position of an element found by a reduction
+ */
+template <typename T> struct IndexedValue
+{
+  /// Element value
+  T value;
+
+  /// Element position
+  std::size_t index;
+};
+
+/// Type which holds the sum of elements of type \c T, as promoted by <code>T + T</code>
+template <typename T> using sum_t = std::decay_t<decltype(std::declval<const T&>() + std::declval<const T&>())>;
+
+/**
+ * @brief Returns the number of independent accumulators used to reduce values of type \c T
+ *
+ *        Enough to fill one cache line, such that each accumulator is a lane of a vector register on most targets,
+ *        and loops over them are unrolled and vectorized without reassociating any single accumulator.
+ */
+template <typename T> constexpr std::size_t reduction_lane_count()
+{
+  return std::clamp(cache_line_size / sizeof(T), std::size_t{2}, std::size_t{16});
+}
+
+/**
+ * @brief Combines the values in \c partials pairwise, in a fixed tree order, and returns the result
+ */
+template <typename T, std::size_t N, typename CombineFnT> T tree_combine(T (&partials)[N], CombineFnT&& combine)
+{
+  for (std::size_t stride = 1; stride < N; stride *= 2UL)
+  {
+    for (std::size_t i = 0; i + stride < N; i += 2UL * stride)
+    {
+      partials[i] = combine(partials[i], partials[i + stride]);
+    }
+  }
+  return partials[0];
+}
+
+/**
+ * @copydoc tree_combine
+ */
+template <typename T, typename CombineFnT> T tree_combine(std::vector<T>& partials, CombineFnT&& combine)
+{
+  for (std::size_t stride = 1; stride < partials.size(); stride *= 2UL)
+  {
+    for (std::size_t i = 0; i + stride < partials.size(); i += 2UL * stride)
+    {
+      partials[i] = combine(partials[i], partials[i + stride]);
+    }
+  }
+  return partials[0];
+}
+
+/**
+ * @brief Returns the sum of \c n values from \c data
+ *
+ *        Values are summed into independent lanes, which are summed in a fixed tree order, so the result of summing
+ *        floating point values does not depend on the target or on how the loop is vectorized.
+ */
+template <typename T> sum_t<T> sum_kernel(const T* const data, const std::size_t n)
+{
+  using ResultT = sum_t<T>;
+  constexpr std::size_t L = reduction_lane_count<ResultT>();
+
+  ResultT lanes[L] = {};
+  std::size_t i = 0;
+  for (; i + L <= n; i += L)
+  {
+    for (std::size_t k = 0; k < L; ++k)
+    {
+      lanes[k] += data[i + k];
+    }
+  }
+  for (std::size_t k = 0; i < n; ++i, ++k)
+  {
+    lanes[k] += data[i];
+  }
+  return tree_combine(lanes, [](const ResultT& lhs, const ResultT& rhs) { return lhs + rhs; });
+}
+
+/**
+ * @brief Returns the smallest and the largest of \c n values from \c data, where \c n is at least one
+ *
+ *        Either of the results is skipped when \c Min or \c Max is false.
+ */
+template <bool Min, bool Max, typename T> std::pair<T, T> minmax_kernel(const T* const data, const std::size_t n)
+{
+  constexpr std::size_t L = reduction_lane_count<T>();
+
+  if (n < L)
+  {
+    std::pair<T, T> result{data[0], data[0]};
+    for (std::size_t i = 1; i < n; ++i)
+    {
+      result.first = (data[i] < result.first) ? data[i] : result.first;
+      result.second = (result.second < data[i]) ? data[i] : result.second;
+    }
+    return result;
+  }
+
+  T min_lanes[L];
+  T max_lanes[L];
+  std::copy(data, data + L, min_lanes);
+  std::copy(data, data + L, max_lanes);
+  std::size_t i = L;
+  for (; i + L <= n; i += L)
+  {
+    for (std::size_t k = 0; k < L; ++k)
+    {
+      if constexpr (Min)
+      {
+        min_lanes[k] = (data[i + k] < min_lanes[k]) ? data[i + k] : min_lanes[k];
+      }
+      if constexpr (Max)
+      {
+        max_lanes[k] = (max_lanes[k] < data[i + k]) ? data[i + k] : max_lanes[k];
+      }
+    }
+  }
+  for (std::size_t k = 0; i < n; ++i, ++k)
+  {
+    min_lanes[k] = (data[i] < min_lanes[k]) ? data[i] : min_lanes[k];
+    max_lanes[k] = (max_lanes[k] < data[i]) ? data[i] : max_lanes[k];
+  }
+
+  std::pair<T, T> result{data[0], data[0]};
+  if constexpr (Min)
+  {
+    result.first = tree_combine(min_lanes, [](const T& lhs, const T& rhs) { return (rhs < lhs) ? rhs : lhs; });
+  }
+  if constexpr (Max)
+  {
+    result.second = tree_combine(max_lanes, [](const T& lhs, const T& rhs) { return (lhs < rhs) ? rhs : lhs; });
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the first of two results of an argmin or argmax search, by value, or by index if values are equal
+ */
+template <bool Max, typename T> IndexedValue<T> select_indexed(const IndexedValue<T>& lhs, const IndexedValue<T>& rhs)
+{
+  const bool rhs_first = Max ? (lhs.value < rhs.value) : (rhs.value < lhs.value);
+  if (rhs_first or (!(lhs.value < rhs.value) and !(rhs.value < lhs.value) and rhs.index < lhs.index))
+  {
+    return rhs;
+  }
+  return lhs;
+}
+
+/**
+ * @brief Returns the first smallest (or largest, if \c Max is true) of \c n values from \c data, and its position,
+ *        where \c n is at least one
+ */
+template <bool Max, typename T> IndexedValue<T> argminmax_kernel(const T* const data, const std::size_t n)
+{
+  constexpr std::size_t L = reduction_lane_count<T>();
+  const auto precedes = [](const T& candidate, const T& current) {
+    return Max ? (current < candidate) : (candidate < current);
+  };
+
+  if (n < L)
+  {
+    IndexedValue<T> result{data[0], 0UL};
+    for (std::size_t i = 1; i < n; ++i)
+    {
+      if (precedes(data[i], result.value))
+      {
+        result = IndexedValue<T>{data[i], i};
+      }
+    }
+    return result;
+  }
+
+  T value_lanes[L];
+  std::size_t index_lanes[L];
+  for (std::size_t k = 0; k < L; ++k)
+  {
+    value_lanes[k] = data[k];
+    index_lanes[k] = k;
+  }
+  std::size_t i = L;
+  for (; i + L <= n; i += L)
+  {
+    for (std::size_t k = 0; k < L; ++k)
+    {
+      const bool update = precedes(data[i + k], value_lanes[k]);
+      value_lanes[k] = update ? data[i + k] : value_lanes[k];
+      index_lanes[k] = update ? (i + k) : index_lanes[k];
+    }
+  }
+  for (std::size_t k = 0; i < n; ++i, ++k)
+  {
+    if (precedes(data[i], value_lanes[k]))
+    {
+      value_lanes[k] = data[i];
+      index_lanes[k] = i;
+    }
+  }
+
+  IndexedValue<T> result{value_lanes[0], index_lanes[0]};
+  for (std::size_t k = 1; k < L; ++k)
+  {
+    result = select_indexed<Max>(result, IndexedValue<T>{value_lanes[k], index_lanes[k]});
+  }
+  return result;
+}
+
+/**
+ * @brief Calls <code>block_fn(first, last)</code> on each block of <code>[0, n)</code>, on threads in \c pool if
+ *        provided, and combines the results of all blocks in a fixed tree order
+ *
+ *        Blocks are always \c reduction_block_size elements, so the result does not depend on whether a pool is
+ *        used, or on how many threads it has.
+ */
+template <typename BlockFnT, typename CombineFnT>
+auto reduce_blocks(ThreadPool* const pool, const std::size_t n, BlockFnT&& block_fn, CombineFnT&& combine)
+{
+  using ResultT = std::invoke_result_t<BlockFnT&, std::size_t, std::size_t>;
+
+  const std::size_t block_count = (n + reduction_block_size - 1UL) / reduction_block_size;
+  if (block_count <= 1UL)
+  {
+    return block_fn(0UL, n);
+  }
+
+  std::vector<ResultT> partials(block_count);
+  const auto range_fn = [n, &partials, &block_fn](const std::size_t first_block, const std::size_t last_block) {
+    for (std::size_t b = first_block; b < last_block; ++b)
+    {
+      const std::size_t first = b * reduction_block_size;
+      partials[b] = block_fn(first, std::min(n, first + reduction_block_size));
+    }
+  };
+
+  if (pool == nullptr)
+  {
+    range_fn(0UL, block_count);
+  }
+  else
+  {
+    pool->parallel_for_stealing(block_count, range_fn, 1UL);
+  }
+  return tree_combine(partials, std::forward<CombineFnT>(combine));
+}
+
+/**
+ * @brief Returns <code>field_fn(data, n)</code> for the pointer to the first element of the only field of \c view,
+ *        or a tuple of such results for each field, if \c view has more than one field
+ */
+template <typename... Ts, typename FieldFnT>
+auto reduce_each_field(const View<std::tuple<Ts...>>& view, FieldFnT&& field_fn)
+{
+  return std::apply(
+    [&field_fn, n = view.size()](const auto* const... ptrs) {
+      if constexpr (sizeof...(Ts) == 1)
+      {
+        return field_fn(ptrs..., n);
+      }
+      else
+      {
+        return std::make_tuple(field_fn(ptrs, n)...);
+      }
+    },
+    view.data());
+}
+
+/**
+ * @brief Implements \c sum, on threads in \c pool if provided
+ */
+template <typename... Ts> auto sum(ThreadPool* const pool, const View<std::tuple<Ts...>>& view)
+{
+  return reduce_each_field(view, [pool](const auto* const data, const std::size_t n) {
+    using ResultT = sum_t<std::remove_const_t<pointer_element_t<decltype(data)>>>;
+    return reduce_blocks(
+      pool,
+      n,
+      [data](const std::size_t first, const std::size_t last) { return sum_kernel(data + first, last - first); },
+      [](const ResultT& lhs, const ResultT& rhs) { return lhs + rhs; });
+  });
+}
+
+/**
+ * @brief Implements \c min, \c max and \c minmax, on threads in \c pool if provided
+ */
+template <bool Min, bool Max, typename... Ts> auto minmax(ThreadPool* const pool, const View<std::tuple<Ts...>>& view)
+{
+  MF_ASSERT(!view.empty());
+  return reduce_each_field(view, [pool](const auto* const data, const std::size_t n) {
+    using ValueT = std::remove_const_t<pointer_element_t<decltype(data)>>;
+    const auto result = reduce_blocks(
+      pool,
+      n,
+      [data](const std::size_t first, const std::size_t last) {
+        return minmax_kernel<Min, Max>(data + first, last - first);
+      },
+      [](const std::pair<ValueT, ValueT>& lhs, const std::pair<ValueT, ValueT>& rhs) {
+        return std::pair<ValueT, ValueT>{(rhs.first < lhs.first) ? rhs.first : lhs.first,
+                                         (lhs.second < rhs.second) ? rhs.second : lhs.second};
+      });
+    if constexpr (Min and Max)
+    {
+      return result;
+    }
+    else if constexpr (Min)
+    {
+      return result.first;
+    }
+    else
+    {
+      return result.second;
+    }
+  });
+}
+
+/**
+ * @brief Implements \c argmin and \c argmax, on threads in \c pool if provided
+ */
+template <bool Max, typename... Ts> auto argminmax(ThreadPool* const pool, const View<std::tuple<Ts...>>& view)
+{
+  return reduce_each_field(view, [pool](const auto* const data, const std::size_t n) {
+    using ValueT = std::remove_const_t<pointer_element_t<decltype(data)>>;
+    if (n == 0)
+    {
+      return n;
+    }
+    return reduce_blocks(
+             pool,
+             n,
+             [data](const std::size_t first, const std::size_t last) {
+               auto result = argminmax_kernel<Max>(data + first, last - first);
+               result.index += first;
+               return result;
+             },
+             select_indexed<Max, ValueT>)
+      .index;
+  });
+}
+
+/**
+ * @brief Implements \c count_if, on threads in \c pool if provided
+ */
+template <typename... Ts, typename PredicateT>
+std::size_t count_if(ThreadPool* const pool, const View<std::tuple<Ts...>>& view, PredicateT&& predicate)
+{
+  const std::tuple<const Ts*...> data = view.data();
+  return reduce_blocks(
+    pool,
+    view.size(),
+    [&data, &predicate](const std::size_t first, const std::size_t last) {
+      return std::apply(
+        [&predicate, first, last](const auto* const... ptrs) {
+          std::size_t count = 0;
+          for (std::size_t i = first; i < last; ++i)
+          {
+            count += static_cast<std::size_t>(static_cast<bool>(predicate(ptrs[i]...)));
+          }
+          return count;
+        },
+        data);
+    },
+    [](const std::size_t lhs, const std::size_t rhs) { return lhs + rhs; });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns <code>op(...op(op(init, fields_0...), fields_1...)..., fields_n...)</code>, where \c fields_i are
+ *        the fields of element \c i of \c view, in order
+ */
+template <typename... Ts, typename ResultT, typename OpT>
+ResultT reduce(const View<std::tuple<Ts...>>& view, ResultT init, OpT&& op)
+{
+  return std::apply(
+    [&init, &op, n = view.size()](const auto* const... ptrs) {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        init = op(std::move(init), ptrs[i]...);
+      }
+      return std::move(init);
+    },
+    view.data());
+}
+
+/**
+ * @brief Reduces each block of \c view with <code>reduce(block, init, op)</code> on threads in \c pool, and returns
+ *        the results of all blocks combined with \c combine, in a fixed tree order
+ *
+ *        \c init must be an identity of \c combine, since each block starts from it, and \c combine must be
+ *        associative. The result does not depend on the number of threads in \c pool.
+ */
+template <typename... Ts, typename ResultT, typename OpT, typename CombineFnT>
+ResultT reduce(
+  ThreadPool& pool,
+  const View<std::tuple<Ts...>>& view,
+  const ResultT& init,
+  OpT&& op,
+  CombineFnT&& combine)
+{
+  return detail::reduce_blocks(
+    std::addressof(pool),
+    view.size(),
+    [&view, &init, &op](const std::size_t first, const std::size_t last) {
+      return mf::reduce(view.subview(first, last - first), init, op);
+    },
+    std::forward<CombineFnT>(combine));
+}
+
+/**
+ * @brief Returns the sum of all elements of the only field of \c view, or a tuple of sums for each field
+ *
+ *        Each sum has the type of <code>T + T</code>, for fields of type \c T. Elements are summed in fixed-size
+ *        blocks, and in independent lanes within each block, which allows arithmetic fields to be summed with
+ *        vector instructions; all partial sums are then added in a fixed tree order, so floating point sums are
+ *        reproducible, and match the result of <code>sum(pool, view)</code> for any \c pool.
+ */
+template <typename... Ts> auto sum(const View<std::tuple<Ts...>>& view) { return detail::sum(nullptr, view); }
+
+/**
+ * @copydoc sum
+ * @note blocks are summed on threads in \c pool
+ */
+template <typename... Ts> auto sum(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::sum(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the smallest element of the only field of \c view, or a tuple of the smallest elements of each
+ *        field
+ *
+ * @warning \c view must not be empty
+ */
+template <typename... Ts> auto min(const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<true, false>(nullptr, view);
+}
+
+/**
+ * @copydoc min
+ * @note blocks are searched on threads in \c pool
+ */
+template <typename... Ts> auto min(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<true, false>(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the largest element of the only field of \c view, or a tuple of the largest elements of each field
+ *
+ * @warning \c view must not be empty
+ */
+template <typename... Ts> auto max(const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<false, true>(nullptr, view);
+}
+
+/**
+ * @copydoc max
+ * @note blocks are searched on threads in \c pool
+ */
+template <typename... Ts> auto max(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<false, true>(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the smallest and largest elements of the only field of \c view, as a pair, or a tuple of such pairs
+ *        for each field
+ *
+ * @warning \c view must not be empty
+ */
+template <typename... Ts> auto minmax(const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<true, true>(nullptr, view);
+}
+
+/**
+ * @copydoc minmax
+ * @note blocks are searched on threads in \c pool
+ */
+template <typename... Ts> auto minmax(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::minmax<true, true>(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the position of the first smallest element of the only field of \c view, or a tuple of such
+ *        positions for each field
+ *
+ *        Returns <code>view.size()</code> if \c view is empty.
+ */
+template <typename... Ts> auto argmin(const View<std::tuple<Ts...>>& view)
+{
+  return detail::argminmax<false>(nullptr, view);
+}
+
+/**
+ * @copydoc argmin
+ * @note blocks are searched on threads in \c pool
+ */
+template <typename... Ts> auto argmin(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::argminmax<false>(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the position of the first largest element of the only field of \c view, or a tuple of such
+ *        positions for each field
+ *
+ *        Returns <code>view.size()</code> if \c view is empty.
+ */
+template <typename... Ts> auto argmax(const View<std::tuple<Ts...>>& view)
+{
+  return detail::argminmax<true>(nullptr, view);
+}
+
+/**
+ * @copydoc argmax
+ * @note blocks are searched on threads in \c pool
+ */
+template <typename... Ts> auto argmax(ThreadPool& pool, const View<std::tuple<Ts...>>& view)
+{
+  return detail::argminmax<true>(std::addressof(pool), view);
+}
+
+/**
+ * @brief Returns the number of elements of \c view for which <code>predicate(fields...)</code> is true
+ */
+template <typename... Ts, typename PredicateT>
+std::size_t count_if(const View<std::tuple<Ts...>>& view, PredicateT&& predicate)
+{
+  return detail::count_if(nullptr, view, std::forward<PredicateT>(predicate));
+}
+
+/**
+ * @copydoc count_if
+ * @note blocks are counted on threads in \c pool
+ */
+template <typename... Ts, typename PredicateT>
+std::size_t count_if(ThreadPool& pool, const View<std::tuple<Ts...>>& view, PredicateT&& predicate)
+{
+  return detail::count_if(std::addressof(pool), view, std::forward<PredicateT>(predicate));
+}
+
+}  // namespace mf
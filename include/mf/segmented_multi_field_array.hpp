@@ -0,0 +1,837 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/placement_new.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/tuple_for_each.hpp>
+#include <mf/support/tuple_ref.hpp>
+#include <mf/support/tuple_select.hpp>
+#include <mf/support/view.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Iterates over all elements of a segmented container, in order, across its chunks
+ *
+ * @tparam PointersT  tuple of pointers used to access fields
+ * @tparam ChunkPointersT  tuple of pointers to the first element of each field in a chunk
+ * @tparam ChunkSize  number of elements in each chunk
+ */
+template <typename PointersT, typename ChunkPointersT, std::size_t ChunkSize> class SegmentedIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using pointer = PointersT;
+  using reference = decltype(tuple_dereference(std::declval<PointersT&>()));
+  using value_type = reference;
+
+  SegmentedIterator(const ChunkPointersT* const chunks, const std::size_t index) : chunks_{chunks}, index_{index} {}
+
+  inline bool operator==(const SegmentedIterator& other) const { return index_ == other.index_; }
+  inline bool operator!=(const SegmentedIterator& other) const { return index_ != other.index_; }
+
+  inline std::ptrdiff_t operator-(const SegmentedIterator& other) const
+  {
+    return static_cast<std::ptrdiff_t>(index_) - static_cast<std::ptrdiff_t>(other.index_);
+  }
+
+  inline SegmentedIterator& operator++()
+  {
+    ++index_;
+    return *this;
+  }
+
+  inline SegmentedIterator operator++(int)
+  {
+    SegmentedIterator prev{*this};
+    ++index_;
+    return prev;
+  }
+
+  inline reference operator*() const
+  {
+    PointersT ptrs{chunks_[index_ / ChunkSize]};
+    tuple_for_each([offset = index_ % ChunkSize](auto& ptr) { ptr += offset; }, ptrs);
+    return tuple_dereference(ptrs);
+  }
+
+private:
+  /// Pointers to the fields of each chunk
+  const ChunkPointersT* chunks_;
+
+  /// Position of the element across all chunks
+  std::size_t index_;
+};
+
+/**
+ * @brief Multi-field array which holds elements in fixed-size chunks, each with room for \c ChunkSize elements of
+ *        every field
+ *
+ *        Each chunk is allocated with \c AllocatorAdapterT, so all fields of a chunk are placed according to the
+ *        adapter's allocation strategy. When the container is full, adding an element allocates one more chunk, rather
+ *        than re-allocating and moving all existing elements; elements never move once they are created, so
+ *        references and pointers to them remain valid until they are removed.
+ *
+ *        Elements within a chunk are contiguous, so loops which need contiguous fields should go chunk-by-chunk, using
+ *        the \c View returned by \c chunk or passed by \c for_each_chunk. Pointers to each chunk are held in a
+ *        directory, which is a small \c std::vector with one entry per chunk.
+ *
+ *        Adding an element takes amortized constant time, rather than worst-case constant time: no element is ever
+ *        moved, but the directory is re-allocated as it grows, which copies one pointer per field for each chunk.
+ *        Appends which stay within \c capacity, as after \c reserve, never allocate.
+ *
+ * @tparam ChunkSize  number of elements in each chunk; must be a power of two
+ */
+template <typename... Ts, typename AllocatorTs, std::size_t ChunkSize>
+class BasicSegmentedMultiFieldArray<
+  std::tuple<Ts...>,
+  BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>,
+  ChunkSize>
+{
+  static_assert(ChunkSize > 0 and (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+  static_assert(
+    !BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>::has_inline_storage,
+    "Chunks must not be held within the allocator adapter, since they are taken by moved-to containers");
+
+public:
+  /// Alias for multi-field allocator adapter
+  using allocator_adapter_type = BasicMultiAllocatorAdapter<std::tuple<Ts...>, AllocatorTs>;
+
+  /// Tuple of field value types
+  using value_type = std::tuple<Ts...>;
+
+  /// Iterator over all elements
+  using iterator = SegmentedIterator<std::tuple<Ts*...>, std::tuple<Ts*...>, ChunkSize>;
+
+  /// Iterator over all elements, which does not allow them to be modified
+  using const_iterator = SegmentedIterator<std::tuple<const Ts*...>, std::tuple<Ts*...>, ChunkSize>;
+
+  /// Number of elements in each chunk
+  static constexpr std::size_t chunk_size = ChunkSize;
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size to zero, without allocating any chunks
+   */
+  BasicSegmentedMultiFieldArray() : allocator_adapter_{}, size_{0} {}
+
+  /**
+   * @brief Allocator adapter initialization constructor
+   */
+  explicit BasicSegmentedMultiFieldArray(const allocator_adapter_type& allocator_adapter) :
+      allocator_adapter_{allocator_adapter},
+      size_{0}
+  {}
+
+  /**
+   * @brief Creates \c count value-initialized elements
+   */
+  explicit BasicSegmentedMultiFieldArray(std::size_t count) : allocator_adapter_{}, size_{0}
+  {
+    BasicSegmentedMultiFieldArray::resize(count);
+  }
+
+  /**
+   * @brief Creates \c count elements, copy-constructed from each value in \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  BasicSegmentedMultiFieldArray(std::size_t count, CTorArgTupleT&& ctor_arg_tuple) : allocator_adapter_{}, size_{0}
+  {
+    BasicSegmentedMultiFieldArray::resize(count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+  }
+
+  BasicSegmentedMultiFieldArray(const BasicSegmentedMultiFieldArray& other) :
+      allocator_adapter_{other.allocator_adapter_.select_on_container_copy_construction()},
+      size_{0}
+  {
+    BasicSegmentedMultiFieldArray::append_copies(other);
+  }
+
+  /**
+   * @brief Moves elements of \c other into a new container
+   *
+   *        Chunks are taken from \c other, so elements are not moved, and remain at the same addresses
+   */
+  BasicSegmentedMultiFieldArray(BasicSegmentedMultiFieldArray&& other) :
+      allocator_adapter_{std::move(other.allocator_adapter_)},
+      chunks_{std::move(other.chunks_)},
+      size_{other.size_}
+  {
+    other.chunks_.clear();
+    other.size_ = 0UL;
+  }
+
+  ~BasicSegmentedMultiFieldArray() { BasicSegmentedMultiFieldArray::release(); }
+
+  /**
+   * @brief Copies elements of \c other into this container
+   *
+   *        The allocator adapter of \c other replaces this container's adapter if
+   *        \c allocator_adapter_type::propagate_on_container_copy_assignment is true
+   */
+  BasicSegmentedMultiFieldArray& operator=(const BasicSegmentedMultiFieldArray& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    BasicSegmentedMultiFieldArray::clear();
+    if constexpr (allocator_adapter_type::propagate_on_container_copy_assignment::value)
+    {
+      // Memory allocated by the current adapter must be released before it is replaced
+      if (allocator_adapter_ != other.allocator_adapter_)
+      {
+        BasicSegmentedMultiFieldArray::release();
+      }
+      allocator_adapter_ = other.allocator_adapter_;
+    }
+    BasicSegmentedMultiFieldArray::append_copies(other);
+    return *this;
+  }
+
+  /**
+   * @brief Moves elements of \c other into this container
+   *
+   *        Chunks are taken from \c other if \c allocator_adapter_type::propagate_on_container_move_assignment is
+   *        true, or if both allocator adapters are equal. Otherwise, elements are moved one-by-one into chunks
+   *        allocated by this container's adapter.
+   */
+  BasicSegmentedMultiFieldArray& operator=(BasicSegmentedMultiFieldArray&& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    if constexpr (allocator_adapter_type::propagate_on_container_move_assignment::value)
+    {
+      BasicSegmentedMultiFieldArray::release();
+      allocator_adapter_ = std::move(other.allocator_adapter_);
+      BasicSegmentedMultiFieldArray::steal(other);
+    }
+    else if (allocator_adapter_type::is_always_equal::value or allocator_adapter_ == other.allocator_adapter_)
+    {
+      BasicSegmentedMultiFieldArray::release();
+      BasicSegmentedMultiFieldArray::steal(other);
+    }
+    else
+    {
+      BasicSegmentedMultiFieldArray::clear();
+      BasicSegmentedMultiFieldArray::reserve(other.size_);
+      for (auto&& element : other)
+      {
+        std::apply([this](auto&... fields) { this->emplace_back(std::move(fields)...); }, element);
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   *
+   *        Does not invoke any move, copy, or swap operations on individual elements. Allocator adapters are exchanged
+   *        if \c allocator_adapter_type::propagate_on_container_swap is true; otherwise, both adapters must be equal.
+   */
+  inline void swap(BasicSegmentedMultiFieldArray& other)
+  {
+    if constexpr (allocator_adapter_type::propagate_on_container_swap::value)
+    {
+      std::swap(other.allocator_adapter_, this->allocator_adapter_);
+    }
+    else
+    {
+      MF_ASSERT(allocator_adapter_type::is_always_equal::value or allocator_adapter_ == other.allocator_adapter_);
+    }
+    std::swap(other.chunks_, this->chunks_);
+    std::swap(other.size_, this->size_);
+  }
+
+  /**
+   * @brief Returns references to values at index for each specified field type
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    const auto& chunk_data = chunks_[index / ChunkSize];
+    const std::size_t offset = index % ChunkSize;
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<SingleValueT&>(std::get<SingleValueT*>(chunk_data)[offset]);
+    }
+    else
+    {
+      return std::tuple<ValueTs&...>{std::get<ValueTs*>(chunk_data)[offset]...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    const auto& chunk_data = chunks_[index / ChunkSize];
+    const std::size_t offset = index % ChunkSize;
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<const SingleValueT&>(std::get<SingleValueT*>(chunk_data)[offset]);
+    }
+    else
+    {
+      return std::tuple<const ValueTs&...>{std::get<ValueTs*>(chunk_data)[offset]...};
+    }
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is the first argument.
+   *        All arguments which follow should be tuples of arguments used to construct values for each corresponding
+   *        field type. Allocates one more chunk if all chunks are full.
+   */
+  template <typename... PiecewiseFieldCTorTupleTs>
+  inline void emplace_back([[maybe_unused]] std::piecewise_construct_t _, PiecewiseFieldCTorTupleTs&&... ctor_args)
+  {
+    static_assert(sizeof...(Ts) == sizeof...(PiecewiseFieldCTorTupleTs), "Should be construct args for each type");
+
+    // Contruct new element past the previous last element
+    tuple_for_each(
+      [s = size_ % ChunkSize](auto* const ptr, auto&& ctor_arg_tuple) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        mf::apply_placement_new<ElementType>(ptr + s, std::forward<decltype(ctor_arg_tuple)>(ctor_arg_tuple));
+      },
+      BasicSegmentedMultiFieldArray::back_chunk_for_element_added(),
+      std::forward_as_tuple(ctor_args...));
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is NOT the first
+   *        argument. All arguments should be lvalue or rvalue references to values used to copy/move construct
+   *        values for each corresponding field type; if no arguments are given, all fields are value-initialized.
+   *        Allocates one more chunk if all chunks are full.
+   */
+  template <typename... FieldCopyOrMoveCTorTs>
+  inline void emplace_back(FieldCopyOrMoveCTorTs&&... copy_or_move_ctor_args)
+  {
+    static_assert(
+      (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts)) or (sizeof...(FieldCopyOrMoveCTorTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+
+    const std::size_t offset = size_ % ChunkSize;
+    if constexpr (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts))
+    {
+      // Contruct new element past the previous last element
+      tuple_for_each(
+        [offset](auto* const ptr, auto&& ctor_arg) {
+          using ElementType = pointer_element_t<decltype(ptr)>;
+
+          // Simply assign fundamental types
+          if constexpr (std::is_fundamental_v<ElementType>)
+          {
+            *(ptr + offset) = std::forward<decltype(ctor_arg)>(ctor_arg);
+          }
+          else
+          {
+            new (ptr + offset) ElementType{std::forward<decltype(ctor_arg)>(ctor_arg)};
+          }
+        },
+        BasicSegmentedMultiFieldArray::back_chunk_for_element_added(),
+        std::forward_as_tuple(std::forward<FieldCopyOrMoveCTorTs>(copy_or_move_ctor_args)...));
+    }
+    else
+    {
+      BasicSegmentedMultiFieldArray::construct(
+        BasicSegmentedMultiFieldArray::back_chunk_for_element_added(), offset, offset + 1UL);
+    }
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   */
+  void push_back(const value_type& value)
+  {
+    std::apply([this](const auto&... fields) { this->emplace_back(fields...); }, value);
+  }
+
+  /**
+   * @brief Removes last element
+   *
+   *        The chunk which held the element is kept, to be re-used by elements added later
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    const std::size_t last = size_ - 1UL;
+    BasicSegmentedMultiFieldArray::destroy(chunks_[last / ChunkSize], last % ChunkSize, last % ChunkSize + 1UL);
+    size_ = last;
+  }
+
+  /**
+   * @brief Allocates chunks until the container can hold at least \c n elements
+   *
+   *        Existing elements are never moved
+   */
+  void reserve(const std::size_t n)
+  {
+    const std::size_t required_chunk_count = (n + ChunkSize - 1UL) / ChunkSize;
+    if (required_chunk_count <= chunks_.size())
+    {
+      return;
+    }
+
+    chunks_.reserve(required_chunk_count);
+    while (chunks_.size() < required_chunk_count)
+    {
+      chunks_.emplace_back(allocator_adapter_.allocate(ChunkSize));
+    }
+  }
+
+  /**
+   * @brief Resizes container to the given size, \c new_size
+   *
+   *        If \c new_size is larger than \c size(), then new elements are value-initialized, or copy-constructed
+   *        from each value in \c ctor_arg_tuple, if provided. If \c new_size is smaller than \c size(), then all
+   *        tail elements past \c new_size are destroyed; chunks are kept.
+   */
+  template <typename... CTorArgTupleT> void resize(const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+
+    if (new_size < size_)
+    {
+      BasicSegmentedMultiFieldArray::for_each_chunk_range(
+        new_size, size_, [this](auto& chunk_data, const std::size_t first, const std::size_t last) {
+          BasicSegmentedMultiFieldArray::destroy(chunk_data, first, last);
+        });
+    }
+    else
+    {
+      BasicSegmentedMultiFieldArray::reserve(new_size);
+      BasicSegmentedMultiFieldArray::for_each_chunk_range(
+        size_, new_size, [this, &ctor_arg_tuple...](auto& chunk_data, const std::size_t first, const std::size_t last) {
+          BasicSegmentedMultiFieldArray::construct(chunk_data, first, last, ctor_arg_tuple...);
+        });
+    }
+    size_ = new_size;
+  }
+
+  /**
+   * @brief De-allocates all chunks which do not hold elements
+   */
+  void shrink_to_fit()
+  {
+    const std::size_t required_chunk_count = (size_ + ChunkSize - 1UL) / ChunkSize;
+    while (chunks_.size() > required_chunk_count)
+    {
+      allocator_adapter_.deallocate(chunks_.back(), ChunkSize);
+      chunks_.pop_back();
+    }
+    chunks_.shrink_to_fit();
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0; chunks are kept
+   */
+  inline void clear()
+  {
+    BasicSegmentedMultiFieldArray::for_each_chunk_range(
+      0UL, size_, [this](auto& chunk_data, const std::size_t first, const std::size_t last) {
+        BasicSegmentedMultiFieldArray::destroy(chunk_data, first, last);
+      });
+    size_ = 0UL;
+  }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which the container can hold without allocating another chunk
+   */
+  inline std::size_t capacity() const { return chunks_.size() * ChunkSize; }
+
+  /**
+   * @brief Returns the number of chunks which hold at least one element
+   */
+  inline std::size_t chunk_count() const { return (size_ + ChunkSize - 1UL) / ChunkSize; }
+
+  /**
+   * @brief Returns an iterable data view for all fields of the elements in the chunk at \c chunk_index
+   */
+  inline View<std::tuple<Ts...>> chunk(const std::size_t chunk_index)
+  {
+    return View<std::tuple<Ts...>>{chunks_[chunk_index], BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types of the elements in the chunk at \c chunk_index
+   */
+  template <typename... ViewValueTs> View<std::tuple<ViewValueTs...>> chunk(const std::size_t chunk_index)
+  {
+    return View<std::tuple<ViewValueTs...>>{
+      std::forward_as_tuple(std::get<ViewValueTs*>(chunks_[chunk_index])...),
+      BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @copydoc chunk
+   */
+  template <std::size_t... Indices> View<tuple_select_t<value_type, Indices...>> chunk(const std::size_t chunk_index)
+  {
+    return View<tuple_select_t<value_type, Indices...>>{
+      std::forward_as_tuple(std::get<Indices>(chunks_[chunk_index])...),
+      BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields of the elements in the chunk at \c chunk_index
+   */
+  inline View<std::tuple<const Ts...>> chunk(const std::size_t chunk_index) const
+  {
+    return View<std::tuple<const Ts...>>{
+      std::tuple<const Ts*...>{chunks_[chunk_index]}, BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types of the elements in the chunk at \c chunk_index
+   */
+  template <typename... ViewValueTs> View<std::tuple<const ViewValueTs...>> chunk(const std::size_t chunk_index) const
+  {
+    return View<std::tuple<const ViewValueTs...>>{
+      std::tuple<const ViewValueTs*...>{std::get<ViewValueTs*>(chunks_[chunk_index])...},
+      BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @copydoc chunk
+   */
+  template <std::size_t... Indices>
+  View<const_tuple_select_t<value_type, Indices...>> chunk(const std::size_t chunk_index) const
+  {
+    return View<const_tuple_select_t<value_type, Indices...>>{
+      tuple_of_pointers_t<const_tuple_select_t<value_type, Indices...>>{std::get<Indices>(chunks_[chunk_index])...},
+      BasicSegmentedMultiFieldArray::chunk_length(chunk_index)};
+  }
+
+  /**
+   * @brief Calls \c chunk_fn with a view of each chunk which holds at least one element, in order
+   */
+  template <typename ChunkFnT> void for_each_chunk(ChunkFnT&& chunk_fn)
+  {
+    for (std::size_t chunk_index = 0; chunk_index < chunk_count(); ++chunk_index)
+    {
+      chunk_fn(BasicSegmentedMultiFieldArray::chunk(chunk_index));
+    }
+  }
+
+  /**
+   * @copydoc for_each_chunk
+   */
+  template <typename ChunkFnT> void for_each_chunk(ChunkFnT&& chunk_fn) const
+  {
+    for (std::size_t chunk_index = 0; chunk_index < chunk_count(); ++chunk_index)
+    {
+      chunk_fn(BasicSegmentedMultiFieldArray::chunk(chunk_index));
+    }
+  }
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline iterator begin() { return iterator{chunks_.data(), 0UL}; }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline iterator end() { return iterator{chunks_.data(), size_}; }
+
+  /**
+   * @copydoc begin
+   */
+  inline const_iterator begin() const { return const_iterator{chunks_.data(), 0UL}; }
+
+  /**
+   * @copydoc end
+   */
+  inline const_iterator end() const { return const_iterator{chunks_.data(), size_}; }
+
+  /**
+   * @copydoc begin
+   */
+  inline const_iterator cbegin() const { return const_iterator{chunks_.data(), 0UL}; }
+
+  /**
+   * @copydoc end
+   */
+  inline const_iterator cend() const { return const_iterator{chunks_.data(), size_}; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) { return *iterator{chunks_.data(), pos}; }
+
+  /**
+   * @copydoc operator[]
+   */
+  inline auto operator[](const std::size_t pos) const { return *const_iterator{chunks_.data(), pos}; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the container
+   */
+  inline auto at(const std::size_t pos)
+  {
+    if (pos >= size_)
+    {
+      throw std::out_of_range{"'pos' exceeds valid range of segmented multi-field array"};
+    }
+    return (*this)[pos];
+  }
+
+  /**
+   * @copydoc at
+   */
+  inline auto at(const std::size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      throw std::out_of_range{"'pos' exceeds valid range of segmented multi-field array"};
+    }
+    return (*this)[pos];
+  }
+
+  /**
+   * @brief Returns copy of allocator adapter
+   */
+  constexpr allocator_adapter_type get_allocator_adapter() const { return allocator_adapter_; }
+
+private:
+  /**
+   * @brief Returns the number of elements held by the chunk at \c chunk_index
+   */
+  inline std::size_t chunk_length(const std::size_t chunk_index) const
+  {
+    return std::min(ChunkSize, size_ - chunk_index * ChunkSize);
+  }
+
+  /**
+   * @brief Returns pointers to the chunk which holds the next element, allocating that chunk if needed
+   */
+  inline const std::tuple<Ts*...>& back_chunk_for_element_added()
+  {
+    if (size_ == capacity())
+    {
+      // Grow the chunk directory first, so that a failure there does not leak a newly allocated chunk
+      if (chunks_.size() == chunks_.capacity())
+      {
+        chunks_.reserve(std::max<std::size_t>(1UL, 2UL * chunks_.size()));
+      }
+      chunks_.emplace_back(allocator_adapter_.allocate(ChunkSize));
+    }
+    return chunks_[size_ / ChunkSize];
+  }
+
+  /**
+   * @brief Calls <code>range_fn(chunk_data, first, last)</code> for the part of each chunk which holds elements
+   *        in <code>[first, last)</code>, where \c first and \c last are offsets within that chunk
+   */
+  template <typename RangeFnT>
+  inline void for_each_chunk_range(std::size_t first, const std::size_t last, RangeFnT&& range_fn)
+  {
+    while (first < last)
+    {
+      const std::size_t chunk_index = first / ChunkSize;
+      const std::size_t chunk_first = chunk_index * ChunkSize;
+      range_fn(chunks_[chunk_index], first - chunk_first, std::min(ChunkSize, last - chunk_first));
+      first = chunk_first + ChunkSize;
+    }
+  }
+
+  /**
+   * @brief Value-initializes elements in <code>[first, last)</code> of a chunk
+   */
+  static void construct(const std::tuple<Ts*...>& chunk_data, const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        std::for_each(ptr + first, ptr + last, [](auto& element) { new (std::addressof(element)) ElementType{}; });
+      },
+      chunk_data);
+  }
+
+  /**
+   * @brief Copy-constructs elements in <code>[first, last)</code> of a chunk from each value in \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  static void construct(
+    const std::tuple<Ts*...>& chunk_data,
+    const std::size_t first,
+    const std::size_t last,
+    const CTorArgTupleT& ctor_arg_tuple)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr, const auto& other) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        // Simply assign fundamental types
+        if constexpr (std::is_fundamental_v<ElementType>)
+        {
+          std::fill(ptr + first, ptr + last, other);
+        }
+        else
+        {
+          std::for_each(
+            ptr + first, ptr + last, [&other](auto& element) { new (std::addressof(element)) ElementType{other}; });
+        }
+      },
+      chunk_data,
+      ctor_arg_tuple);
+  }
+
+  /**
+   * @brief Calls destructor on elements in <code>[first, last)</code> of a chunk
+   */
+  static void destroy(const std::tuple<Ts*...>& chunk_data, const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+          std::for_each(ptr + first, ptr + last, [](auto& element) { element.~ElementType(); });
+        }
+      },
+      chunk_data);
+  }
+
+  /**
+   * @brief Copy-constructs elements of \c other after all elements of this container, chunk-by-chunk
+   */
+  void append_copies(const BasicSegmentedMultiFieldArray& other)
+  {
+    MF_ASSERT(size_ % ChunkSize == 0);
+
+    BasicSegmentedMultiFieldArray::reserve(size_ + other.size_);
+    const std::size_t first_chunk_index = size_ / ChunkSize;
+    for (std::size_t chunk_index = 0; chunk_index < other.chunk_count(); ++chunk_index)
+    {
+      tuple_for_each(
+        [s = other.chunk_length(chunk_index)](auto* dst_ptr, const auto* src_ptr) {
+          using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+          // Copy bytes of trivially copyable types, call copy constructor for all others
+          if constexpr (std::is_trivially_copyable_v<ElementType>)
+          {
+            std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * s);
+          }
+          else
+          {
+            std::uninitialized_copy(src_ptr, src_ptr + s, dst_ptr);
+          }
+        },
+        chunks_[first_chunk_index + chunk_index],
+        other.chunks_[chunk_index]);
+      size_ += other.chunk_length(chunk_index);
+    }
+  }
+
+  /**
+   * @brief Takes all chunks from \c other, leaving it empty; this container must hold no chunks
+   */
+  inline void steal(BasicSegmentedMultiFieldArray& other)
+  {
+    chunks_ = std::move(other.chunks_);
+    size_ = other.size_;
+    other.chunks_.clear();
+    other.size_ = 0UL;
+  }
+
+  /**
+   * @brief Destroys all elements and de-allocates all chunks
+   */
+  void release()
+  {
+    BasicSegmentedMultiFieldArray::clear();
+    for (const auto& chunk_data : chunks_)
+    {
+      allocator_adapter_.deallocate(chunk_data, ChunkSize);
+    }
+    chunks_.clear();
+  }
+
+  /// Multi-field allocator adapter
+  allocator_adapter_type allocator_adapter_;
+
+  /// Pointers to the fields of each allocated chunk
+  std::vector<std::tuple<Ts*...>> chunks_;
+
+  /// The effective number of elements in the container
+  std::size_t size_;
+};
+
+/**
+ * @brief Convenience alias for a multi-field array which holds elements in chunks of \c ChunkSize elements, using
+ *        \c std::allocator to allocate each chunk
+ */
+template <std::size_t ChunkSize, typename... FieldTs>
+using segmented_multi_field_array =
+  BasicSegmentedMultiFieldArray<std::tuple<FieldTs...>, default_allocator_adapter<FieldTs...>, ChunkSize>;
+
+}  // namespace mf
@@ -0,0 +1,779 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/placement_new.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/trivially_relocatable.hpp>
+#include <mf/support/tuple_for_each.hpp>
+#include <mf/support/tuple_select.hpp>
+#include <mf/support/view.hpp>
+#include <mf/zip_iterator.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Uninitialized, suitably aligned storage for \c Capacity values of type \c T
+ */
+template <typename T, std::size_t Capacity> struct StaticFieldStorage
+{
+  alignas(T) std::uint8_t bytes[sizeof(T) * Capacity];
+
+  inline T* data() { return reinterpret_cast<T*>(bytes); }
+
+  inline const T* data() const { return reinterpret_cast<const T*>(bytes); }
+};
+
+/**
+ * @brief Multi-field array which holds up to \c Capacity elements of each field within the container
+ *
+ *        Each field has its own aligned storage, placed within the container object, so the container never
+ *        allocates memory. The location of each field is fixed relative to the container, and capacity is a
+ *        compile-time constant, so adding an element never needs to check whether memory must be re-allocated.
+ *
+ * @warn adding elements to a full container is undefined behavior; this is only checked by assertion
+ */
+template <typename... Ts, std::size_t Capacity> class BasicStaticMultiFieldArray<std::tuple<Ts...>, Capacity>
+{
+  static_assert(Capacity > 0, "Capacity must be greater than zero");
+
+public:
+  /// Tuple of field value types
+  using value_type = std::tuple<Ts...>;
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size to zero
+   */
+  BasicStaticMultiFieldArray() : size_{0} {}
+
+  /**
+   * @brief Creates \c count value-initialized elements
+   *
+   * @throws \c std::length_error  if \c count exceeds \c Capacity
+   */
+  explicit BasicStaticMultiFieldArray(std::size_t count) : size_{0} { BasicStaticMultiFieldArray::resize(count); }
+
+  /**
+   * @brief Creates \c count elements, copy-constructed from each value in \c ctor_arg_tuple
+   *
+   * @throws \c std::length_error  if \c count exceeds \c Capacity
+   */
+  template <typename CTorArgTupleT>
+  BasicStaticMultiFieldArray(std::size_t count, CTorArgTupleT&& ctor_arg_tuple) : size_{0}
+  {
+    BasicStaticMultiFieldArray::resize(count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+  }
+
+  BasicStaticMultiFieldArray(const BasicStaticMultiFieldArray& other) : size_{0}
+  {
+    BasicStaticMultiFieldArray::copy_construct(other);
+  }
+
+  BasicStaticMultiFieldArray(BasicStaticMultiFieldArray&& other) : size_{0}
+  {
+    BasicStaticMultiFieldArray::move_construct(other);
+  }
+
+  ~BasicStaticMultiFieldArray() { BasicStaticMultiFieldArray::clear(); }
+
+  /**
+   * @brief Replaces elements with copies of elements in \c other
+   */
+  BasicStaticMultiFieldArray& operator=(const BasicStaticMultiFieldArray& other)
+  {
+    if (this != std::addressof(other))
+    {
+      BasicStaticMultiFieldArray::clear();
+      BasicStaticMultiFieldArray::copy_construct(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Replaces elements with elements moved from \c other, leaving \c other empty
+   */
+  BasicStaticMultiFieldArray& operator=(BasicStaticMultiFieldArray&& other)
+  {
+    if (this != std::addressof(other))
+    {
+      BasicStaticMultiFieldArray::clear();
+      BasicStaticMultiFieldArray::move_construct(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   *
+   *        Elements are held within each container, so they are moved
+   */
+  inline void swap(BasicStaticMultiFieldArray& other)
+  {
+    BasicStaticMultiFieldArray other_moved{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(other_moved);
+  }
+
+  /**
+   * @brief Returns references to values at index for each specified field type
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<SingleValueT&>(BasicStaticMultiFieldArray::template data<SingleValueT>()[index]);
+    }
+    else
+    {
+      return std::tuple<ValueTs&...>{BasicStaticMultiFieldArray::template data<ValueTs>()[index]...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<const SingleValueT&>(BasicStaticMultiFieldArray::template data<SingleValueT>()[index]);
+    }
+    else
+    {
+      return std::tuple<const ValueTs&...>{BasicStaticMultiFieldArray::template data<ValueTs>()[index]...};
+    }
+  }
+
+  /**
+   * @brief Returns references to all fields of the first element
+   */
+  inline decltype(auto) front() { return *begin(); }
+
+  /**
+   * @copydoc front
+   */
+  inline decltype(auto) front() const { return *begin(); }
+
+  /**
+   * @brief Returns references to all fields of the last element
+   */
+  inline decltype(auto) back() { return *std::prev(end()); }
+
+  /**
+   * @copydoc back
+   */
+  inline decltype(auto) back() const { return *std::prev(end()); }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is the first argument.
+   *        All arguments which follow should be tuples of arguments used to construct values for each corresponding
+   *        field type
+   */
+  template <typename... PiecewiseFieldCTorTupleTs>
+  inline void emplace_back([[maybe_unused]] std::piecewise_construct_t _, PiecewiseFieldCTorTupleTs&&... ctor_args)
+  {
+    static_assert(sizeof...(Ts) == sizeof...(PiecewiseFieldCTorTupleTs), "Should be construct args for each type");
+    MF_ASSERT(size_ < Capacity);
+
+    // Contruct new element past the previous last element
+    tuple_for_each(
+      [s = size_](auto* const ptr, auto&& ctor_arg_tuple) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        mf::apply_placement_new<ElementType>(ptr + s, std::forward<decltype(ctor_arg_tuple)>(ctor_arg_tuple));
+      },
+      BasicStaticMultiFieldArray::data(),
+      std::forward_as_tuple(ctor_args...));
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is NOT the first
+   *        argument. All arguments should be lvalue or rvalue references to values used to copy/move construct
+   *        values for each corresponding field type; if no arguments are given, all fields are value-initialized
+   */
+  template <typename... FieldCopyOrMoveCTorTs>
+  inline void emplace_back(FieldCopyOrMoveCTorTs&&... copy_or_move_ctor_args)
+  {
+    static_assert(
+      (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts)) or (sizeof...(FieldCopyOrMoveCTorTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+    MF_ASSERT(size_ < Capacity);
+
+    // Contruct new element past the previous last element
+    if constexpr (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts))
+    {
+      tuple_for_each(
+        [s = size_](auto* const ptr, auto&& ctor_arg) {
+          using ElementType = pointer_element_t<decltype(ptr)>;
+
+          // Simply assign fundamental types
+          if constexpr (std::is_fundamental_v<ElementType>)
+          {
+            *(ptr + s) = std::forward<decltype(ctor_arg)>(ctor_arg);
+          }
+          else
+          {
+            new (ptr + s) ElementType{std::forward<decltype(ctor_arg)>(ctor_arg)};
+          }
+        },
+        BasicStaticMultiFieldArray::data(),
+        std::forward_as_tuple(std::forward<FieldCopyOrMoveCTorTs>(copy_or_move_ctor_args)...));
+    }
+    else
+    {
+      BasicStaticMultiFieldArray::construct(size_, size_ + 1UL);
+    }
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   */
+  void push_back(const value_type& value)
+  {
+    std::apply([this](const auto&... fields) { this->emplace_back(fields...); }, value);
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    BasicStaticMultiFieldArray::destroy(size_ - 1UL, size_);
+    --size_;
+  }
+
+  /**
+   * @brief Erases element at \c position
+   *
+   * @tparam PositionT  iterator or integer index type
+   *
+   * @param position  iterator or index to erase
+   *
+   * @return iterator to new element following position after erasure
+   */
+  template <typename PositionT> inline decltype(auto) erase(PositionT position)
+  {
+    const std::ptrdiff_t position_as_offset = BasicStaticMultiFieldArray::get_offset(position);
+    BasicStaticMultiFieldArray::erase_range(position_as_offset, position_as_offset + 1);
+    return BasicStaticMultiFieldArray::at_offset(position, position_as_offset);
+  }
+
+  /**
+   * @brief Erases elements in <code>[first, last)</code>
+   *
+   * @tparam PositionT  iterator or integer index type
+   *
+   * @param first  iterator of first element to erase
+   * @param last  one past last iterator of last element to erase
+   *
+   * @return iterator to new element following position after erasure
+   *
+   * @warn last >= first
+   */
+  template <typename PositionT> inline decltype(auto) erase(PositionT first, PositionT last)
+  {
+    const std::ptrdiff_t first_as_offset = BasicStaticMultiFieldArray::get_offset(first);
+    BasicStaticMultiFieldArray::erase_range(first_as_offset, BasicStaticMultiFieldArray::get_offset(last));
+    return BasicStaticMultiFieldArray::at_offset(first, first_as_offset);
+  }
+
+  /**
+   * @brief Resizes each field array to the given size, \c new_size
+   *
+   *        If \c new_size is larger than \c size(), then new elements are value-initialized, or copy-constructed
+   *        from each value in \c ctor_arg_tuple, if provided. If \c new_size is smaller than \c size(), then all
+   *        tail elements past \c new_size are destroyed.
+   *
+   * @throws \c std::length_error  if \c new_size exceeds \c Capacity
+   */
+  template <typename... CTorArgTupleT> void resize(const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+
+    if (new_size > Capacity)
+    {
+      throw std::length_error{"'new_size' exceeds capacity of static multi-field array"};
+    }
+    else if (new_size < size_)
+    {
+      BasicStaticMultiFieldArray::destroy(new_size, size_);
+    }
+    else
+    {
+      BasicStaticMultiFieldArray::construct(size_, new_size, ctor_arg_tuple...);
+    }
+
+    size_ = new_size;
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0
+   */
+  inline void clear()
+  {
+    BasicStaticMultiFieldArray::destroy(0UL, size_);
+    size_ = 0UL;
+  }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns true when element count is equal to \c Capacity (container is full)
+   */
+  inline bool full() const { return size_ == Capacity; }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which the container can hold
+   */
+  static constexpr std::size_t capacity() { return Capacity; }
+
+  /**
+   * @brief Returns the largest number of elements which the container can hold
+   */
+  static constexpr std::size_t max_size() { return Capacity; }
+
+  /**
+   * @brief Returns a pointer to the first element of the field at \c Index
+   */
+  template <std::size_t Index> inline auto* data() { return std::get<Index>(storage_).data(); }
+
+  /**
+   * @copydoc data
+   */
+  template <std::size_t Index> inline const auto* data() const { return std::get<Index>(storage_).data(); }
+
+  /**
+   * @brief Returns a pointer to the first element of the field with type \c ValueT
+   */
+  template <typename ValueT> inline ValueT* data()
+  {
+    return std::get<StaticFieldStorage<ValueT, Capacity>>(storage_).data();
+  }
+
+  /**
+   * @copydoc data
+   */
+  template <typename ValueT> inline const ValueT* data() const
+  {
+    return std::get<StaticFieldStorage<ValueT, Capacity>>(storage_).data();
+  }
+
+  /**
+   * @brief Returns pointers to the first element of each field
+   */
+  inline std::tuple<Ts*...> data()
+  {
+    return std::apply([](auto&... storage) { return std::tuple<Ts*...>{storage.data()...}; }, storage_);
+  }
+
+  /**
+   * @copydoc data
+   */
+  inline std::tuple<const Ts*...> data() const
+  {
+    return std::apply([](const auto&... storage) { return std::tuple<const Ts*...>{storage.data()...}; }, storage_);
+  }
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline auto begin() { return view().begin(); }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline auto end() { return view().end(); }
+
+  /**
+   * @copydoc begin
+   */
+  inline auto begin() const { return view().begin(); }
+
+  /**
+   * @copydoc end
+   */
+  inline auto end() const { return view().end(); }
+
+  /**
+   * @copydoc begin
+   */
+  inline auto cbegin() const { return view().begin(); }
+
+  /**
+   * @copydoc end
+   */
+  inline auto cend() const { return view().end(); }
+
+  /**
+   * @brief Returns pointer to first element of a particular field
+   */
+  template <std::size_t Index> inline auto* begin() { return BasicStaticMultiFieldArray::template data<Index>(); }
+
+  /**
+   * @copydoc begin
+   */
+  template <typename ValueT> inline ValueT* begin() { return BasicStaticMultiFieldArray::template data<ValueT>(); }
+
+  /**
+   * @copydoc begin
+   */
+  template <std::size_t Index> inline const auto* begin() const
+  {
+    return BasicStaticMultiFieldArray::template data<Index>();
+  }
+
+  /**
+   * @copydoc begin
+   */
+  template <typename ValueT> inline const ValueT* begin() const
+  {
+    return BasicStaticMultiFieldArray::template data<ValueT>();
+  }
+
+  /**
+   * @brief Returns pointer to one past the last element of a particular field
+   */
+  template <std::size_t Index> inline auto* end()
+  {
+    return BasicStaticMultiFieldArray::template begin<Index>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <typename ValueT> inline ValueT* end()
+  {
+    return BasicStaticMultiFieldArray::template begin<ValueT>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <std::size_t Index> inline const auto* end() const
+  {
+    return BasicStaticMultiFieldArray::template begin<Index>() + size_;
+  }
+
+  /**
+   * @copydoc end
+   */
+  template <typename ValueT> inline const ValueT* end() const
+  {
+    return BasicStaticMultiFieldArray::template begin<ValueT>() + size_;
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  View<std::tuple<Ts...>> view() { return View<std::tuple<Ts...>>{BasicStaticMultiFieldArray::data(), size_}; }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs> View<std::tuple<ViewValueTs...>> view()
+  {
+    return View<std::tuple<ViewValueTs...>>{
+      std::forward_as_tuple(BasicStaticMultiFieldArray::template data<ViewValueTs>()...), size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> View<tuple_select_t<value_type, Indices...>> view()
+  {
+    return View<tuple_select_t<value_type, Indices...>>{
+      std::forward_as_tuple(BasicStaticMultiFieldArray::template data<Indices>()...), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  View<std::tuple<const Ts...>> view() const
+  {
+    return View<std::tuple<const Ts...>>{BasicStaticMultiFieldArray::data(), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs> View<std::tuple<const ViewValueTs...>> view() const
+  {
+    return View<std::tuple<const ViewValueTs...>>{
+      std::forward_as_tuple(BasicStaticMultiFieldArray::template data<ViewValueTs>()...), size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices> View<const_tuple_select_t<value_type, Indices...>> view() const
+  {
+    return View<const_tuple_select_t<value_type, Indices...>>{
+      std::forward_as_tuple(BasicStaticMultiFieldArray::template data<Indices>()...), size_};
+  }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) { return view()[pos]; }
+
+  /**
+   * @copydoc operator[]
+   */
+  inline auto operator[](const std::size_t pos) const { return view()[pos]; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the container
+   */
+  inline auto at(const std::size_t pos) { return view().at(pos); }
+
+  /**
+   * @copydoc at
+   */
+  inline auto at(const std::size_t pos) const { return view().at(pos); }
+
+private:
+  /**
+   * @brief Returns element offset from start
+   */
+  constexpr std::ptrdiff_t get_offset(const std::size_t index) const { return index; }
+
+  /**
+   * @brief Returns element offset from start
+   */
+  inline std::ptrdiff_t get_offset(ZipIterator<std::tuple<Ts*...>> iterator)
+  {
+    return std::distance(BasicStaticMultiFieldArray::begin(), iterator);
+  }
+
+  /**
+   * @brief Returns position offset from start
+   */
+  constexpr std::size_t at_offset([[maybe_unused]] const std::size_t _, const std::ptrdiff_t offset) const
+  {
+    return offset;
+  }
+
+  /**
+   * @brief Returns iterator offset from start
+   */
+  inline ZipIterator<std::tuple<Ts*...>>
+  at_offset([[maybe_unused]] ZipIterator<std::tuple<Ts*...>> _, const std::ptrdiff_t offset)
+  {
+    return std::next(BasicStaticMultiFieldArray::begin(), offset);
+  }
+
+  /**
+   * @brief Value-initializes elements in <code>[first, last)</code>
+   */
+  inline void construct(const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        std::for_each(ptr + first, ptr + last, [](auto& element) { new (std::addressof(element)) ElementType{}; });
+      },
+      BasicStaticMultiFieldArray::data());
+  }
+
+  /**
+   * @brief Copy-constructs elements in <code>[first, last)</code> from each value in \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  inline void construct(const std::size_t first, const std::size_t last, const CTorArgTupleT& ctor_arg_tuple)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr, const auto& other) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        // Simply assign fundamental types
+        if constexpr (std::is_fundamental_v<ElementType>)
+        {
+          std::fill(ptr + first, ptr + last, other);
+        }
+        else
+        {
+          std::for_each(
+            ptr + first, ptr + last, [&other](auto& element) { new (std::addressof(element)) ElementType{other}; });
+        }
+      },
+      BasicStaticMultiFieldArray::data(),
+      ctor_arg_tuple);
+  }
+
+  /**
+   * @brief Copy-constructs all elements of \c other; the container must be empty
+   */
+  inline void copy_construct(const BasicStaticMultiFieldArray& other)
+  {
+    tuple_for_each(
+      [s = other.size_](auto* dst_ptr, const auto* src_ptr) {
+        using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+        // Copy bytes of trivially copyable types, call copy constructor for all others
+        if constexpr (std::is_trivially_copyable_v<ElementType>)
+        {
+          std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * s);
+        }
+        else
+        {
+          std::uninitialized_copy(src_ptr, src_ptr + s, dst_ptr);
+        }
+      },
+      BasicStaticMultiFieldArray::data(),
+      other.data());
+    size_ = other.size_;
+  }
+
+  /**
+   * @brief Moves all elements of \c other, leaving \c other empty; the container must be empty
+   */
+  inline void move_construct(BasicStaticMultiFieldArray& other)
+  {
+    tuple_for_each(
+      [s = other.size_](auto* dst_ptr, auto* src_ptr) {
+        using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+        // Move bytes of trivially relocatable types, call move constructor for all others
+        if constexpr (is_trivially_relocatable_v<ElementType>)
+        {
+          relocate_bytes(dst_ptr, src_ptr, s);
+        }
+        else
+        {
+          std::uninitialized_move(src_ptr, src_ptr + s, dst_ptr);
+          std::for_each(src_ptr, src_ptr + s, [](auto& element) { element.~ElementType(); });
+        }
+      },
+      BasicStaticMultiFieldArray::data(),
+      other.data());
+    size_ = other.size_;
+    other.size_ = 0UL;
+  }
+
+  /**
+   * @brief Calls destructor on elements in <code>[first, last)</code>
+   */
+  inline void destroy(const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+          std::for_each(ptr + first, ptr + last, [](auto& element) { element.~ElementType(); });
+        }
+      },
+      BasicStaticMultiFieldArray::data());
+  }
+
+  /**
+   * @brief Erases elements in <code>[first, last)</code>, shifting all elements after them leftward
+   */
+  inline void erase_range(const std::ptrdiff_t first, const std::ptrdiff_t last)
+  {
+    const std::ptrdiff_t distance = last - first;
+    if (distance == 0)
+    {
+      return;
+    }
+
+    tuple_for_each(
+      [&](auto* const dptr) {
+        using ElementType = pointer_element_t<decltype(dptr)>;
+
+        // Location of the first element to be erased
+        auto* const element_ptr = dptr + first;
+
+        // Destroy erased elements and shift elements after them as bytes
+        if constexpr (is_trivially_relocatable_v<ElementType>)
+        {
+          if constexpr (!std::is_trivially_destructible_v<ElementType>)
+          {
+            std::for_each(element_ptr, element_ptr + distance, [](auto& e) { e.~ElementType(); });
+          }
+          relocate_bytes(element_ptr, element_ptr + distance, size_ - last);
+        }
+        else
+        {
+          // Move elements after erased elements
+          std::move(element_ptr + distance, dptr + size_, element_ptr);
+
+          // Destroy trailing elements
+          std::for_each(dptr + size_ - distance, dptr + size_, [](auto& e) { e.~ElementType(); });
+        }
+      },
+      BasicStaticMultiFieldArray::data());
+
+    size_ -= distance;
+  }
+
+  /// Storage for each field
+  std::tuple<StaticFieldStorage<Ts, Capacity>...> storage_;
+
+  /// The effective number of elements in each field
+  std::size_t size_;
+};
+
+/**
+ * @brief Convenience alias for a multi-field array which holds up to \c Capacity elements, and never allocates memory
+ */
+template <std::size_t Capacity, typename... FieldTs>
+using static_multi_field_array = BasicStaticMultiFieldArray<std::tuple<FieldTs...>, Capacity>;
+
+}  // namespace mf
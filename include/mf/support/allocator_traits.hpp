@@ -0,0 +1,122 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace mf
+{
+
+/**
+ * @brief Checks if \c AllocatorT provides <code>reallocate(pointer, old_n, new_n)</code>
+ *
+ *        Such an allocator may grow or shrink an allocation without an intermediate copy by the caller,
+ *        possibly changing its address, where values in the allocation are preserved as bytes
+ */
+template <typename AllocatorT, typename = void> struct has_reallocate : std::false_type
+{};
+
+/**
+ * @copydoc has_reallocate
+ */
+template <typename AllocatorT>
+struct has_reallocate<
+  AllocatorT,
+  std::void_t<decltype(std::declval<AllocatorT&>().reallocate(
+    std::declval<typename std::allocator_traits<AllocatorT>::pointer>(),
+    std::declval<std::size_t>(),
+    std::declval<std::size_t>()))>> : std::true_type
+{};
+
+/**
+ * @copydoc has_reallocate
+ */
+template <typename AllocatorT> static constexpr bool has_reallocate_v = has_reallocate<AllocatorT>::value;
+
+/**
+ * @brief Checks if \c AllocatorT provides <code>allocate_zeroed(n)</code>
+ *
+ *        Such an allocator returns memory which is filled with zero bytes, typically obtained from the system
+ *        (e.g. with \c std::calloc) without writing to it
+ */
+template <typename AllocatorT, typename = void> struct has_allocate_zeroed : std::false_type
+{};
+
+/**
+ * @copydoc has_allocate_zeroed
+ */
+template <typename AllocatorT>
+struct has_allocate_zeroed<
+  AllocatorT,
+  std::void_t<decltype(std::declval<AllocatorT&>().allocate_zeroed(std::declval<std::size_t>()))>> : std::true_type
+{};
+
+/**
+ * @copydoc has_allocate_zeroed
+ */
+template <typename AllocatorT> static constexpr bool has_allocate_zeroed_v = has_allocate_zeroed<AllocatorT>::value;
+
+/**
+ * @brief Allocates memory from \c AllocatorT with a requested alignment, where the allocator supports it
+ *
+ *        By default, allocations are assumed to be aligned to \c alignof(std::max_align_t), and the requested
+ *        alignment is ignored
+ */
+template <typename AllocatorT> struct aligned_allocator_traits
+{
+  using pointer = typename std::allocator_traits<AllocatorT>::pointer;
+
+  /// Largest alignment which allocations are guaranteed to satisfy
+  static constexpr std::size_t max_alignment = alignof(std::max_align_t);
+
+  static pointer allocate(AllocatorT& allocator, const std::size_t n, [[maybe_unused]] const std::size_t alignment)
+  {
+    return allocator.allocate(n);
+  }
+
+  static void
+  deallocate(AllocatorT& allocator, pointer ptr, const std::size_t n, [[maybe_unused]] const std::size_t alignment)
+  {
+    allocator.deallocate(ptr, n);
+  }
+};
+
+/**
+ * @copydoc aligned_allocator_traits
+ *
+ *          \c std::pmr::polymorphic_allocator only requests the alignment of its value type, so the requested
+ *          alignment is passed to its memory resource directly
+ */
+template <typename T> struct aligned_allocator_traits<std::pmr::polymorphic_allocator<T>>
+{
+  using pointer = T*;
+
+  /// Allocations satisfy any requested alignment
+  static constexpr std::size_t max_alignment = std::numeric_limits<std::size_t>::max();
+
+  static pointer
+  allocate(std::pmr::polymorphic_allocator<T>& allocator, const std::size_t n, const std::size_t alignment)
+  {
+    return static_cast<pointer>(allocator.resource()->allocate(sizeof(T) * n, std::max(alignment, alignof(T))));
+  }
+
+  static void deallocate(
+    std::pmr::polymorphic_allocator<T>& allocator,
+    pointer ptr,
+    const std::size_t n,
+    const std::size_t alignment)
+  {
+    allocator.resource()->deallocate(static_cast<void*>(ptr), sizeof(T) * n, std::max(alignment, alignof(T)));
+  }
+};
+
+}  // namespace mf
@@ -0,0 +1,175 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mf
+{
+
+/**
+ * @brief Size of a cache line, in bytes, on most common targets
+ */
+static constexpr std::size_t cache_line_size = 64UL;
+
+/**
+ * @brief Size of a memory page, in bytes, on most common targets
+ */
+static constexpr std::size_t page_size = 4096UL;
+
+/**
+ * @brief Size of a huge page, in bytes, on most common targets
+ */
+static constexpr std::size_t huge_page_size = 2UL * 1024UL * 1024UL;
+
+/**
+ * @brief Rounds \c value up to the next multiple of \c alignment
+ *
+ * @warn \c alignment must be a power of two
+ */
+constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment)
+{
+  return (value + alignment - 1UL) & ~(alignment - 1UL);
+}
+
+/**
+ * @brief Returns true if \c value is a non-zero power of two
+ */
+constexpr bool is_power_of_two(const std::size_t value) { return value != 0UL and (value & (value - 1UL)) == 0UL; }
+
+/**
+ * @brief Describes how segments for each field value type are laid out within a single block of memory
+ *
+ *        Each segment holds \c n values of a single field type. Segments are placed back-to-back in the
+ *        order of \c ValueTs, where the start of each segment is padded to the larger of the alignment of
+ *        its value type and \c SegmentAlignment
+ */
+template <typename ValueTs, std::size_t SegmentAlignment> struct SinglePassLayout;
+
+/**
+ * @copydoc SinglePassLayout
+ */
+template <typename... ValueTs, std::size_t SegmentAlignment>
+struct SinglePassLayout<std::tuple<ValueTs...>, SegmentAlignment>
+{
+  static_assert(sizeof...(ValueTs) > 0, "Layout must have at least one field");
+  static_assert(is_power_of_two(SegmentAlignment), "SegmentAlignment must be a power of two");
+
+  /// Number of segments in the layout
+  static constexpr std::size_t segment_count = sizeof...(ValueTs);
+
+  /// Size of a single value in each segment
+  static constexpr std::array<std::size_t, segment_count> value_sizes = {sizeof(ValueTs)...};
+
+  /// Effective alignment of the start of a segment which holds values of type \c ValueT
+  template <typename ValueT>
+  static constexpr std::size_t segment_alignment_of =
+    (alignof(ValueT) > SegmentAlignment) ? alignof(ValueT) : SegmentAlignment;
+
+  /// Effective alignment of the start of each segment
+  static constexpr std::array<std::size_t, segment_count> segment_alignments = {segment_alignment_of<ValueTs>...};
+
+  /// Alignment required of the start of the block, such that all segments are aligned
+  static constexpr std::size_t block_alignment = std::max({segment_alignment_of<ValueTs>...});
+
+  /// Byte offsets of the start of each segment within a block
+  using offset_array_type = std::array<std::size_t, segment_count>;
+
+  /**
+   * @brief Returns the byte offsets of all segments for a block holding \c n values of each field
+   */
+  static constexpr offset_array_type offsets(const std::size_t n)
+  {
+    offset_array_type segment_offsets{};
+    std::size_t segment_offset = 0UL;
+    for (std::size_t i = 0; i < segment_count; ++i)
+    {
+      segment_offset = align_up(segment_offset, segment_alignments[i]);
+      segment_offsets[i] = segment_offset;
+      segment_offset += value_sizes[i] * n;
+    }
+    return segment_offsets;
+  }
+
+  /**
+   * @brief Returns the byte offset of the segment at \c index for a block holding \c n values of each field
+   */
+  static constexpr std::size_t offset(const std::size_t index, const std::size_t n) { return offsets(n)[index]; }
+
+  /**
+   * @brief Returns the total length, in bytes, of a block holding \c n values of each field
+   */
+  static constexpr std::size_t length(const std::size_t n)
+  {
+    return offset(segment_count - 1UL, n) + value_sizes[segment_count - 1UL] * n;
+  }
+
+  /**
+   * @brief Returns pointers to the start of each segment in a block, starting at \c block, with \c n values per field
+   */
+  static std::tuple<ValueTs*...> segments(std::uint8_t* const block, const std::size_t n)
+  {
+    return segments(block, n, std::make_index_sequence<segment_count>{});
+  }
+
+  /**
+   * @brief Moves the first \c size values of each segment in \c block from their positions in a layout for
+   *        \c from_n values per field, to their positions in a layout for \c to_n values per field
+   *
+   * @warn values are moved as bytes, and must be trivially relocatable
+   */
+  static void move_segments(
+    std::uint8_t* const block,
+    const std::size_t size,
+    const std::size_t from_n,
+    const std::size_t to_n)
+  {
+    if (size == 0UL or from_n == to_n)
+    {
+      return;
+    }
+
+    const auto from_offsets = offsets(from_n);
+    const auto to_offsets = offsets(to_n);
+
+    const auto move_segment = [&](const std::size_t index) {
+      std::memmove(block + to_offsets[index], block + from_offsets[index], value_sizes[index] * size);
+    };
+
+    // Segments move rightward when growing, so start from the last segment to avoid overwriting unmoved values
+    if (to_n > from_n)
+    {
+      for (std::size_t index = segment_count - 1UL; index > 0UL; --index)
+      {
+        move_segment(index);
+      }
+    }
+    else
+    {
+      for (std::size_t index = 1UL; index < segment_count; ++index)
+      {
+        move_segment(index);
+      }
+    }
+  }
+
+private:
+  template <std::size_t... Indices>
+  static std::tuple<ValueTs*...>
+  segments(std::uint8_t* const block, const std::size_t n, std::index_sequence<Indices...> _)
+  {
+    const auto segment_offsets = offsets(n);
+    return std::tuple<ValueTs*...>{reinterpret_cast<ValueTs*>(block + std::get<Indices>(segment_offsets))...};
+  }
+};
+
+}  // namespace mf
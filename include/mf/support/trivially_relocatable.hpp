@@ -0,0 +1,62 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace mf
+{
+
+/**
+ * @brief Trait which indicates that moving a \c T to a new address, then ending the lifetime of the original
+ *        without calling its destructor, is equivalent to copying its bytes
+ *
+ *        Defaults to \c std::is_trivially_copyable. May be specialized (opted-in) for types which are not
+ *        trivially copyable, but which do not hold pointers into themselves, like so:
+ * \n
+ *        @code{.cpp}
+ *        namespace mf
+ *        {
+ *        template <> struct is_trivially_relocatable<MyHandle> : std::true_type {};
+ *        }
+ *        @endcode
+ *
+ * @warn  \c std::string must not be opted-in when building against libstdc++, since its short-string buffer
+ *        is referenced by a pointer held within the string itself
+ */
+template <typename T> struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{};
+
+/**
+ * @copydoc is_trivially_relocatable
+ *
+ *          \c std::unique_ptr with the default deleter is a single owning pointer
+ */
+template <typename T> struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+{};
+
+/**
+ * @copydoc is_trivially_relocatable
+ */
+template <typename T> static constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/**
+ * @brief Moves \c n values from \c src to uninitialized memory at \c dst by copying their bytes
+ *
+ *        The lifetimes of values at \c src are ended without calling any destructors. \c src and \c dst may overlap.
+ */
+template <typename T> inline void relocate_bytes(T* const dst, const T* const src, const std::size_t n)
+{
+  static_assert(is_trivially_relocatable_v<T>, "T must be trivially relocatable");
+  if (n != 0UL)
+  {
+    std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+  }
+}
+
+}  // namespace mf
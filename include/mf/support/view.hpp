@@ -55,6 +55,79 @@ public:
     return ZipIterator<std::tuple<const Ts*...>>{data_last};
   }
 
+  /**
+   * @brief Returns a range over the elements represented in the view, which iterates using a single index shared by
+   *        all fields, rather than one pointer per field
+   *
+   *        Prefer this for loops over many fields, where stepping each pointer would need one register per field
+   */
+  inline IndexedZipRange<std::tuple<Ts*...>> indexed() { return IndexedZipRange<std::tuple<Ts*...>>{data_, size_}; }
+
+  /**
+   * @copydoc indexed
+   */
+  inline IndexedZipRange<std::tuple<const Ts*...>> indexed() const
+  {
+    return IndexedZipRange<std::tuple<const Ts*...>>{data_, size_};
+  }
+
+  /**
+   * @brief Calls \c batch_callback for each run of \c Width elements, then once for any remaining elements
+   *
+   *        Callback takes an element count, followed by a pointer to the first element of each field in the run.
+   *        For full runs, the count is a <code>std::integral_constant<std::size_t, Width></code>, so loops over
+   *        it have a fixed trip count and may be unrolled and vectorized; for the tail, the count is a
+   *        \c std::size_t less than \c Width. A kernel written once is compiled for both, like so:
+   * \n
+   *        @code{.cpp}
+   *        view.for_each_batch<8>([](auto n, float* x, const float* dx) {
+   *          for (std::size_t i = 0; i < n; ++i) { x[i] += dx[i]; }
+   *        });
+   *        @endcode
+   */
+  template <std::size_t Width, typename BatchCallbackT> inline void for_each_batch(BatchCallbackT&& batch_callback)
+  {
+    View::for_each_batch_of<Width>(data_, size_, std::forward<BatchCallbackT>(batch_callback));
+  }
+
+  /**
+   * @copydoc for_each_batch
+   */
+  template <std::size_t Width, typename BatchCallbackT>
+  inline void for_each_batch(BatchCallbackT&& batch_callback) const
+  {
+    View::for_each_batch_of<Width>(
+      std::tuple<const Ts*...>{data_}, size_, std::forward<BatchCallbackT>(batch_callback));
+  }
+
+  /**
+   * @brief Returns a view of \c count elements of this view, starting at \c pos
+   *
+   * @throws \c std::out_of_range  if <code>[pos, pos + count)</code> exceeds bounds of the view
+   */
+  inline View subview(const std::size_t pos, const std::size_t count)
+  {
+    return View{View::data_at(pos, count), count};
+  }
+
+  /**
+   * @copydoc subview
+   */
+  inline View<std::tuple<const Ts...>> subview(const std::size_t pos, const std::size_t count) const
+  {
+    return View<std::tuple<const Ts...>>{View::data_at(pos, count), count};
+  }
+
+  /**
+   * @brief Returns pointers to the first element of each field in the view
+   */
+  inline const std::tuple<Ts*...>& data() { return data_; }
+
+  /**
+   * @copydoc data
+   */
+  inline std::tuple<const Ts*...> data() const { return data_; }
+
   /**
    * @brief Returns the number of elements represented in the view
    *
@@ -131,8 +204,62 @@ private:
   template <typename FieldTs, typename CapacityIncreasePolicy, typename AllocatorAdapterT>
   friend class BasicMultiFieldArray;
 
+  template <typename FieldTs, typename AllocatorAdapterT, typename CapacityIncreasePolicy, typename SizeT>
+  friend class BasicCompactMultiFieldArray;
+
+  template <typename FieldTs, std::size_t Capacity> friend class BasicStaticMultiFieldArray;
+
+  template <typename FieldTs, typename AllocatorAdapterT, std::size_t ChunkSize>
+  friend class BasicSegmentedMultiFieldArray;
+
+  template <typename FieldTs, std::size_t TileSize, std::size_t TileStride> friend class TileIterator;
+
   View(const std::tuple<Ts*...>& data, const std::size_t size) : data_{data}, size_{size} {}
 
+  template <typename FieldTs> friend class View;
+
+  /**
+   * @brief Returns pointers to element \c pos of each field, where \c count elements must follow in the view
+   */
+  inline std::tuple<Ts*...> data_at(const std::size_t pos, const std::size_t count) const
+  {
+    if (pos > size_ or count > size_ - pos)
+    {
+      throw std::out_of_range{"'pos' and 'count' exceed valid range of view"};
+    }
+    auto data_at_pos = data_;
+    tuple_for_each([pos](auto& ptr) { ptr += pos; }, data_at_pos);
+    return data_at_pos;
+  }
+
+  /**
+   * @brief Implements \c for_each_batch over field pointers \c data to \c size elements
+   */
+  template <std::size_t Width, typename PointersT, typename BatchCallbackT>
+  static inline void for_each_batch_of(const PointersT& data, const std::size_t size, BatchCallbackT&& batch_callback)
+  {
+    static_assert(Width > 0, "Width must be greater than zero");
+
+    const std::size_t full_size = size - size % Width;
+    for (std::size_t offset = 0; offset < full_size; offset += Width)
+    {
+      std::apply(
+        [&batch_callback, offset](auto*... ptrs) {
+          batch_callback(std::integral_constant<std::size_t, Width>{}, (ptrs + offset)...);
+        },
+        data);
+    }
+
+    if (full_size != size)
+    {
+      std::apply(
+        [&batch_callback, full_size, tail_size = size - full_size](auto*... ptrs) {
+          batch_callback(tail_size, (ptrs + full_size)...);
+        },
+        data);
+    }
+  }
+
   /// Pointers to field data
   std::tuple<Ts*...> data_;
 
@@ -0,0 +1,456 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// MF
+#include <mf/support/single_pass_layout.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Fixed set of worker threads which run index-range partitioned jobs
+ *
+ *        Each job splits an index range into contiguous chunks, one per participating thread, where the calling
+ *        thread runs the first chunk. The same range is always split the same way, so that a chunk of memory which
+ *        is first touched by one thread (and placed on that thread's NUMA node) is processed by the same thread in
+ *        later jobs over the same range.
+ *
+ *        Jobs may be started from within a job on the same pool, such as by a nested \c parallel_for. Since all
+ *        threads of the pool are busy with the enclosing job, nested jobs run all of their chunks on the calling
+ *        thread.
+ */
+class ThreadPool
+{
+public:
+  /// Smallest number of indices which are worth running on a separate thread, by default
+  static constexpr std::size_t default_min_chunk_size = 4096UL;
+
+  /// Number of indices in each block of parallel_for_stealing, by default
+  static constexpr std::size_t default_block_size = 256UL;
+
+  /// Time which each run of blocks claimed in parallel_for_stealing should take to process
+  static constexpr std::chrono::microseconds target_claim_duration{50};
+
+  /**
+   * @brief Starts <code>thread_count - 1</code> worker threads; the calling thread participates in all jobs
+   *
+   *        A \c thread_count of zero is treated as one, so that jobs run entirely on the calling thread.
+   *
+   * @throws \c std::system_error  if a worker thread could not be started; workers which were started are stopped
+   */
+  explicit ThreadPool(const std::size_t thread_count = std::max(1U, std::thread::hardware_concurrency())) :
+      job_{nullptr},
+      job_chunk_count_{0UL},
+      job_generation_{0UL},
+      job_remaining_{0UL},
+      stopped_{false}
+  {
+    try
+    {
+      workers_.reserve(std::max(1UL, thread_count) - 1UL);
+      for (std::size_t worker_index = 1; worker_index < thread_count; ++worker_index)
+      {
+        workers_.emplace_back([this, worker_index] { ThreadPool::work(worker_index); });
+      }
+    }
+    catch (...)
+    {
+      ThreadPool::stop();
+      throw;
+    }
+  }
+
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool(const ThreadPool&) = delete;
+
+  ~ThreadPool() { ThreadPool::stop(); }
+
+  /**
+   * @brief Returns the number of threads which participate in jobs, including the calling thread
+   */
+  std::size_t size() const { return workers_.size() + 1UL; }
+
+  /**
+   * @brief Calls <code>range_fn(first, last)</code> on contiguous chunks which cover <code>[0, n)</code>, in
+   *        parallel, and waits for all chunks to finish
+   *
+   *        Chunks are no smaller than \c min_chunk_size indices, so small ranges run on fewer threads, or entirely on
+   *        the calling thread. If any call to \c range_fn throws, the first exception is rethrown once all chunks
+   *        have finished.
+   */
+  template <typename RangeFnT>
+  void parallel_for(const std::size_t n, RangeFnT&& range_fn, const std::size_t min_chunk_size = default_min_chunk_size)
+  {
+    const std::size_t chunk_count = std::min(size(), std::max(1UL, n / std::max(1UL, min_chunk_size)));
+    if (chunk_count == 1UL)
+    {
+      range_fn(0UL, n);
+      return;
+    }
+
+    ThreadPool::run(chunk_count, [&](const std::size_t chunk_index) {
+      range_fn(
+        ThreadPool::chunk_first(chunk_index, chunk_count, n),
+        ThreadPool::chunk_first(chunk_index + 1UL, chunk_count, n));
+    });
+  }
+
+  /**
+   * @brief Calls <code>range_fn(first, last)</code> on runs of whole blocks which cover <code>[0, n)</code>, in
+   *        parallel, balancing work between threads by stealing, and waits for all blocks to finish
+   *
+   *        Block boundaries fall on <code>block_offset + k * block_size</code>, so <code>[0, n)</code> is only ever
+   *        split on those indices. Each thread starts with a contiguous share of blocks, and claims runs of blocks
+   *        from the front of its share; the length of each run is doubled or halved so that it takes about
+   *        \c target_claim_duration to process, which adapts runs to the cost of each index. A thread whose share
+   *        is empty steals the back half of the share of another thread. If any call to \c range_fn throws, the
+   *        first exception is rethrown once all blocks have finished.
+   */
+  template <typename RangeFnT>
+  void parallel_for_stealing(
+    const std::size_t n,
+    RangeFnT&& range_fn,
+    std::size_t block_size = default_block_size,
+    const std::size_t block_offset = 0UL)
+  {
+    block_size = std::max(1UL, block_size);
+    const std::size_t first_boundary = block_offset % block_size;
+
+    // Blocks are counted in 32 bits, so that a share of blocks can be updated atomically; larger blocks keep a
+    // subset of the same boundaries
+    std::size_t skew = (block_size - first_boundary) % block_size;
+    while ((n + skew + block_size - 1UL) / block_size > max_block_count)
+    {
+      block_size *= 2UL;
+      skew = (block_size - first_boundary) % block_size;
+    }
+
+    const std::size_t block_count = (n + skew + block_size - 1UL) / block_size;
+    const std::size_t chunk_count = std::min(size(), block_count);
+    const auto block_first = [n, block_size, skew](const std::size_t block_index) {
+      return (block_index == 0UL) ? 0UL : std::min(n, block_index * block_size - skew);
+    };
+
+    if (chunk_count <= 1UL)
+    {
+      range_fn(0UL, n);
+      return;
+    }
+
+    std::vector<BlockShare> shares(chunk_count);
+    for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+    {
+      shares[chunk_index].store(
+        ThreadPool::chunk_first(chunk_index, chunk_count, block_count),
+        ThreadPool::chunk_first(chunk_index + 1UL, chunk_count, block_count));
+    }
+
+    ThreadPool::run(chunk_count, [&](const std::size_t chunk_index) {
+      std::size_t claim_size = 1UL;
+      std::size_t first_block;
+      std::size_t last_block;
+      while (shares[chunk_index].claim(claim_size, first_block, last_block) or
+             ThreadPool::steal(shares, chunk_index, first_block, last_block))
+      {
+        const auto claim_start = std::chrono::steady_clock::now();
+        range_fn(block_first(first_block), block_first(last_block));
+        const auto claim_duration = std::chrono::steady_clock::now() - claim_start;
+
+        if (claim_duration < target_claim_duration / 2)
+        {
+          claim_size *= 2UL;
+        }
+        else if (claim_duration > target_claim_duration * 2 and claim_size > 1UL)
+        {
+          claim_size /= 2UL;
+        }
+      }
+    });
+  }
+
+private:
+  /**
+   * @brief Stops all worker threads and waits for them to exit
+   */
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      stopped_ = true;
+    }
+    job_started_.notify_all();
+    for (auto& worker : workers_)
+    {
+      worker.join();
+    }
+  }
+
+  /// Largest number of blocks handled by parallel_for_stealing
+  static constexpr std::size_t max_block_count = 0xFFFFFFFFUL;
+
+  /**
+   * @brief Range of blocks <code>[first, last)</code> left to a single thread in parallel_for_stealing
+   *
+   *        Both ends are packed into one word, so that a thread claiming from the front and another thread stealing
+   *        from the back never hand out the same block. Each share is kept on its own cache line.
+   */
+  struct alignas(cache_line_size) BlockShare
+  {
+    /// First block in the high half, last block in the low half
+    std::atomic<std::uint64_t> blocks{0UL};
+
+    /**
+     * @brief Sets the share to <code>[first, last)</code>
+     */
+    void store(const std::size_t first, const std::size_t last)
+    {
+      blocks.store((std::uint64_t{first} << 32UL) | std::uint64_t{last}, std::memory_order_release);
+    }
+
+    /**
+     * @brief Takes up to \c count blocks from the front of the share
+     *
+     * @retval true  if any blocks were taken, as <code>[first, last)</code>
+     */
+    bool claim(const std::size_t count, std::size_t& first, std::size_t& last)
+    {
+      std::uint64_t current = blocks.load(std::memory_order_acquire);
+      while (true)
+      {
+        first = current >> 32UL;
+        const std::size_t end = current & 0xFFFFFFFFUL;
+        if (first >= end)
+        {
+          return false;
+        }
+        last = std::min(end, first + count);
+        if (blocks.compare_exchange_weak(
+              current, (std::uint64_t{last} << 32UL) | end, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return true;
+        }
+      }
+    }
+
+    /**
+     * @brief Takes the back half of the share, rounded up
+     *
+     * @retval true  if any blocks were taken, as <code>[first, last)</code>
+     */
+    bool split(std::size_t& first, std::size_t& last)
+    {
+      std::uint64_t current = blocks.load(std::memory_order_acquire);
+      while (true)
+      {
+        const std::size_t begin = current >> 32UL;
+        last = current & 0xFFFFFFFFUL;
+        if (begin >= last)
+        {
+          return false;
+        }
+        first = begin + (last - begin) / 2UL;
+        if (blocks.compare_exchange_weak(
+              current, (std::uint64_t{begin} << 32UL) | first, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return true;
+        }
+      }
+    }
+  };
+
+  /**
+   * @brief Steals blocks from the share of another thread, into the share at \c chunk_index, and claims the first
+   *        of those blocks
+   *
+   * @retval false  if the shares of all other threads are empty
+   */
+  static bool
+  steal(std::vector<BlockShare>& shares, const std::size_t chunk_index, std::size_t& first, std::size_t& last)
+  {
+    for (std::size_t offset = 1; offset < shares.size(); ++offset)
+    {
+      if (shares[(chunk_index + offset) % shares.size()].split(first, last))
+      {
+        shares[chunk_index].store(first + 1UL, last);
+        last = first + 1UL;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Calls <code>chunk_fn(chunk_index)</code> for each chunk in <code>[0, chunk_count)</code>, where the
+   *        calling thread runs the first chunk, and waits for all chunks to finish
+   *
+   *        If any call to \c chunk_fn throws, the first exception is rethrown once all chunks have finished.
+   */
+  template <typename ChunkFnT> void run(const std::size_t chunk_count, ChunkFnT&& chunk_fn)
+  {
+    std::exception_ptr first_exception;
+    std::mutex exception_mutex;
+    const std::function<void(std::size_t)> job_fn = [&](const std::size_t chunk_index) {
+      ThreadPool* const enclosing_pool = std::exchange(ThreadPool::current_pool(), this);
+      try
+      {
+        chunk_fn(chunk_index);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock{exception_mutex};
+        if (!first_exception)
+        {
+          first_exception = std::current_exception();
+        }
+      }
+      ThreadPool::current_pool() = enclosing_pool;
+    };
+
+    // Nested jobs run on the calling thread, since this thread already holds the job lock, or is a worker which
+    // the enclosing job is waiting on
+    if (ThreadPool::current_pool() == this)
+    {
+      for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+      {
+        job_fn(chunk_index);
+      }
+      if (first_exception)
+      {
+        std::rethrow_exception(first_exception);
+      }
+      return;
+    }
+
+    // Only one job may run at a time
+    std::lock_guard<std::mutex> job_lock{job_mutex_};
+
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      job_ = std::addressof(job_fn);
+      job_chunk_count_ = chunk_count;
+      job_remaining_ = chunk_count - 1UL;
+      ++job_generation_;
+    }
+    job_started_.notify_all();
+
+    // Calling thread runs the first chunk
+    job_fn(0UL);
+
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      job_finished_.wait(lock, [this] { return job_remaining_ == 0UL; });
+      job_ = nullptr;
+    }
+
+    if (first_exception)
+    {
+      std::rethrow_exception(first_exception);
+    }
+  }
+
+  /**
+   * @brief Returns the pool whose job the calling thread is running a chunk of, or \c nullptr if there is none
+   */
+  static ThreadPool*& current_pool()
+  {
+    static thread_local ThreadPool* pool = nullptr;
+    return pool;
+  }
+
+  /**
+   * @brief Returns the first index of the chunk at \c chunk_index, where <code>[0, n)</code> is split into
+   *        \c chunk_count chunks of nearly equal size
+   */
+  static constexpr std::size_t
+  chunk_first(const std::size_t chunk_index, const std::size_t chunk_count, const std::size_t n)
+  {
+    return (n / chunk_count) * chunk_index + std::min(chunk_index, n % chunk_count);
+  }
+
+  /**
+   * @brief Runs the chunk at \c worker_index of each job, until the pool is stopped
+   */
+  void work(const std::size_t worker_index)
+  {
+    std::size_t last_generation = 0UL;
+    while (true)
+    {
+      const std::function<void(std::size_t)>* job;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        job_started_.wait(lock, [this, last_generation] { return stopped_ or job_generation_ != last_generation; });
+        if (stopped_)
+        {
+          return;
+        }
+        last_generation = job_generation_;
+
+        // This worker does not participate in jobs with fewer chunks
+        if (worker_index >= job_chunk_count_)
+        {
+          continue;
+        }
+        job = job_;
+      }
+
+      (*job)(worker_index);
+
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (--job_remaining_ == 0UL)
+        {
+          job_finished_.notify_one();
+        }
+      }
+    }
+  }
+
+  /// Serializes jobs submitted from different threads
+  std::mutex job_mutex_;
+
+  /// Guards all job state
+  std::mutex mutex_;
+
+  /// Signals workers that a job has started, or that the pool is stopped
+  std::condition_variable job_started_;
+
+  /// Signals the calling thread that all worker chunks have finished
+  std::condition_variable job_finished_;
+
+  /// Runs a single chunk of the current job
+  const std::function<void(std::size_t)>* job_;
+
+  /// Number of chunks in the current job
+  std::size_t job_chunk_count_;
+
+  /// Incremented for each job
+  std::size_t job_generation_;
+
+  /// Number of worker chunks in the current job which have not finished
+  std::size_t job_remaining_;
+
+  /// True once the pool is being destroyed
+  bool stopped_;
+
+  /// Worker threads
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace mf
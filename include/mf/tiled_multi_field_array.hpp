@@ -0,0 +1,1131 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MF
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_field_array_fwd.hpp>
+#include <mf/support/assert.hpp>
+#include <mf/support/placement_new.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/trivially_relocatable.hpp>
+#include <mf/support/tuple_for_each.hpp>
+#include <mf/support/tuple_ref.hpp>
+#include <mf/support/tuple_select.hpp>
+#include <mf/support/view.hpp>
+
+namespace mf
+{
+namespace detail
+{
+
+/**
+ * @brief Returns a pointer to the same field as \c ptr, \c tile_count tiles of \c TileStride bytes later
+ */
+template <std::size_t TileStride, typename T> inline T* advance_tiles(T* const ptr, const std::size_t tile_count)
+{
+  using ByteT = std::conditional_t<std::is_const_v<T>, const std::uint8_t, std::uint8_t>;
+  return reinterpret_cast<T*>(reinterpret_cast<ByteT*>(ptr) + tile_count * TileStride);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Describes the placement of each field within a tile of \c TileSize elements
+ *
+ *        Each tile holds \c TileSize elements of the first field, followed by \c TileSize elements of the next field,
+ *        and so on. Each field segment is aligned to the largest power of two, up to a cache line, which divides its
+ *        length, so that whole segments may be loaded with aligned vector instructions. Tiles are placed back-to-back,
+ *        every \c tile_stride bytes.
+ */
+template <typename FieldTs, std::size_t TileSize> struct TiledLayout;
+
+/**
+ * @copydoc TiledLayout
+ */
+template <typename... Ts, std::size_t TileSize> struct TiledLayout<std::tuple<Ts...>, TileSize>
+{
+  /// Largest alignment applied to a field segment, beyond the alignment of the field type
+  static constexpr std::size_t max_segment_alignment = 64UL;
+
+  /// Alignment of each field segment within a tile; the lowest set bit of a segment length is the largest power of
+  /// two which divides it
+  static constexpr std::array<std::size_t, sizeof...(Ts)> segment_alignments = {std::max(
+    alignof(Ts),
+    std::min(max_segment_alignment, (sizeof(Ts) * TileSize) & (~(sizeof(Ts) * TileSize) + 1UL)))...};
+
+  /// Offset, in bytes, of each field segment from the start of a tile
+  static constexpr std::array<std::size_t, sizeof...(Ts)> offsets = [] {
+    constexpr std::array<std::size_t, sizeof...(Ts)> segment_lengths = {(sizeof(Ts) * TileSize)...};
+    std::array<std::size_t, sizeof...(Ts)> segment_offsets{};
+    std::size_t offset = 0UL;
+    for (std::size_t i = 0; i < sizeof...(Ts); ++i)
+    {
+      offset = (offset + segment_alignments[i] - 1UL) / segment_alignments[i] * segment_alignments[i];
+      segment_offsets[i] = offset;
+      offset += segment_lengths[i];
+    }
+    return segment_offsets;
+  }();
+
+  /// Alignment of each tile
+  static constexpr std::size_t tile_alignment =
+    *std::max_element(segment_alignments.begin(), segment_alignments.end());
+
+  /// Distance, in bytes, between the starts of consecutive tiles
+  static constexpr std::size_t tile_stride =
+    (offsets.back() + sizeof(std::tuple_element_t<sizeof...(Ts) - 1UL, std::tuple<Ts...>>) * TileSize +
+     tile_alignment - 1UL) /
+    tile_alignment * tile_alignment;
+};
+
+/**
+ * @brief Iterates over all elements of a tiled container, in order, across its tiles
+ *
+ * @tparam PointersT  tuple of pointers to each field of the first tile
+ */
+template <typename PointersT, std::size_t TileSize, std::size_t TileStride> class TiledIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using pointer = PointersT;
+  using reference = decltype(tuple_dereference(std::declval<PointersT&>()));
+  using value_type = reference;
+
+  TiledIterator(const PointersT& data, const std::size_t index) : data_{data}, index_{index} {}
+
+  inline bool operator==(const TiledIterator& other) const { return index_ == other.index_; }
+  inline bool operator!=(const TiledIterator& other) const { return index_ != other.index_; }
+
+  inline std::ptrdiff_t operator-(const TiledIterator& other) const
+  {
+    return static_cast<std::ptrdiff_t>(index_) - static_cast<std::ptrdiff_t>(other.index_);
+  }
+
+  inline TiledIterator& operator++()
+  {
+    ++index_;
+    return *this;
+  }
+
+  inline TiledIterator operator++(int)
+  {
+    TiledIterator prev{*this};
+    ++index_;
+    return prev;
+  }
+
+  inline reference operator*() const
+  {
+    PointersT ptrs{data_};
+    tuple_for_each(
+      [tile = index_ / TileSize, lane = index_ % TileSize](auto& ptr) {
+        ptr = detail::advance_tiles<TileStride>(ptr, tile) + lane;
+      },
+      ptrs);
+    return tuple_dereference(ptrs);
+  }
+
+private:
+  /// Pointers to each field of the first tile
+  PointersT data_;
+
+  /// Position of the element across all tiles
+  std::size_t index_;
+};
+
+/**
+ * @brief Iterates over the tiles of a tiled container, yielding a \c View of the elements in each tile
+ *
+ *        Each field is contiguous within a tile, so each \c View covers up to \c TileSize elements of each field
+ */
+template <typename FieldTs, std::size_t TileSize, std::size_t TileStride> class TileIterator;
+
+/**
+ * @copydoc TileIterator
+ */
+template <typename... Ts, std::size_t TileSize, std::size_t TileStride>
+class TileIterator<std::tuple<Ts...>, TileSize, TileStride>
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = View<std::tuple<Ts...>>;
+  using pointer = void;
+  using reference = value_type;
+
+  TileIterator(const std::tuple<Ts*...>& data, const std::size_t size, const std::size_t tile_index) :
+      data_{data},
+      size_{size},
+      tile_index_{tile_index}
+  {}
+
+  inline bool operator==(const TileIterator& other) const { return tile_index_ == other.tile_index_; }
+  inline bool operator!=(const TileIterator& other) const { return tile_index_ != other.tile_index_; }
+
+  inline std::ptrdiff_t operator-(const TileIterator& other) const
+  {
+    return static_cast<std::ptrdiff_t>(tile_index_) - static_cast<std::ptrdiff_t>(other.tile_index_);
+  }
+
+  inline TileIterator& operator++()
+  {
+    ++tile_index_;
+    return *this;
+  }
+
+  inline TileIterator operator++(int)
+  {
+    TileIterator prev{*this};
+    ++tile_index_;
+    return prev;
+  }
+
+  /**
+   * @brief Returns a view of the elements in the current tile, where each field is contiguous
+   */
+  inline View<std::tuple<Ts...>> operator*() const
+  {
+    std::tuple<Ts*...> tile_data{data_};
+    tuple_for_each([t = tile_index_](auto& ptr) { ptr = detail::advance_tiles<TileStride>(ptr, t); }, tile_data);
+    return View<std::tuple<Ts...>>{tile_data, std::min(TileSize, size_ - tile_index_ * TileSize)};
+  }
+
+private:
+  /// Pointers to each field of the first tile
+  std::tuple<Ts*...> data_;
+
+  /// Number of elements across all tiles
+  std::size_t size_;
+
+  /// Position of the current tile
+  std::size_t tile_index_;
+};
+
+/**
+ * @brief Range of tiles of a tiled container
+ */
+template <typename TileIteratorT> class TileRange
+{
+public:
+  TileRange(const TileIteratorT& first, const TileIteratorT& last) : first_{first}, last_{last} {}
+
+  inline TileIteratorT begin() const { return first_; }
+
+  inline TileIteratorT end() const { return last_; }
+
+private:
+  TileIteratorT first_;
+  TileIteratorT last_;
+};
+
+/**
+ * @brief Iterable view of one or more fields of a tiled container
+ *
+ *        Iterates over elements like \c View, and also over tiles with \c tiles and \c tile, each of which is a
+ *        \c View of contiguous fields
+ */
+template <typename FieldTs, std::size_t TileSize, std::size_t TileStride> class TiledView;
+
+/**
+ * @copydoc TiledView
+ */
+template <typename... Ts, std::size_t TileSize, std::size_t TileStride>
+class TiledView<std::tuple<Ts...>, TileSize, TileStride>
+{
+public:
+  /// Iterator over all elements
+  using iterator = TiledIterator<std::tuple<Ts*...>, TileSize, TileStride>;
+
+  /// Iterator over tiles
+  using tile_iterator = TileIterator<std::tuple<Ts...>, TileSize, TileStride>;
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline iterator begin() const { return iterator{data_, 0UL}; }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline iterator end() const { return iterator{data_, size_}; }
+
+  /**
+   * @brief Returns the number of elements in the view
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns true when element count is zero (view is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of tiles which hold at least one element
+   */
+  inline std::size_t tile_count() const { return (size_ + TileSize - 1UL) / TileSize; }
+
+  /**
+   * @brief Returns a view of the elements in the tile at \c tile_index
+   */
+  inline View<std::tuple<Ts...>> tile(const std::size_t tile_index) const
+  {
+    return *tile_iterator{data_, size_, tile_index};
+  }
+
+  /**
+   * @brief Returns an iterable range of views of the elements in each tile
+   */
+  inline TileRange<tile_iterator> tiles() const
+  {
+    return TileRange<tile_iterator>{tile_iterator{data_, size_, 0UL}, tile_iterator{data_, size_, tile_count()}};
+  }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) const { return *iterator{data_, pos}; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the view
+   */
+  inline auto at(const std::size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      throw std::out_of_range{"'pos' exceeds valid range of view"};
+    }
+    return *iterator{data_, pos};
+  }
+
+private:
+  template <typename FieldTs, std::size_t TileSizeV, typename ByteAllocatorT, typename CapacityIncreasePolicy>
+  friend class BasicTiledMultiFieldArray;
+
+  TiledView(const std::tuple<Ts*...>& data, const std::size_t size) : data_{data}, size_{size} {}
+
+  /// Pointers to each field of the first tile
+  std::tuple<Ts*...> data_;
+
+  /// Number of elements across all tiles
+  std::size_t size_;
+};
+
+/**
+ * @brief Multi-field array which holds elements in tiles of \c TileSize elements, where each field is contiguous
+ *        within a tile (array-of-structures-of-arrays)
+ *
+ *        Kernels which read many fields of each element read from one stream of tiles, rather than from one stream
+ *        per field, while each tile still offers \c TileSize contiguous, aligned values of each field for vector
+ *        instructions. Elements may be iterated one at a time, like other multi-field arrays, or tile-by-tile with
+ *        <code>view<...>().tiles()</code>. Field placement is described by \c TiledLayout.
+ *
+ * @tparam TileSize  number of elements in each tile; typically a SIMD width, such as 8 or 16
+ * @tparam ByteAllocatorT  allocator used to allocate tiles, after being rebound to a tile-sized type
+ */
+template <typename... Ts, std::size_t TileSize, typename ByteAllocatorT, typename CapacityIncreasePolicy>
+class BasicTiledMultiFieldArray<std::tuple<Ts...>, TileSize, ByteAllocatorT, CapacityIncreasePolicy>
+{
+  static_assert(TileSize > 0, "TileSize must be greater than zero");
+
+public:
+  /// Tuple of field value types
+  using value_type = std::tuple<Ts...>;
+
+  /// Describes the placement of each field within a tile
+  using layout_type = TiledLayout<std::tuple<Ts...>, TileSize>;
+
+  /// Iterator over all elements
+  using iterator = TiledIterator<std::tuple<Ts*...>, TileSize, layout_type::tile_stride>;
+
+  /// Iterator over all elements, which does not allow them to be modified
+  using const_iterator = TiledIterator<std::tuple<const Ts*...>, TileSize, layout_type::tile_stride>;
+
+  /// Number of elements in each tile
+  static constexpr std::size_t tile_size = TileSize;
+
+  /**
+   * @brief Default constructor
+   *
+   *        Sets initial size and capacity to zero
+   */
+  BasicTiledMultiFieldArray() : allocator_{}, tiles_{nullptr}, size_{0}, capacity_{0} {}
+
+  /**
+   * @brief Allocator initialization constructor
+   */
+  explicit BasicTiledMultiFieldArray(const ByteAllocatorT& allocator) :
+      allocator_{allocator},
+      tiles_{nullptr},
+      size_{0},
+      capacity_{0}
+  {}
+
+  /**
+   * @brief Creates \c count value-initialized elements
+   */
+  explicit BasicTiledMultiFieldArray(std::size_t count) : BasicTiledMultiFieldArray{}
+  {
+    BasicTiledMultiFieldArray::resize(count);
+  }
+
+  /**
+   * @brief Creates \c count elements, copy-constructed from each value in \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  BasicTiledMultiFieldArray(std::size_t count, CTorArgTupleT&& ctor_arg_tuple) : BasicTiledMultiFieldArray{}
+  {
+    BasicTiledMultiFieldArray::resize(count, std::forward<CTorArgTupleT>(ctor_arg_tuple));
+  }
+
+  BasicTiledMultiFieldArray(const BasicTiledMultiFieldArray& other) :
+      allocator_{std::allocator_traits<tile_allocator_type>::select_on_container_copy_construction(other.allocator_)},
+      tiles_{nullptr},
+      size_{0},
+      capacity_{0}
+  {
+    BasicTiledMultiFieldArray::reserve(other.size_);
+    BasicTiledMultiFieldArray::copy_construct(other);
+  }
+
+  BasicTiledMultiFieldArray(BasicTiledMultiFieldArray&& other) :
+      allocator_{std::move(other.allocator_)},
+      tiles_{nullptr},
+      size_{0},
+      capacity_{0}
+  {
+    BasicTiledMultiFieldArray::steal(other);
+  }
+
+  ~BasicTiledMultiFieldArray() { BasicTiledMultiFieldArray::release(); }
+
+  /**
+   * @brief Copies elements of \c other into this container
+   *
+   *        The allocator of \c other replaces this container's allocator if
+   *        <code>propagate_on_container_copy_assignment</code> is true
+   */
+  BasicTiledMultiFieldArray& operator=(const BasicTiledMultiFieldArray& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    BasicTiledMultiFieldArray::clear();
+    if constexpr (std::allocator_traits<tile_allocator_type>::propagate_on_container_copy_assignment::value)
+    {
+      // Memory allocated by the current allocator must be released before it is replaced
+      if (allocator_ != other.allocator_)
+      {
+        BasicTiledMultiFieldArray::release();
+      }
+      allocator_ = other.allocator_;
+    }
+    BasicTiledMultiFieldArray::reserve(other.size_);
+    BasicTiledMultiFieldArray::copy_construct(other);
+    return *this;
+  }
+
+  /**
+   * @brief Moves elements of \c other into this container
+   *
+   *        Tiles are taken from \c other if <code>propagate_on_container_move_assignment</code> is true, or if both
+   *        allocators are equal. Otherwise, elements are moved one-by-one into tiles allocated by this container.
+   */
+  BasicTiledMultiFieldArray& operator=(BasicTiledMultiFieldArray&& other)
+  {
+    if (this == std::addressof(other))
+    {
+      return *this;
+    }
+
+    if constexpr (std::allocator_traits<tile_allocator_type>::propagate_on_container_move_assignment::value)
+    {
+      BasicTiledMultiFieldArray::release();
+      allocator_ = std::move(other.allocator_);
+      BasicTiledMultiFieldArray::steal(other);
+    }
+    else if (std::allocator_traits<tile_allocator_type>::is_always_equal::value or allocator_ == other.allocator_)
+    {
+      BasicTiledMultiFieldArray::release();
+      BasicTiledMultiFieldArray::steal(other);
+    }
+    else
+    {
+      BasicTiledMultiFieldArray::clear();
+      BasicTiledMultiFieldArray::reserve(other.size_);
+      for (auto&& element : other)
+      {
+        std::apply([this](auto&... fields) { this->emplace_back(std::move(fields)...); }, element);
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Exchanges the contents of the container with those of other
+   *
+   *        Does not invoke any move, copy, or swap operations on individual elements. Allocators are exchanged if
+   *        <code>propagate_on_container_swap</code> is true; otherwise, both allocators must be equal.
+   */
+  inline void swap(BasicTiledMultiFieldArray& other)
+  {
+    if constexpr (std::allocator_traits<tile_allocator_type>::propagate_on_container_swap::value)
+    {
+      std::swap(other.allocator_, this->allocator_);
+    }
+    else
+    {
+      MF_ASSERT(std::allocator_traits<tile_allocator_type>::is_always_equal::value or allocator_ == other.allocator_);
+    }
+    std::swap(other.tiles_, this->tiles_);
+    std::swap(other.size_, this->size_);
+    std::swap(other.capacity_, this->capacity_);
+  }
+
+  /**
+   * @brief Returns references to values at index for each specified field type
+   *
+   * @returns A tuple of references to fields if multiple types are specified, otherwise,
+   *          returns a single reference
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index)
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    const auto tile_data = BasicTiledMultiFieldArray::tile_data(index / TileSize);
+    const std::size_t lane = index % TileSize;
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<SingleValueT&>(std::get<SingleValueT*>(tile_data)[lane]);
+    }
+    else
+    {
+      return std::tuple<ValueTs&...>{std::get<ValueTs*>(tile_data)[lane]...};
+    }
+  }
+
+  /**
+   * @copydoc get
+   * @note const qualified version
+   */
+  template <typename... ValueTs> inline decltype(auto) get(const std::size_t index) const
+  {
+    static_assert(sizeof...(ValueTs) != 0, "ValueTs must not be empty");
+
+    const auto tile_data = BasicTiledMultiFieldArray::tile_data(index / TileSize);
+    const std::size_t lane = index % TileSize;
+    if constexpr (sizeof...(ValueTs) == 1)
+    {
+      using SingleValueT = std::tuple_element_t<0, std::tuple<ValueTs...>>;
+      return static_cast<const SingleValueT&>(std::get<const SingleValueT*>(tile_data)[lane]);
+    }
+    else
+    {
+      return std::tuple<const ValueTs&...>{std::get<const ValueTs*>(tile_data)[lane]...};
+    }
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is the first argument.
+   *        All arguments which follow should be tuples of arguments used to construct values for each corresponding
+   *        field type
+   */
+  template <typename... PiecewiseFieldCTorTupleTs>
+  inline void emplace_back([[maybe_unused]] std::piecewise_construct_t _, PiecewiseFieldCTorTupleTs&&... ctor_args)
+  {
+    static_assert(sizeof...(Ts) == sizeof...(PiecewiseFieldCTorTupleTs), "Should be construct args for each type");
+
+    BasicTiledMultiFieldArray::check_and_realloc_for_elements_added(1);
+
+    // Contruct new element past the previous last element
+    tuple_for_each(
+      [lane = size_ % TileSize](auto* const ptr, auto&& ctor_arg_tuple) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        mf::apply_placement_new<ElementType>(ptr + lane, std::forward<decltype(ctor_arg_tuple)>(ctor_arg_tuple));
+      },
+      BasicTiledMultiFieldArray::tile_data(size_ / TileSize),
+      std::forward_as_tuple(ctor_args...));
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   *
+   *        This version participates in overload resolution if \c std::piecewise_construct is NOT the first
+   *        argument. All arguments should be lvalue or rvalue references to values used to copy/move construct
+   *        values for each corresponding field type; if no arguments are given, all fields are value-initialized
+   */
+  template <typename... FieldCopyOrMoveCTorTs>
+  inline void emplace_back(FieldCopyOrMoveCTorTs&&... copy_or_move_ctor_args)
+  {
+    static_assert(
+      (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts)) or (sizeof...(FieldCopyOrMoveCTorTs) == 0UL),
+      "Number of argments must be 0 or match the number of field types");
+
+    BasicTiledMultiFieldArray::check_and_realloc_for_elements_added(1);
+
+    const std::size_t lane = size_ % TileSize;
+    if constexpr (sizeof...(FieldCopyOrMoveCTorTs) == sizeof...(Ts))
+    {
+      // Contruct new element past the previous last element
+      tuple_for_each(
+        [lane](auto* const ptr, auto&& ctor_arg) {
+          using ElementType = pointer_element_t<decltype(ptr)>;
+
+          // Simply assign fundamental types
+          if constexpr (std::is_fundamental_v<ElementType>)
+          {
+            *(ptr + lane) = std::forward<decltype(ctor_arg)>(ctor_arg);
+          }
+          else
+          {
+            new (ptr + lane) ElementType{std::forward<decltype(ctor_arg)>(ctor_arg)};
+          }
+        },
+        BasicTiledMultiFieldArray::tile_data(size_ / TileSize),
+        std::forward_as_tuple(std::forward<FieldCopyOrMoveCTorTs>(copy_or_move_ctor_args)...));
+    }
+    else
+    {
+      BasicTiledMultiFieldArray::construct(BasicTiledMultiFieldArray::tile_data(size_ / TileSize), lane, lane + 1UL);
+    }
+
+    ++size_;
+  }
+
+  /**
+   * @brief Creates a new element at the end of the array(s)
+   */
+  void push_back(const value_type& value)
+  {
+    std::apply([this](const auto&... fields) { this->emplace_back(fields...); }, value);
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  inline void pop_back()
+  {
+    MF_ASSERT(size_ > 0);
+    const std::size_t last = size_ - 1UL;
+    BasicTiledMultiFieldArray::destroy(
+      BasicTiledMultiFieldArray::tile_data(last / TileSize), last % TileSize, last % TileSize + 1UL);
+    size_ = last;
+  }
+
+  /**
+   * @brief Ensures that capacity is at least \c n elements, moving all elements to new tiles if it is not
+   */
+  void reserve(const std::size_t n)
+  {
+    if (n > capacity_)
+    {
+      BasicTiledMultiFieldArray::reallocate(BasicTiledMultiFieldArray::aligned_capacity(n));
+    }
+  }
+
+  /**
+   * @brief Resizes container to the given size, \c new_size
+   *
+   *        If \c new_size is larger than \c size(), then new elements are value-initialized, or copy-constructed
+   *        from each value in \c ctor_arg_tuple, if provided. If \c new_size is smaller than \c size(), then all
+   *        tail elements past \c new_size are destroyed.
+   */
+  template <typename... CTorArgTupleT> void resize(const std::size_t new_size, CTorArgTupleT&&... ctor_arg_tuple)
+  {
+    static_assert(sizeof...(CTorArgTupleT) < 2, "ctor_arg_tuple must be a tuple");
+
+    if (new_size < size_)
+    {
+      BasicTiledMultiFieldArray::for_each_tile_range(
+        new_size, size_, [](const auto& tile_data, const std::size_t first, const std::size_t last) {
+          BasicTiledMultiFieldArray::destroy(tile_data, first, last);
+        });
+    }
+    else
+    {
+      BasicTiledMultiFieldArray::reserve(new_size);
+      BasicTiledMultiFieldArray::for_each_tile_range(
+        size_, new_size, [&ctor_arg_tuple...](const auto& tile_data, const std::size_t first, const std::size_t last) {
+          BasicTiledMultiFieldArray::construct(tile_data, first, last, ctor_arg_tuple...);
+        });
+    }
+    size_ = new_size;
+  }
+
+  /**
+   * @brief Clears all elements, setting effective size to 0; capacity is unchanged
+   */
+  inline void clear()
+  {
+    BasicTiledMultiFieldArray::for_each_tile_range(
+      0UL, size_, [](const auto& tile_data, const std::size_t first, const std::size_t last) {
+        BasicTiledMultiFieldArray::destroy(tile_data, first, last);
+      });
+    size_ = 0UL;
+  }
+
+  /**
+   * @brief Returns true when element count is zero (container is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of elements in the container
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which the container can hold without re-allocating; always a multiple of
+   *        \c TileSize
+   */
+  inline std::size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Returns the number of tiles which hold at least one element
+   */
+  inline std::size_t tile_count() const { return (size_ + TileSize - 1UL) / TileSize; }
+
+  /**
+   * @brief Returns iterator to first element
+   */
+  inline iterator begin() { return iterator{BasicTiledMultiFieldArray::tile_data(0UL), 0UL}; }
+
+  /**
+   * @brief Returns iterator to one past last element
+   */
+  inline iterator end() { return iterator{BasicTiledMultiFieldArray::tile_data(0UL), size_}; }
+
+  /**
+   * @copydoc begin
+   */
+  inline const_iterator begin() const { return const_iterator{BasicTiledMultiFieldArray::tile_data(0UL), 0UL}; }
+
+  /**
+   * @copydoc end
+   */
+  inline const_iterator end() const { return const_iterator{BasicTiledMultiFieldArray::tile_data(0UL), size_}; }
+
+  /**
+   * @copydoc begin
+   */
+  inline const_iterator cbegin() const { return begin(); }
+
+  /**
+   * @copydoc end
+   */
+  inline const_iterator cend() const { return end(); }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  TiledView<std::tuple<Ts...>, TileSize, layout_type::tile_stride> view()
+  {
+    return TiledView<std::tuple<Ts...>, TileSize, layout_type::tile_stride>{
+      BasicTiledMultiFieldArray::tile_data(0UL), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs> TiledView<std::tuple<ViewValueTs...>, TileSize, layout_type::tile_stride> view()
+  {
+    const auto data = BasicTiledMultiFieldArray::tile_data(0UL);
+    return TiledView<std::tuple<ViewValueTs...>, TileSize, layout_type::tile_stride>{
+      std::tuple<ViewValueTs*...>{std::get<ViewValueTs*>(data)...}, size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices>
+  TiledView<tuple_select_t<value_type, Indices...>, TileSize, layout_type::tile_stride> view()
+  {
+    const auto data = BasicTiledMultiFieldArray::tile_data(0UL);
+    return TiledView<tuple_select_t<value_type, Indices...>, TileSize, layout_type::tile_stride>{
+      tuple_of_pointers_t<tuple_select_t<value_type, Indices...>>{std::get<Indices>(data)...}, size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for all fields
+   */
+  TiledView<std::tuple<const Ts...>, TileSize, layout_type::tile_stride> view() const
+  {
+    return TiledView<std::tuple<const Ts...>, TileSize, layout_type::tile_stride>{
+      BasicTiledMultiFieldArray::tile_data(0UL), size_};
+  }
+
+  /**
+   * @brief Returns an iterable data view for one or more types contained within the original array
+   */
+  template <typename... ViewValueTs>
+  TiledView<std::tuple<const ViewValueTs...>, TileSize, layout_type::tile_stride> view() const
+  {
+    const auto data = BasicTiledMultiFieldArray::tile_data(0UL);
+    return TiledView<std::tuple<const ViewValueTs...>, TileSize, layout_type::tile_stride>{
+      std::tuple<const ViewValueTs*...>{std::get<const ViewValueTs*>(data)...}, size_};
+  }
+
+  /**
+   * @copydoc view
+   */
+  template <std::size_t... Indices>
+  TiledView<const_tuple_select_t<value_type, Indices...>, TileSize, layout_type::tile_stride> view() const
+  {
+    const auto data = BasicTiledMultiFieldArray::tile_data(0UL);
+    return TiledView<const_tuple_select_t<value_type, Indices...>, TileSize, layout_type::tile_stride>{
+      tuple_of_pointers_t<const_tuple_select_t<value_type, Indices...>>{std::get<Indices>(data)...}, size_};
+  }
+
+  /**
+   * @brief Returns an iterable range of views of all fields of the elements in each tile
+   */
+  inline auto tiles() { return view().tiles(); }
+
+  /**
+   * @copydoc tiles
+   */
+  inline auto tiles() const { return view().tiles(); }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   */
+  inline auto operator[](const std::size_t pos) { return *iterator{BasicTiledMultiFieldArray::tile_data(0UL), pos}; }
+
+  /**
+   * @copydoc operator[]
+   */
+  inline auto operator[](const std::size_t pos) const
+  {
+    return *const_iterator{BasicTiledMultiFieldArray::tile_data(0UL), pos};
+  }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. Bounds checking is performed.
+   *
+   * @param pos  element position
+   *
+   * @return reference to element at \c pos
+   *
+   * @throws \c std::out_of_range  if \c pos exceeds bounds of the container
+   */
+  inline auto at(const std::size_t pos) { return view().at(pos); }
+
+  /**
+   * @copydoc at
+   */
+  inline auto at(const std::size_t pos) const { return view().at(pos); }
+
+private:
+  /// Storage for a single tile
+  struct alignas(layout_type::tile_alignment) Tile
+  {
+    std::uint8_t bytes[layout_type::tile_stride];
+  };
+
+  /// Allocator rebound to allocate whole tiles
+  using tile_allocator_type = typename std::allocator_traits<ByteAllocatorT>::template rebind_alloc<Tile>;
+
+  /**
+   * @brief Returns pointers to each field of the tile at \c tile_index of \c tiles
+   */
+  template <std::size_t... Indices>
+  static std::tuple<Ts*...>
+  tile_data(Tile* const tiles, const std::size_t tile_index, std::index_sequence<Indices...> _)
+  {
+    if (tiles == nullptr)
+    {
+      return std::tuple<Ts*...>{};
+    }
+    auto* const tile_bytes = tiles[tile_index].bytes;
+    return std::tuple<Ts*...>{reinterpret_cast<Ts*>(tile_bytes + layout_type::offsets[Indices])...};
+  }
+
+  /**
+   * @brief Returns pointers to each field of the tile at \c tile_index
+   */
+  inline std::tuple<Ts*...> tile_data(const std::size_t tile_index)
+  {
+    return BasicTiledMultiFieldArray::tile_data(tiles_, tile_index, std::make_index_sequence<sizeof...(Ts)>{});
+  }
+
+  /**
+   * @copydoc tile_data
+   */
+  inline std::tuple<const Ts*...> tile_data(const std::size_t tile_index) const
+  {
+    return BasicTiledMultiFieldArray::tile_data(tiles_, tile_index, std::make_index_sequence<sizeof...(Ts)>{});
+  }
+
+  /**
+   * @brief Calls <code>range_fn(tile_data, first, last)</code> for the part of each tile which holds elements
+   *        in <code>[first, last)</code>, where \c first and \c last are lanes within that tile
+   */
+  template <typename RangeFnT>
+  inline void for_each_tile_range(std::size_t first, const std::size_t last, RangeFnT&& range_fn)
+  {
+    while (first < last)
+    {
+      const std::size_t tile_index = first / TileSize;
+      const std::size_t tile_first = tile_index * TileSize;
+      range_fn(
+        BasicTiledMultiFieldArray::tile_data(tile_index), first - tile_first, std::min(TileSize, last - tile_first));
+      first = tile_first + TileSize;
+    }
+  }
+
+  /**
+   * @brief Returns the smallest number of elements which fill whole tiles, and which is at least \c count
+   */
+  static constexpr std::size_t aligned_capacity(const std::size_t count)
+  {
+    return (count + TileSize - 1UL) / TileSize * TileSize;
+  }
+
+  /**
+   * @brief Value-initializes elements in lanes <code>[first, last)</code> of a tile
+   */
+  static void construct(const std::tuple<Ts*...>& tile_data, const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+        std::for_each(ptr + first, ptr + last, [](auto& element) { new (std::addressof(element)) ElementType{}; });
+      },
+      tile_data);
+  }
+
+  /**
+   * @brief Copy-constructs elements in lanes <code>[first, last)</code> of a tile from each value in
+   *        \c ctor_arg_tuple
+   */
+  template <typename CTorArgTupleT>
+  static void construct(
+    const std::tuple<Ts*...>& tile_data,
+    const std::size_t first,
+    const std::size_t last,
+    const CTorArgTupleT& ctor_arg_tuple)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr, const auto& other) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        // Simply assign fundamental types
+        if constexpr (std::is_fundamental_v<ElementType>)
+        {
+          std::fill(ptr + first, ptr + last, other);
+        }
+        else
+        {
+          std::for_each(
+            ptr + first, ptr + last, [&other](auto& element) { new (std::addressof(element)) ElementType{other}; });
+        }
+      },
+      tile_data,
+      ctor_arg_tuple);
+  }
+
+  /**
+   * @brief Calls destructor on elements in lanes <code>[first, last)</code> of a tile
+   */
+  static void destroy(const std::tuple<Ts*...>& tile_data, const std::size_t first, const std::size_t last)
+  {
+    tuple_for_each(
+      [first, last](auto* const ptr) {
+        using ElementType = pointer_element_t<decltype(ptr)>;
+
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+          std::for_each(ptr + first, ptr + last, [](auto& element) { element.~ElementType(); });
+        }
+      },
+      tile_data);
+  }
+
+  /**
+   * @brief Copy-constructs all elements of \c other, tile-by-tile; the container must be empty, with enough capacity
+   */
+  void copy_construct(const BasicTiledMultiFieldArray& other)
+  {
+    MF_ASSERT(size_ == 0UL and capacity_ >= other.size_);
+
+    for (std::size_t tile_index = 0; tile_index < other.tile_count(); ++tile_index)
+    {
+      tuple_for_each(
+        [n = std::min(TileSize, other.size_ - tile_index * TileSize)](auto* dst_ptr, const auto* src_ptr) {
+          using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+          // Copy bytes of trivially copyable types, call copy constructor for all others
+          if constexpr (std::is_trivially_copyable_v<ElementType>)
+          {
+            std::memcpy(static_cast<void*>(dst_ptr), static_cast<const void*>(src_ptr), sizeof(ElementType) * n);
+          }
+          else
+          {
+            std::uninitialized_copy(src_ptr, src_ptr + n, dst_ptr);
+          }
+        },
+        BasicTiledMultiFieldArray::tile_data(tile_index),
+        other.tile_data(tile_index));
+    }
+    size_ = other.size_;
+  }
+
+  /**
+   * @brief Takes ownership of the tiles held by \c other, leaving \c other with no elements or capacity
+   *
+   *        Current tiles must already be released
+   */
+  inline void steal(BasicTiledMultiFieldArray& other)
+  {
+    tiles_ = other.tiles_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+
+    // Set "other" to a fully-reset state
+    other.tiles_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+  }
+
+  /**
+   * @brief Destroys all elements and de-allocates all tiles
+   */
+  void release()
+  {
+    BasicTiledMultiFieldArray::clear();
+    if (tiles_ != nullptr)
+    {
+      std::allocator_traits<tile_allocator_type>::deallocate(allocator_, tiles_, capacity_ / TileSize);
+      tiles_ = nullptr;
+      capacity_ = 0UL;
+    }
+  }
+
+  /**
+   * @brief Checks if addding \c count elements exceeds capacity; reallocates if it does
+   */
+  inline void check_and_realloc_for_elements_added(const std::size_t count)
+  {
+    const std::size_t required_capacity = size_ + count;
+    if (capacity_ >= required_capacity)
+    {
+      return;
+    }
+
+    // Bytes occupied by a single element across all fields
+    static constexpr std::size_t element_bytes = (sizeof(Ts) + ...);
+
+    BasicTiledMultiFieldArray::reallocate(BasicTiledMultiFieldArray::aligned_capacity(
+      std::max(required_capacity, ::mf::next_capacity<CapacityIncreasePolicy>(required_capacity, element_bytes))));
+  }
+
+  /**
+   * @brief Moves all elements to new tiles with capacity for \c new_capacity elements
+   *
+   *        Tiles which hold only trivially relocatable fields are moved as whole blocks of bytes
+   */
+  void reallocate(const std::size_t new_capacity)
+  {
+    MF_ASSERT(new_capacity % TileSize == 0UL and new_capacity >= size_);
+
+    Tile* const new_tiles = std::allocator_traits<tile_allocator_type>::allocate(allocator_, new_capacity / TileSize);
+
+    if (tiles_ != nullptr)
+    {
+      const std::size_t used_tile_count = tile_count();
+      if constexpr ((is_trivially_relocatable_v<Ts> and ...))
+      {
+        std::memcpy(static_cast<void*>(new_tiles), static_cast<const void*>(tiles_), sizeof(Tile) * used_tile_count);
+      }
+      else
+      {
+        for (std::size_t tile_index = 0; tile_index < used_tile_count; ++tile_index)
+        {
+          tuple_for_each(
+            [n = std::min(TileSize, size_ - tile_index * TileSize)](auto* dst_ptr, auto* src_ptr) {
+              using ElementType = pointer_element_t<decltype(dst_ptr)>;
+
+              // Move bytes of trivially relocatable types, call move constructor for all others
+              if constexpr (is_trivially_relocatable_v<ElementType>)
+              {
+                relocate_bytes(dst_ptr, src_ptr, n);
+              }
+              else
+              {
+                std::uninitialized_move(src_ptr, src_ptr + n, dst_ptr);
+                std::for_each(src_ptr, src_ptr + n, [](auto& element) { element.~ElementType(); });
+              }
+            },
+            BasicTiledMultiFieldArray::tile_data(new_tiles, tile_index, std::make_index_sequence<sizeof...(Ts)>{}),
+            BasicTiledMultiFieldArray::tile_data(tiles_, tile_index, std::make_index_sequence<sizeof...(Ts)>{}));
+        }
+      }
+      std::allocator_traits<tile_allocator_type>::deallocate(allocator_, tiles_, capacity_ / TileSize);
+    }
+
+    tiles_ = new_tiles;
+    capacity_ = new_capacity;
+  }
+
+  /// Allocates tiles
+  tile_allocator_type allocator_;
+
+  /// First tile
+  Tile* tiles_;
+
+  /// The effective number of elements across all tiles
+  std::size_t size_;
+
+  /// The number of elements which allocated tiles may hold
+  std::size_t capacity_;
+};
+
+/**
+ * @brief Convenience alias for a multi-field array which holds elements in tiles of \c TileSize elements, using
+ *        \c std::allocator to allocate tiles
+ */
+template <std::size_t TileSize, typename... FieldTs>
+using tiled_multi_field_array = BasicTiledMultiFieldArray<
+  std::tuple<FieldTs...>,
+  TileSize,
+  std::allocator<std::uint8_t>,
+  DefaultCapacityIncreasePolicy>;
+
+}  // namespace mf
@@ -0,0 +1,306 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+// POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+
+// MF
+#include <mf/multi_allocator_adapter.hpp>
+#include <mf/multi_field_array.hpp>
+#include <mf/support/pointer_element_type.hpp>
+#include <mf/support/single_pass_layout.hpp>
+#include <mf/support/tuple_for_each.hpp>
+
+namespace mf
+{
+
+/**
+ * @brief Tag type used to specify a strategy which reserves address space for \c MaxElements elements of each field
+ *        up front, and commits memory to that address space as capacity grows
+ *
+ *        Field buffers never move once allocated, so pointers and iterators to elements remain valid for the
+ *        lifetime of the container, so long as capacity never exceeds \c MaxElements
+ */
+template <std::size_t MaxElements> struct VirtualMemoryAllocationStrategy
+{};
+
+/**
+ * @copydoc BasicMultiAllocatorAdapter
+ *
+ *          Reserves an inaccessible range of virtual addresses for \c MaxElements elements of each field with
+ *          \c mmap, then makes pages accessible (committed) on demand as the number of allocated elements grows.
+ */
+template <typename... ValueTs, std::size_t MaxElements>
+class BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, VirtualMemoryAllocationStrategy<MaxElements>>
+{
+  static_assert(MaxElements > 0, "MaxElements must be greater than zero");
+
+public:
+  using allocator_types = std::tuple<>;
+
+  /// Memory is resized with \c resize_in_place rather than \c reallocate
+  static constexpr bool supports_reallocate = false;
+
+  /// Memory for all fields may be resized without moving with \c resize_in_place
+  static constexpr bool supports_resize_in_place = true;
+
+  /// Newly mapped memory is always filled with zero bytes
+  static constexpr bool supports_allocate_zeroed = true;
+
+  /// Memory is mapped outside of the adapter, so buffers stay valid when the adapter is moved
+  static constexpr bool has_inline_storage = false;
+
+  /// Maximum number of elements which may be allocated for each field
+  static constexpr std::size_t max_size = MaxElements;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is copy-assigned
+  using propagate_on_container_copy_assignment = std::false_type;
+
+  /// Adapter is stateless; it never needs to be replaced when its container is move-assigned
+  using propagate_on_container_move_assignment = std::true_type;
+
+  /// Adapter is stateless; it never needs to be exchanged when containers are swapped
+  using propagate_on_container_swap = std::false_type;
+
+  /// Memory allocated by any adapter of this type may be de-allocated by any other
+  using is_always_equal = std::true_type;
+
+  BasicMultiAllocatorAdapter() = default;
+  BasicMultiAllocatorAdapter(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter(const BasicMultiAllocatorAdapter&) = default;
+  BasicMultiAllocatorAdapter& operator=(BasicMultiAllocatorAdapter&&) = default;
+  BasicMultiAllocatorAdapter& operator=(const BasicMultiAllocatorAdapter&) = default;
+
+  /**
+   * @brief Returns the adapter to be used by a copy of a container which uses this adapter
+   */
+  BasicMultiAllocatorAdapter select_on_container_copy_construction() const { return *this; }
+
+  /**
+   * @brief Always true, since adapters of this type are stateless
+   */
+  constexpr bool operator==([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return true; }
+
+  /**
+   * @brief Always false, since adapters of this type are stateless
+   */
+  constexpr bool operator!=([[maybe_unused]] const BasicMultiAllocatorAdapter& other) const { return false; }
+
+  /**
+   * @brief Reserves address space for \c MaxElements, and commits memory for \c n elements of each type in \c ValueTs
+   *
+   * @param n  number of elements to allocate
+   *
+   * @return tuple of pointers to allocated memory each type in \c ValueTs
+   *
+   * @throws \c std::bad_alloc  if \c n exceeds \c MaxElements, or address space could not be reserved; address space
+   *         already reserved for other fields is released
+   */
+  std::tuple<ValueTs*...> allocate(const std::size_t n)
+  {
+    if (n > MaxElements)
+    {
+      throw std::bad_alloc{};
+    }
+
+    // Fields which have not been reserved stay null, so that a failure releases only reserved fields
+    std::tuple<ValueTs*...> ptrs{};
+    try
+    {
+      tuple_for_each(
+        [n](auto& ptr) {
+          using element_type = pointer_element_t<decltype(ptr)>;
+
+          void* const addr = ::mmap(
+            nullptr,
+            reserved_length<element_type>(),
+            PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+            -1,
+            0);
+
+          if (addr == MAP_FAILED)
+          {
+            throw std::bad_alloc{};
+          }
+
+          ptr = static_cast<element_type*>(addr);
+
+          commit(ptr, 0UL, n);
+        },
+        ptrs);
+    }
+    catch (...)
+    {
+      BasicMultiAllocatorAdapter::deallocate(ptrs, n);
+      throw;
+    }
+    return ptrs;
+  }
+
+  /**
+   * @brief Reserves address space for \c MaxElements, and commits memory for \c n elements of each type in \c ValueTs
+   *
+   *        Equivalent to \c allocate, since newly mapped pages are filled with zero bytes
+   */
+  std::tuple<ValueTs*...> allocate_zeroed(const std::size_t n) { return BasicMultiAllocatorAdapter::allocate(n); }
+
+  /**
+   * @brief Releases reserved address space for each type in \c ValueTs
+   *
+   * @param ptr  points to memory segments to be de-allocated
+   * @param n  number of elements to de-allocate
+   */
+  void deallocate(const std::tuple<ValueTs*...>& ptrs, [[maybe_unused]] const std::size_t n)
+  {
+    tuple_for_each(
+      [](auto* const ptr) {
+        using element_type = pointer_element_t<decltype(ptr)>;
+        if (ptr != nullptr)
+        {
+          ::munmap(static_cast<void*>(ptr), reserved_length<element_type>());
+        }
+      },
+      ptrs);
+  }
+
+  /**
+   * @brief Commits or decommits memory such that exactly enough pages for \c new_n elements of each field are
+   *        accessible, without moving any elements
+   *
+   * @param ptrs  points to memory segments previously allocated with this adapter
+   * @param old_n  number of elements previously allocated
+   * @param new_n  number of elements to allocate
+   *
+   * @retval true  if memory was resized
+   * @retval false  if \c ptrs are not allocated, or \c new_n exceeds \c MaxElements
+   */
+  bool resize_in_place(const std::tuple<ValueTs*...>& ptrs, const std::size_t old_n, const std::size_t new_n)
+  {
+    if (std::get<0>(ptrs) == nullptr or new_n > MaxElements)
+    {
+      return false;
+    }
+
+    tuple_for_each(
+      [old_n, new_n](auto* const ptr) {
+        if (new_n > old_n)
+        {
+          commit(ptr, old_n, new_n);
+        }
+        else
+        {
+          decommit(ptr, new_n, old_n);
+        }
+      },
+      ptrs);
+    return true;
+  }
+
+private:
+  /**
+   * @brief Returns system page size, in bytes
+   */
+  static std::size_t page_size()
+  {
+    static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+  }
+
+  /**
+   * @brief Returns the length of committed memory required to hold \c n values of \c ValueT
+   */
+  template <typename ValueT> static std::size_t committed_length(const std::size_t n)
+  {
+    return align_up(sizeof(ValueT) * n, page_size());
+  }
+
+  /**
+   * @brief Returns the length of reserved address space for values of \c ValueT
+   */
+  template <typename ValueT> static std::size_t reserved_length() { return committed_length<ValueT>(MaxElements); }
+
+  /**
+   * @brief Makes pages which hold values in <code>[from_n, to_n)</code> accessible
+   *
+   * @throws \c std::bad_alloc  if pages could not be committed
+   */
+  template <typename ValueT> static void commit(ValueT* const ptr, const std::size_t from_n, const std::size_t to_n)
+  {
+    const std::size_t first = committed_length<ValueT>(from_n);
+    const std::size_t last = committed_length<ValueT>(to_n);
+    if (last > first)
+    {
+      auto* const addr = reinterpret_cast<std::uint8_t*>(ptr) + first;
+      if (::mprotect(addr, last - first, PROT_READ | PROT_WRITE) != 0)
+      {
+        throw std::bad_alloc{};
+      }
+    }
+  }
+
+  /**
+   * @brief Returns pages which exclusively hold values in <code>[from_n, to_n)</code> to the system and makes them
+   *        inaccessible
+   */
+  template <typename ValueT> static void decommit(ValueT* const ptr, const std::size_t from_n, const std::size_t to_n)
+  {
+    const std::size_t first = committed_length<ValueT>(from_n);
+    const std::size_t last = committed_length<ValueT>(to_n);
+    if (last > first)
+    {
+      auto* const addr = reinterpret_cast<std::uint8_t*>(ptr) + first;
+      ::madvise(addr, last - first, MADV_DONTNEED);
+      ::mprotect(addr, last - first, PROT_NONE);
+    }
+  }
+};
+
+/**
+ * @brief Specifies a capacity-growing policy for virtual memory backed arrays
+ *
+ *        Since growing never moves elements, capacity is increased in small steps of \c CommitElements, which
+ *        bounds committed-but-unused memory. Stepped capacity is limited to \c MaxElements, but requests beyond
+ *        \c MaxElements are passed through so that allocation fails.
+ */
+template <std::size_t MaxElements, std::size_t CommitElements = 4096UL> struct VirtualMemoryCapacityIncreasePolicy
+{
+  static_assert(CommitElements > 0, "CommitElements must be greater than zero");
+
+  static constexpr std::size_t next_capacity(std::size_t prev_capacity)
+  {
+    const std::size_t stepped_capacity = ((prev_capacity + CommitElements - 1UL) / CommitElements) * CommitElements;
+    return std::max(prev_capacity, std::min(MaxElements, stepped_capacity));
+  }
+};
+
+/**
+ * @brief Convenience type alias which creates an BasicMultiAllocatorAdapter which reserves address space for
+ * \c MaxElements of each field up front
+ */
+template <std::size_t MaxElements, typename... ValueTs>
+using virtual_memory_allocator_adapter =
+  BasicMultiAllocatorAdapter<std::tuple<ValueTs...>, VirtualMemoryAllocationStrategy<MaxElements>>;
+
+/**
+ * @brief Convenience alias for a multi-field array which never relocates elements, and can hold up to
+ * \c MaxElements elements
+ */
+template <std::size_t MaxElements, typename... FieldTs>
+using virtual_memory_multi_field_array = BasicMultiFieldArray<
+  std::tuple<FieldTs...>,
+  virtual_memory_allocator_adapter<MaxElements, FieldTs...>,
+  VirtualMemoryCapacityIncreasePolicy<MaxElements>>;
+
+}  // namespace mf
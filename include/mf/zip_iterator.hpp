@@ -163,11 +163,174 @@ inline ZipIterator<std::tuple<std::remove_reference_t<IteratorTs>...>> make_zip_
   return ZipIterator<std::tuple<std::remove_reference_t<IteratorTs>...>>{std::forward_as_tuple(iterators...)};
 }
 
+/**
+ * @brief Iterates over multiple random-access iterators simultaneously, using a single shared index
+ *
+ *        Holds the base iterator of each sequence once, and dereferences as <code>base[index]</code> for each. Unlike
+ *        \c ZipIterator, stepping only updates the index, so a loop over many fields keeps a single induction
+ *        variable, which compilers vectorize more readily.
+ */
+template <typename FieldTs> class IndexedZipIterator;
+
+/**
+ * @copydoc IndexedZipIterator
+ */
+template <typename... IteratorTs> class IndexedZipIterator<std::tuple<IteratorTs...>>
+{
+public:
+  inline bool operator==(const IndexedZipIterator& other) const { return this->index_ == other.index_; }
+  inline bool operator!=(const IndexedZipIterator& other) const { return this->index_ != other.index_; }
+  inline bool operator<(const IndexedZipIterator& other) const { return this->index_ < other.index_; }
+  inline bool operator>(const IndexedZipIterator& other) const { return this->index_ > other.index_; }
+  inline bool operator<=(const IndexedZipIterator& other) const { return this->index_ <= other.index_; }
+  inline bool operator>=(const IndexedZipIterator& other) const { return this->index_ >= other.index_; }
+
+  inline std::ptrdiff_t operator-(const IndexedZipIterator& other) const { return this->index_ - other.index_; }
+
+  inline IndexedZipIterator operator-(const std::ptrdiff_t offset) const
+  {
+    return IndexedZipIterator{base_, index_ - offset};
+  }
+
+  inline IndexedZipIterator operator+(const std::ptrdiff_t offset) const
+  {
+    return IndexedZipIterator{base_, index_ + offset};
+  }
+
+  inline IndexedZipIterator& operator-=(const std::ptrdiff_t offset)
+  {
+    index_ -= offset;
+    return *this;
+  }
+
+  inline IndexedZipIterator& operator+=(const std::ptrdiff_t offset)
+  {
+    index_ += offset;
+    return *this;
+  }
+
+  inline IndexedZipIterator& operator--()
+  {
+    --index_;
+    return *this;
+  }
+
+  inline IndexedZipIterator operator--(int)
+  {
+    IndexedZipIterator prev{*this};
+    --index_;
+    return prev;
+  }
+
+  inline IndexedZipIterator& operator++()
+  {
+    ++index_;
+    return *this;
+  }
+
+  inline IndexedZipIterator operator++(int)
+  {
+    IndexedZipIterator prev{*this};
+    ++index_;
+    return prev;
+  }
+
+  inline auto operator*() const { return this->dereference(std::make_index_sequence<sizeof...(IteratorTs)>{}); }
+
+  inline auto operator[](const std::ptrdiff_t offset) const { return *(*this + offset); }
+
+  IndexedZipIterator(const std::tuple<IteratorTs...>& base, const std::ptrdiff_t index) : base_{base}, index_{index}
+  {}
+
+private:
+  template <std::size_t... Indices> inline auto dereference(std::index_sequence<Indices...> _) const
+  {
+    return std::tuple<typename std::iterator_traits<IteratorTs>::reference...>{std::get<Indices>(base_)[index_]...};
+  }
+
+  /// Iterator to the first element of each sequence
+  std::tuple<IteratorTs...> base_;
+
+  /// Offset of the current element from \c base_
+  std::ptrdiff_t index_;
+};
+
+/**
+ * @brief Iterable range of \c IndexedZipIterator over sequences which start at \c base and hold \c size elements
+ */
+template <typename FieldTs> class IndexedZipRange;
+
+/**
+ * @copydoc IndexedZipRange
+ */
+template <typename... IteratorTs> class IndexedZipRange<std::tuple<IteratorTs...>>
+{
+public:
+  using iterator = IndexedZipIterator<std::tuple<IteratorTs...>>;
+
+  IndexedZipRange(const std::tuple<IteratorTs...>& base, const std::size_t size) : base_{base}, size_{size} {}
+
+  /**
+   * @brief Returns iterator to the first element
+   */
+  inline iterator begin() const { return iterator{base_, 0}; }
+
+  /**
+   * @brief Returns iterator to one element past the last element
+   */
+  inline iterator end() const { return iterator{base_, static_cast<std::ptrdiff_t>(size_)}; }
+
+  /**
+   * @brief Returns the number of elements
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns true when element count is zero (range is empty)
+   */
+  inline bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns a reference to the element at specified location \c pos. No bounds checking is performed.
+   */
+  inline auto operator[](const std::size_t pos) const { return begin()[static_cast<std::ptrdiff_t>(pos)]; }
+
+private:
+  /// Iterator to the first element of each sequence
+  std::tuple<IteratorTs...> base_;
+
+  /// Number of elements
+  std::size_t size_;
+};
+
+/**
+ * @brief Creates an \c IndexedZipIterator at \c index by deducing \c IteratorTs
+ */
+template <typename... IteratorTs>
+inline IndexedZipIterator<std::tuple<std::remove_reference_t<IteratorTs>...>>
+make_indexed_zip_iterator(const std::ptrdiff_t index, IteratorTs... iterators)
+{
+  return IndexedZipIterator<std::tuple<std::remove_reference_t<IteratorTs>...>>{
+    std::forward_as_tuple(iterators...), index};
+}
+
 }  // namespace mf
 
 namespace std
 {
 
+/**
+ * @brief Specialization of \c std::iterator_traits for a valid \c IndexedZipIterator template instance
+ */
+template <typename TupleOfIteratorsT> struct iterator_traits<::mf::IndexedZipIterator<TupleOfIteratorsT>>
+{
+  using difference_type = std::ptrdiff_t;
+  using value_type = TupleOfIteratorsT;
+  using pointer = ::mf::tuple_of_pointers_t<TupleOfIteratorsT>;
+  using reference = ::mf::tuple_of_lvalue_references_t<TupleOfIteratorsT>;
+  using iterator_category = std::random_access_iterator_tag;
+};
+
 /**
  * @brief Specialization of \c std::iterator_traits for a valid \c ZipIterator template instance
  */
@@ -4,6 +4,9 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -12,7 +15,20 @@
 #include <benchmark/benchmark.h>
 
 // MF
+#include <mf/arena_allocator_adapter.hpp>
+#include <mf/compact_multi_field_array.hpp>
+#include <mf/find.hpp>
+#include <mf/grouped_multi_field_array.hpp>
+#include <mf/huge_page_allocator_adapter.hpp>
+#include <mf/inline_allocator_adapter.hpp>
+#include <mf/malloc_allocator.hpp>
 #include <mf/multi_field_array.hpp>
+#include <mf/packed_multi_field_array.hpp>
+#include <mf/parallel_algorithm.hpp>
+#include <mf/pooled_allocator_adapter.hpp>
+#include <mf/reduction.hpp>
+#include <mf/segmented_multi_field_array.hpp>
+#include <mf/tiled_multi_field_array.hpp>
 
 
 struct Two_Fields
@@ -28,6 +44,11 @@ struct Many_Fields
   int c, d, e, f;
 };
 
+struct Trivial_Vec3
+{
+  float x, y, z;
+};
+
 
 //
 // ITERATION BENCHMARKING
@@ -267,6 +288,101 @@ static void Allocation_Many_Fields_Vec(benchmark::State& state)
 }
 BENCHMARK(Allocation_Many_Fields_Vec);
 
+
+static void Allocation_Trivial_Fields_MFA(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::multi_field_array<Trivial_Vec3, Trivial_Vec3, int> multi_field_array;
+    multi_field_array.resize(1000000);
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Trivial_Fields_MFA);
+
+
+static void Allocation_Trivial_Fields_MFA_Default_Init(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::multi_field_array<Trivial_Vec3, Trivial_Vec3, int> multi_field_array;
+    multi_field_array.resize_default_init(1000000);
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Trivial_Fields_MFA_Default_Init);
+
+
+static void Allocation_Zero_Filled_Fields_MFA(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::multi_field_array<float, int, double> multi_field_array{1UL << 22UL, std::make_tuple(0.f, 0, 0.0)};
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Zero_Filled_Fields_MFA);
+
+
+static void Allocation_Zero_Filled_Fields_MFA_Malloc(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::malloc_multi_field_array<float, int, double> multi_field_array{1UL << 22UL, std::make_tuple(0.f, 0, 0.0)};
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Zero_Filled_Fields_MFA_Malloc);
+
+
+static void Allocation_Many_Fields_MFA_Serial(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::multi_field_array<std::string, Trivial_Vec3, int> multi_field_array{1UL << 20UL};
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Many_Fields_MFA_Serial);
+
+
+static void Allocation_Many_Fields_MFA_Parallel(benchmark::State& state)
+{
+  mf::ThreadPool pool;
+  for (auto _ : state)
+  {
+    mf::multi_field_array<std::string, Trivial_Vec3, int> multi_field_array{pool, 1UL << 20UL};
+    multi_field_array.clear(pool);
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Allocation_Many_Fields_MFA_Parallel);
+
+
+template <typename ArrayT> static void Iteration_Many_Small_Arrays(benchmark::State& state)
+{
+  std::vector<ArrayT> arrays(100000);
+  for (auto& array : arrays)
+  {
+    array.resize(4, std::make_tuple(1.f, 2, 3.0, 'c', 4.f, short{5}));
+  }
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (const auto& array : arrays)
+    {
+      for (const auto& [a, b] : array.template view<0, 1>())
+      {
+        sum += a + static_cast<float>(b);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK_TEMPLATE(Iteration_Many_Small_Arrays, mf::multi_field_array<float, int, double, char, float, short>);
+BENCHMARK_TEMPLATE(Iteration_Many_Small_Arrays, mf::compact_multi_field_array<float, int, double, char, float, short>);
+
 //
 // RANDOM ACCESS BENCHMARKING
 //
@@ -406,5 +522,682 @@ static void Grow_From_Empty_Many_Fields(benchmark::State& state)
 }
 BENCHMARK(Grow_From_Empty_Many_Fields);
 
+//
+// BUILD-AND-DROP BENCHMARKING
+//
+
+static constexpr std::size_t kBuildAndDropArrayCount = 100;
+static constexpr std::size_t kBuildAndDropElementCount = 64;
+
+
+static void Build_And_Drop_Many_Fields_MFA(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < kBuildAndDropArrayCount; ++n)
+    {
+      mf::multi_field_array<float, int, double, int> multi_field_array;
+      for (std::size_t i = 0; i < kBuildAndDropElementCount; ++i)
+      {
+        multi_field_array.emplace_back(1.f, 2, 3.0, 4);
+      }
+      benchmark::DoNotOptimize(multi_field_array);
+    }
+  }
+}
+BENCHMARK(Build_And_Drop_Many_Fields_MFA);
+
+
+static void Build_And_Drop_Many_Fields_MFA_Arena(benchmark::State& state)
+{
+  mf::MonotonicArena arena{1UL << 20UL};
+
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < kBuildAndDropArrayCount; ++n)
+    {
+      mf::arena_multi_field_array<float, int, double, int> multi_field_array{
+        mf::arena_allocator_adapter<float, int, double, int>{arena}};
+      for (std::size_t i = 0; i < kBuildAndDropElementCount; ++i)
+      {
+        multi_field_array.emplace_back(1.f, 2, 3.0, 4);
+      }
+      benchmark::DoNotOptimize(multi_field_array);
+    }
+    arena.reset();
+  }
+}
+BENCHMARK(Build_And_Drop_Many_Fields_MFA_Arena);
+
+
+static void Build_And_Drop_Many_Fields_MFA_Pooled(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < kBuildAndDropArrayCount; ++n)
+    {
+      mf::pooled_multi_field_array<float, int, double, int> multi_field_array;
+      for (std::size_t i = 0; i < kBuildAndDropElementCount; ++i)
+      {
+        multi_field_array.emplace_back(1.f, 2, 3.0, 4);
+      }
+      benchmark::DoNotOptimize(multi_field_array);
+    }
+  }
+}
+BENCHMARK(Build_And_Drop_Many_Fields_MFA_Pooled);
+
+
+static constexpr std::size_t kBuildAndDropSmallElementCount = 6;
+
+
+static void Build_And_Drop_Few_Elements_MFA(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < kBuildAndDropArrayCount; ++n)
+    {
+      mf::multi_field_array<float, int, double, int> multi_field_array;
+      for (std::size_t i = 0; i < kBuildAndDropSmallElementCount; ++i)
+      {
+        multi_field_array.emplace_back(1.f, 2, 3.0, 4);
+      }
+      benchmark::DoNotOptimize(multi_field_array);
+    }
+  }
+}
+BENCHMARK(Build_And_Drop_Few_Elements_MFA);
+
+
+static void Build_And_Drop_Few_Elements_MFA_Inline(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < kBuildAndDropArrayCount; ++n)
+    {
+      mf::small_multi_field_array<8, float, int, double, int> multi_field_array;
+      for (std::size_t i = 0; i < kBuildAndDropSmallElementCount; ++i)
+      {
+        multi_field_array.emplace_back(1.f, 2, 3.0, 4);
+      }
+      benchmark::DoNotOptimize(multi_field_array);
+    }
+  }
+}
+BENCHMARK(Build_And_Drop_Few_Elements_MFA_Inline);
+
+
+//
+// LARGE SCAN BENCHMARKING
+//
+
+static constexpr std::size_t kLargeScanElementCount = 1UL << 24UL;
+
+
+template <typename MultiFieldArrayT> static void Large_Scan_Two_Of_Many_Fields(benchmark::State& state)
+{
+  MultiFieldArrayT multi_field_array{kLargeScanElementCount, std::make_tuple(1.f, 2, 3.0, 4)};
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (const auto& [a, c] : multi_field_array.template view<float, double>())
+    {
+      sum += a + static_cast<float>(c);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(state.iterations() * kLargeScanElementCount * (sizeof(float) + sizeof(double)));
+}
+
+
+static void Large_Scan_Two_Of_Many_Fields_MFA(benchmark::State& state)
+{
+  Large_Scan_Two_Of_Many_Fields<mf::multi_field_array<float, int, double, int>>(state);
+}
+BENCHMARK(Large_Scan_Two_Of_Many_Fields_MFA);
+
+
+static void Large_Scan_Two_Of_Many_Fields_MFA_Huge_Pages(benchmark::State& state)
+{
+  Large_Scan_Two_Of_Many_Fields<mf::huge_page_multi_field_array<float, int, double, int>>(state);
+}
+BENCHMARK(Large_Scan_Two_Of_Many_Fields_MFA_Huge_Pages);
+
+
+static void Large_Scan_Two_Of_Many_Fields_MFA_Prefaulted_Huge_Pages(benchmark::State& state)
+{
+  using array_type = mf::BasicMultiFieldArray<
+    std::tuple<float, int, double, int>,
+    mf::prefaulted_huge_page_allocator_adapter<float, int, double, int>,
+    mf::DefaultCapacityIncreasePolicy>;
+  Large_Scan_Two_Of_Many_Fields<array_type>(state);
+}
+BENCHMARK(Large_Scan_Two_Of_Many_Fields_MFA_Prefaulted_Huge_Pages);
+
+
+//
+// SEGMENTED BENCHMARKING
+//
+
+static constexpr std::size_t kSegmentedElementCount = 100000UL;
+
+
+static void Append_Many_Fields_MFA(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::multi_field_array<float, std::string, int, int, int, int> multi_field_array;
+    for (std::size_t i = 0; i < kSegmentedElementCount; ++i)
+    {
+      multi_field_array.emplace_back(1.f, std::string{}, 1, 2, 3, 4);
+    }
+    benchmark::DoNotOptimize(multi_field_array);
+  }
+}
+BENCHMARK(Append_Many_Fields_MFA);
+
+
+static void Append_Many_Fields_Segmented(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mf::segmented_multi_field_array<1024, float, std::string, int, int, int, int> segmented_multi_field_array;
+    for (std::size_t i = 0; i < kSegmentedElementCount; ++i)
+    {
+      segmented_multi_field_array.emplace_back(1.f, std::string{}, 1, 2, 3, 4);
+    }
+    benchmark::DoNotOptimize(segmented_multi_field_array);
+  }
+}
+BENCHMARK(Append_Many_Fields_Segmented);
+
+
+static void Iteration_Two_Of_Many_Fields_Segmented_Chunks(benchmark::State& state)
+{
+  mf::segmented_multi_field_array<1024, float, std::string, int, int, int, int> segmented_multi_field_array{
+    kSegmentedElementCount};
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (std::size_t chunk_index = 0; chunk_index < segmented_multi_field_array.chunk_count(); ++chunk_index)
+    {
+      for (const auto& [a, c] : segmented_multi_field_array.chunk<0, 2>(chunk_index))
+      {
+        sum += a + static_cast<float>(c);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(Iteration_Two_Of_Many_Fields_Segmented_Chunks);
+
+
+//
+// TILED BENCHMARKING
+//
+
+static constexpr std::size_t kTiledElementCount = 100000UL;
+
+
+template <typename ArrayT> static void Integrate_Six_Of_Eight_Fields(benchmark::State& state)
+{
+  ArrayT array{kTiledElementCount, std::make_tuple(1.f, 2.f, 3.f, 0.1f, 0.2f, 0.3f, 1, 2)};
+
+  for (auto _ : state)
+  {
+    for (auto [x, y, z, vx, vy, vz] : array.template view<0, 1, 2, 3, 4, 5>())
+    {
+      x += vx * 0.01f;
+      y += vy * 0.01f;
+      z += vz * 0.01f;
+    }
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK_TEMPLATE(
+  Integrate_Six_Of_Eight_Fields,
+  mf::multi_field_array<float, float, float, float, float, float, int, int>);
+BENCHMARK_TEMPLATE(
+  Integrate_Six_Of_Eight_Fields,
+  mf::tiled_multi_field_array<8, float, float, float, float, float, float, int, int>);
+
+
+static void Integrate_Six_Of_Eight_Fields_Tiled_By_Tile(benchmark::State& state)
+{
+  mf::tiled_multi_field_array<8, float, float, float, float, float, float, int, int> tiled_multi_field_array{
+    kTiledElementCount, std::make_tuple(1.f, 2.f, 3.f, 0.1f, 0.2f, 0.3f, 1, 2)};
+
+  for (auto _ : state)
+  {
+    for (auto tile : tiled_multi_field_array.view<0, 1, 2, 3, 4, 5>().tiles())
+    {
+      for (auto [x, y, z, vx, vy, vz] : tile)
+      {
+        x += vx * 0.01f;
+        y += vy * 0.01f;
+        z += vz * 0.01f;
+      }
+    }
+    benchmark::DoNotOptimize(tiled_multi_field_array);
+  }
+}
+BENCHMARK(Integrate_Six_Of_Eight_Fields_Tiled_By_Tile);
+
+//
+// GROUPED BENCHMARKING
+//
+
+struct Hot_Position
+{
+  float x;
+  float y;
+  float z;
+};
+
+struct Hot_Velocity
+{
+  float x;
+  float y;
+  float z;
+};
+
+
+static void Random_Access_Hot_Group_Of_Many_Fields_MFA(benchmark::State& state)
+{
+  mf::multi_field_array<Hot_Position, Hot_Velocity, std::string, int, double> multi_field_array;
+  multi_field_array.resize(1000000);
+
+  for (auto _ : state)
+  {
+    auto view = multi_field_array.view<Hot_Position, Hot_Velocity>();
+
+    const std::size_t index = std::rand() % multi_field_array.size();
+    const auto [p, v] = view[index];
+    const float sum = p.x * v.x + p.y * v.y + p.z * v.z;
+
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(Random_Access_Hot_Group_Of_Many_Fields_MFA);
+
+
+static void Random_Access_Hot_Group_Of_Many_Fields_Grouped(benchmark::State& state)
+{
+  mf::grouped_multi_field_array<mf::group<Hot_Position, Hot_Velocity>, std::string, int, double>
+    grouped_multi_field_array;
+  grouped_multi_field_array.resize(1000000);
+
+  for (auto _ : state)
+  {
+    auto view = grouped_multi_field_array.view<Hot_Position, Hot_Velocity>();
+
+    const std::size_t index = std::rand() % grouped_multi_field_array.size();
+    const auto [p, v] = view[index];
+    const float sum = p.x * v.x + p.y * v.y + p.z * v.z;
+
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(Random_Access_Hot_Group_Of_Many_Fields_Grouped);
+
+//
+// PACKED BENCHMARKING
+//
+
+static constexpr std::size_t kPackedElementCount = 1000000UL;
+
+
+static void Count_Active_Flags_MFA(benchmark::State& state)
+{
+  mf::multi_field_array<bool, int> multi_field_array{kPackedElementCount, std::make_tuple(false, 0)};
+  for (std::size_t i = 0; i < kPackedElementCount; i += 7)
+  {
+    multi_field_array.get<bool>(i) = true;
+  }
+
+  for (auto _ : state)
+  {
+    const auto count = std::count(multi_field_array.begin<bool>(), multi_field_array.end<bool>(), true);
+    benchmark::DoNotOptimize(count);
+  }
+}
+BENCHMARK(Count_Active_Flags_MFA);
+
+
+static void Count_Active_Flags_Packed(benchmark::State& state)
+{
+  mf::packed_multi_field_array<bool, int> packed_multi_field_array{kPackedElementCount};
+  for (std::size_t i = 0; i < kPackedElementCount; i += 7)
+  {
+    packed_multi_field_array.get<bool>(i) = true;
+  }
+
+  for (auto _ : state)
+  {
+    const auto count = packed_multi_field_array.bits<0>().count();
+    benchmark::DoNotOptimize(count);
+  }
+}
+BENCHMARK(Count_Active_Flags_Packed);
+
+//
+// ZIP ITERATOR BENCHMARKING
+//
+
+static constexpr std::size_t kZipElementCount = 100000UL;
+
+using Two_Float_Fields = mf::multi_field_array<float, float>;
+using Four_Float_Fields = mf::multi_field_array<float, float, float, float>;
+using Eight_Float_Fields = mf::multi_field_array<float, float, float, float, float, float, float, float>;
+
+
+template <typename ArrayT, bool Indexed> static void Sum_Into_First_Field(benchmark::State& state)
+{
+  ArrayT array;
+  array.resize(kZipElementCount);
+  for (auto row : array.view())
+  {
+    std::apply([](auto&... fields) { ((fields = 1.f), ...); }, row);
+  }
+
+  const auto sum_into_first = [](const auto& row) {
+    std::apply([](auto& first, const auto&... rest) { first += (rest + ...); }, row);
+  };
+
+  for (auto _ : state)
+  {
+    if constexpr (Indexed)
+    {
+      for (const auto& row : array.view().indexed())
+      {
+        sum_into_first(row);
+      }
+    }
+    else
+    {
+      for (const auto& row : array.view())
+      {
+        sum_into_first(row);
+      }
+    }
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Two_Float_Fields, false);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Two_Float_Fields, true);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Four_Float_Fields, false);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Four_Float_Fields, true);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Eight_Float_Fields, false);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field, Eight_Float_Fields, true);
+
+//
+// BATCH BENCHMARKING
+//
+// Row-at-a-time zip iteration against View::for_each_batch, which hands a single kernel fixed-width runs of
+// per-field pointers so that its inner loop has a compile-time trip count
+//
+template <typename ArrayT, std::size_t Width> static void Sum_Into_First_Field_Batched(benchmark::State& state)
+{
+  ArrayT array;
+  array.resize(kZipElementCount);
+  for (auto row : array.view())
+  {
+    std::apply([](auto&... fields) { ((fields = 1.f), ...); }, row);
+  }
+
+  for (auto _ : state)
+  {
+    array.view().template for_each_batch<Width>([](auto n, float* first, const auto*... rest) {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        first[i] += (rest[i] + ...);
+      }
+    });
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Two_Float_Fields, 8);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Two_Float_Fields, 16);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Four_Float_Fields, 8);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Four_Float_Fields, 16);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Eight_Float_Fields, 8);
+BENCHMARK_TEMPLATE(Sum_Into_First_Field_Batched, Eight_Float_Fields, 16);
+
+//
+// PARALLEL BENCHMARKING
+//
+// Per-element work whose cost grows along the array; static partitioning leaves the thread with the last chunk to
+// finish alone, while parallel_for_each steals from it
+//
+static constexpr std::size_t kSkewedElementCount = 1UL << 16UL;
+
+static float skewed_work(const std::size_t index, const float x)
+{
+  float y = x;
+  for (std::size_t n = 0; n < index / 1024UL; ++n)
+  {
+    y = std::sqrt(y + 1.f);
+  }
+  return y;
+}
+
+static void Skewed_Cost_For_Each_Serial(benchmark::State& state)
+{
+  mf::multi_field_array<float, std::size_t> array{kSkewedElementCount};
+  std::iota(array.begin<std::size_t>(), array.end<std::size_t>(), 0UL);
+
+  for (auto _ : state)
+  {
+    for (auto [x, index] : array.view())
+    {
+      x = skewed_work(index, x);
+    }
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK(Skewed_Cost_For_Each_Serial);
+
+
+static void Skewed_Cost_For_Each_Static_Partition(benchmark::State& state)
+{
+  mf::ThreadPool pool;
+  mf::multi_field_array<float, std::size_t> array{kSkewedElementCount};
+  std::iota(array.begin<std::size_t>(), array.end<std::size_t>(), 0UL);
+
+  for (auto _ : state)
+  {
+    pool.parallel_for(array.size(), [view = array.view()](const std::size_t first, const std::size_t last) mutable {
+      for (auto [x, index] : view.subview(first, last - first))
+      {
+        x = skewed_work(index, x);
+      }
+    });
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK(Skewed_Cost_For_Each_Static_Partition);
+
+
+static void Skewed_Cost_For_Each_Parallel(benchmark::State& state)
+{
+  mf::ThreadPool pool;
+  mf::multi_field_array<float, std::size_t> array{kSkewedElementCount};
+  std::iota(array.begin<std::size_t>(), array.end<std::size_t>(), 0UL);
+
+  for (auto _ : state)
+  {
+    mf::parallel_for_each(pool, array.view(), [](float& x, const std::size_t index) { x = skewed_work(index, x); });
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK(Skewed_Cost_For_Each_Parallel);
+
+//
+// REDUCTION BENCHMARKING
+//
+// Scalar loops over one field against the lane-wise kernels in mf/reduction.hpp
+//
+static constexpr std::size_t kReductionElementCount = 1UL << 20UL;
+
+template <typename ArrayT> static ArrayT make_reduction_array()
+{
+  ArrayT array{kReductionElementCount};
+  for (std::size_t i = 0; i < array.size(); ++i)
+  {
+    array.template get<float>(i) = static_cast<float>((i * 7919UL) % 1000UL);
+  }
+  return array;
+}
+
+static void Sum_Float_Field_Scalar(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(std::accumulate(array.begin<float>(), array.end<float>(), 0.f));
+  }
+}
+BENCHMARK(Sum_Float_Field_Scalar);
+
+
+static void Sum_Float_Field_Reduction(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::sum(array.view<float>()));
+  }
+}
+BENCHMARK(Sum_Float_Field_Reduction);
+
+
+static void Min_Float_Field_Scalar(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(*std::min_element(array.begin<float>(), array.end<float>()));
+  }
+}
+BENCHMARK(Min_Float_Field_Scalar);
+
+
+static void Min_Float_Field_Reduction(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::min(array.view<float>()));
+  }
+}
+BENCHMARK(Min_Float_Field_Reduction);
+
+
+static void ArgMin_Float_Field_Scalar(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(std::distance(
+      array.begin<float>(), std::min_element(array.begin<float>() + 1, array.end<float>())));
+  }
+}
+BENCHMARK(ArgMin_Float_Field_Scalar);
+
+
+static void ArgMin_Float_Field_Reduction(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::argmin(array.view<float>().subview(1, array.size() - 1)));
+  }
+}
+BENCHMARK(ArgMin_Float_Field_Reduction);
+
+//
+// FIND BENCHMARKING
+//
+// std::find over one field against the compare and move-mask kernels in mf/find.hpp; the value searched for is the
+// last element, so every element is compared
+//
+template <typename T> static mf::multi_field_array<T, std::string> make_find_array()
+{
+  mf::multi_field_array<T, std::string> array{kReductionElementCount};
+  std::fill(array.template begin<T>(), array.template end<T>(), T{1});
+  array.template get<T>(array.size() - 1) = T{2};
+  return array;
+}
+
+template <typename T> static void Find_Last_Scalar(benchmark::State& state)
+{
+  const auto array = make_find_array<T>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(std::find(array.template begin<T>(), array.template end<T>(), T{2}));
+  }
+}
+BENCHMARK_TEMPLATE(Find_Last_Scalar, std::uint8_t);
+BENCHMARK_TEMPLATE(Find_Last_Scalar, int);
+BENCHMARK_TEMPLATE(Find_Last_Scalar, float);
+BENCHMARK_TEMPLATE(Find_Last_Scalar, double);
+
+
+template <typename T> static void Find_Last_Vectorized(benchmark::State& state)
+{
+  const auto array = make_find_array<T>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::find(array.template view<T>(), T{2}));
+  }
+}
+BENCHMARK_TEMPLATE(Find_Last_Vectorized, std::uint8_t);
+BENCHMARK_TEMPLATE(Find_Last_Vectorized, int);
+BENCHMARK_TEMPLATE(Find_Last_Vectorized, float);
+BENCHMARK_TEMPLATE(Find_Last_Vectorized, double);
+
+
+static void Find_All_Less_Scalar(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i < array.size(); ++i)
+    {
+      if (array.get<float>(i) < 10.f)
+      {
+        positions.push_back(i);
+      }
+    }
+    benchmark::DoNotOptimize(positions);
+  }
+}
+BENCHMARK(Find_All_Less_Scalar);
+
+
+static void Find_All_Less_Vectorized(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::find_all(array.view<float>(), mf::less(10.f)));
+  }
+}
+BENCHMARK(Find_All_Less_Vectorized);
+
+
+static void Find_All_Mask_Less_Vectorized(benchmark::State& state)
+{
+  const auto array = make_reduction_array<mf::multi_field_array<float, int>>();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mf::find_all_mask(array.view<float>(), mf::less(10.f)));
+  }
+}
+BENCHMARK(Find_All_Mask_Less_Vectorized);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <new>
+#include <string>
+#include <type_traits>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/arena_allocator_adapter.hpp>
+
+TEST(MonotonicArena, AllocateAligned)
+{
+  mf::MonotonicArena arena{1024};
+
+  auto* const a = arena.allocate(3, 1);
+  auto* const b = arena.allocate(8, 8);
+
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(b) % 8, 0UL);
+  ASSERT_GE(b, a + 3);
+  ASSERT_LE(arena.used(), 3UL + 8UL + 7UL);
+
+  arena.reset();
+
+  ASSERT_EQ(arena.used(), 0UL);
+}
+
+TEST(MonotonicArena, NotMovable)
+{
+  // Adapters refer to their arena by address
+  static_assert(!std::is_move_constructible_v<mf::MonotonicArena>);
+  static_assert(!std::is_move_assignable_v<mf::MonotonicArena>);
+}
+
+TEST(MonotonicArena, AllocateExhausted)
+{
+  mf::MonotonicArena arena{16};
+
+  ASSERT_THROW(arena.allocate(17, 1), std::bad_alloc);
+}
+
+TEST(MonotonicArena, ResizeMostRecentInPlace)
+{
+  mf::MonotonicArena arena{1024};
+
+  auto* const a = arena.allocate(16, 1);
+  auto* const b = arena.allocate(16, 1);
+
+  ASSERT_FALSE(arena.resize_in_place(a, 16, 32));
+  ASSERT_TRUE(arena.resize_in_place(b, 16, 32));
+  ASSERT_EQ(arena.used(), 48UL);
+  ASSERT_FALSE(arena.resize_in_place(b, 32, 2048));
+}
+
+TEST(ArenaAllocatorAdapter, MultiFieldArrayGrowsInPlace)
+{
+  mf::MonotonicArena arena{1UL << 20UL};
+
+  mf::arena_multi_field_array<char, double, int> array{mf::arena_allocator_adapter<char, double, int>{arena}};
+
+  array.emplace_back('a', 0.0, 0);
+
+  // Growth of the most recent allocation should not consume any more of the arena than the final layout
+  for (int i = 1; i < 1000; ++i)
+  {
+    array.emplace_back(static_cast<char>('a' + i % 26), static_cast<double>(i), i);
+  }
+
+  using layout_type = mf::arena_allocator_adapter<char, double, int>::layout_type;
+  ASSERT_EQ(arena.used(), layout_type::length(array.capacity()));
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(array.get<char>(i), static_cast<char>('a' + i % 26));
+    ASSERT_EQ(array.get<double>(i), static_cast<double>(i));
+    ASSERT_EQ(array.get<int>(i), i);
+  }
+}
+
+TEST(ArenaAllocatorAdapter, MultiFieldArrayInterleavedGrowth)
+{
+  mf::MonotonicArena arena{1UL << 20UL};
+
+  mf::arena_multi_field_array<float, int> array_a{mf::arena_allocator_adapter<float, int>{arena}};
+  mf::arena_multi_field_array<float, int> array_b{mf::arena_allocator_adapter<float, int>{arena}};
+
+  for (int i = 0; i < 500; ++i)
+  {
+    array_a.emplace_back(static_cast<float>(i), i);
+    array_b.emplace_back(static_cast<float>(-i), -i);
+  }
+
+  for (int i = 0; i < 500; ++i)
+  {
+    ASSERT_EQ(array_a.get<float>(i), static_cast<float>(i));
+    ASSERT_EQ(array_a.get<int>(i), i);
+    ASSERT_EQ(array_b.get<float>(i), static_cast<float>(-i));
+    ASSERT_EQ(array_b.get<int>(i), -i);
+  }
+}
+
+TEST(ArenaAllocatorAdapter, MultiFieldArrayNonRelocatableFields)
+{
+  mf::MonotonicArena arena{1UL << 20UL};
+
+  mf::arena_multi_field_array<int, std::string> array{mf::arena_allocator_adapter<int, std::string>{arena}};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    array.emplace_back(i, std::to_string(i));
+  }
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(array.get<int>(i), i);
+    ASSERT_EQ(array.get<std::string>(i), std::to_string(i));
+  }
+}
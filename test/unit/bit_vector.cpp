@@ -0,0 +1,170 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/bit_vector.hpp>
+
+TEST(BitVector, DefaultCTor)
+{
+  mf::bit_vector bit_vector;
+
+  ASSERT_TRUE(bit_vector.empty());
+  ASSERT_EQ(bit_vector.size(), 0UL);
+  ASSERT_EQ(bit_vector.word_count(), 0UL);
+  ASSERT_EQ(bit_vector.find_first(), 0UL);
+  ASSERT_TRUE(bit_vector.none());
+}
+
+TEST(BitVector, InitialSizeAndValueCTor)
+{
+  mf::bit_vector bit_vector{130, true};
+
+  ASSERT_EQ(bit_vector.size(), 130UL);
+  ASSERT_EQ(bit_vector.word_count(), 3UL);
+  ASSERT_EQ(bit_vector.count(), 130UL);
+  ASSERT_TRUE(bit_vector.all());
+  ASSERT_EQ(bit_vector.data()[2], 0b11UL);
+}
+
+TEST(BitVector, ProxyReferences)
+{
+  mf::bit_vector bit_vector{100};
+
+  bit_vector[3] = true;
+  bit_vector[70] = bit_vector[3];
+  bit_vector.at(99).flip();
+
+  ASSERT_TRUE(bit_vector[3]);
+  ASSERT_TRUE(bit_vector.test(70));
+  ASSERT_TRUE(bit_vector[99]);
+  ASSERT_FALSE(bit_vector[4]);
+  ASSERT_EQ(bit_vector.count(), 3UL);
+  ASSERT_THROW(bit_vector.at(100), std::out_of_range);
+}
+
+TEST(BitVector, FillThroughIterators)
+{
+  mf::bit_vector bit_vector{200};
+
+  std::fill(bit_vector.begin() + 10, bit_vector.end(), true);
+
+  ASSERT_EQ(std::distance(bit_vector.begin(), bit_vector.end()), 200);
+  ASSERT_EQ(bit_vector.count(), 190UL);
+  ASSERT_EQ(std::count(std::as_const(bit_vector).begin(), std::as_const(bit_vector).end(), true), 190);
+  ASSERT_EQ(bit_vector.find_first(), 10UL);
+}
+
+TEST(BitVector, SetAndResetAll)
+{
+  mf::bit_vector bit_vector{70};
+
+  bit_vector.set();
+  ASSERT_EQ(bit_vector.count(), 70UL);
+
+  bit_vector.resize(66);
+  ASSERT_EQ(bit_vector.count(), 66UL);
+
+  bit_vector.resize(140, false);
+  ASSERT_EQ(bit_vector.count(), 66UL);
+
+  bit_vector.resize(200, true);
+  ASSERT_EQ(bit_vector.count(), 126UL);
+  ASSERT_FALSE(bit_vector[139]);
+  ASSERT_TRUE(bit_vector[140]);
+
+  bit_vector.reset();
+  ASSERT_TRUE(bit_vector.none());
+}
+
+TEST(BitVector, PushBackAndPopBack)
+{
+  mf::bit_vector bit_vector;
+  for (std::size_t i = 0; i < 129; ++i)
+  {
+    bit_vector.push_back(i % 2 == 0);
+  }
+
+  ASSERT_EQ(bit_vector.size(), 129UL);
+  ASSERT_EQ(bit_vector.word_count(), 3UL);
+  ASSERT_EQ(bit_vector.count(), 65UL);
+
+  bit_vector.pop_back();
+  ASSERT_EQ(bit_vector.word_count(), 2UL);
+  ASSERT_EQ(bit_vector.count(), 64UL);
+}
+
+TEST(BitVector, FindAndForEachSet)
+{
+  mf::bit_vector bit_vector{1000};
+  const std::vector<std::size_t> expected = {1, 63, 64, 500, 999};
+  for (const auto pos : expected)
+  {
+    bit_vector.set(pos);
+  }
+
+  std::vector<std::size_t> found;
+  for (auto pos = bit_vector.find_first(); pos < bit_vector.size(); pos = bit_vector.find_next(pos))
+  {
+    found.push_back(pos);
+  }
+  ASSERT_EQ(found, expected);
+
+  found.clear();
+  bit_vector.for_each_set([&found](const std::size_t pos) { found.push_back(pos); });
+  ASSERT_EQ(found, expected);
+  ASSERT_EQ(bit_vector.find_next(999), 1000UL);
+}
+
+TEST(BitVector, ForEachSetInAll)
+{
+  mf::bit_vector first{300};
+  mf::bit_vector second{300};
+  for (std::size_t i = 0; i < 300; ++i)
+  {
+    first[i] = (i % 2 == 0);
+    second[i] = (i % 3 == 0);
+  }
+
+  std::size_t count = 0;
+  mf::for_each_set(
+    [&count](const std::size_t pos) {
+      ASSERT_EQ(pos % 6, 0UL);
+      ++count;
+    },
+    first,
+    second);
+  ASSERT_EQ(count, 50UL);
+
+  first &= second;
+  ASSERT_EQ(first.count(), 50UL);
+  first |= second;
+  ASSERT_EQ(first, second);
+}
+
+TEST(BitVector, CopyAndMove)
+{
+  mf::bit_vector bit_vector{100, true};
+
+  auto copied = bit_vector;
+  ASSERT_EQ(copied, bit_vector);
+
+  auto moved = std::move(bit_vector);
+  ASSERT_EQ(moved.count(), 100UL);
+  ASSERT_TRUE(bit_vector.empty());
+  ASSERT_EQ(bit_vector.word_count(), 0UL);
+
+  moved.pop_back();
+  moved.swap(copied);
+  ASSERT_EQ(moved.size(), 100UL);
+  ASSERT_EQ(copied.size(), 99UL);
+}
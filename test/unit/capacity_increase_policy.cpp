@@ -0,0 +1,80 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/capacity_increase_policy.hpp>
+#include <mf/multi_field_array.hpp>
+
+TEST(CapacityIncreasePolicy, Default)
+{
+  ASSERT_EQ(mf::next_capacity<mf::DefaultCapacityIncreasePolicy>(0, 4), 2UL);
+  ASSERT_EQ(mf::next_capacity<mf::DefaultCapacityIncreasePolicy>(3, 4), 8UL);
+}
+
+TEST(CapacityIncreasePolicy, Geometric)
+{
+  using policy_type = mf::GeometricCapacityIncreasePolicy<3, 2, 8>;
+  ASSERT_EQ(mf::next_capacity<policy_type>(1, 4), 8UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(100, 4), 150UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(101, 4), 152UL);
+}
+
+TEST(CapacityIncreasePolicy, FixedStep)
+{
+  using policy_type = mf::FixedStepCapacityIncreasePolicy<64>;
+  ASSERT_EQ(mf::next_capacity<policy_type>(1, 4), 64UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(64, 4), 64UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(65, 4), 128UL);
+}
+
+TEST(CapacityIncreasePolicy, Hybrid)
+{
+  using policy_type = mf::HybridCapacityIncreasePolicy<1024, 256>;
+
+  // Geometric below 1024 bytes
+  ASSERT_EQ(mf::next_capacity<policy_type>(10, 8), 20UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(127, 8), 254UL);
+
+  // Steps of 256 bytes (32 elements) past 1024 bytes
+  ASSERT_EQ(mf::next_capacity<policy_type>(128, 8), 128UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(129, 8), 160UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(1000, 8), 1024UL);
+}
+
+TEST(CapacityIncreasePolicy, PageRounded)
+{
+  using policy_type = mf::PageRoundedCapacityIncreasePolicy<mf::FixedStepCapacityIncreasePolicy<1>, 4096>;
+  ASSERT_EQ(mf::next_capacity<policy_type>(1, 12), 341UL);
+  ASSERT_EQ(mf::next_capacity<policy_type>(342, 12), 682UL);
+
+  using huge_page_policy_type = mf::HugePageRoundedCapacityIncreasePolicy<>;
+  ASSERT_EQ(mf::next_capacity<huge_page_policy_type>(1, 8), mf::huge_page_size / 8UL);
+}
+
+TEST(CapacityIncreasePolicy, MultiFieldArrayGrowthInBytes)
+{
+  mf::BasicMultiFieldArray<
+    std::tuple<int, float>,
+    mf::default_allocator_adapter<int, float>,
+    mf::PageRoundedCapacityIncreasePolicy<mf::GeometricCapacityIncreasePolicy<>>>
+    multi_field_array;
+
+  multi_field_array.emplace_back(1, 1.f);
+
+  ASSERT_EQ(multi_field_array.capacity(), mf::page_size / (sizeof(int) + sizeof(float)));
+
+  for (int i = 1; i < 10000; ++i)
+  {
+    multi_field_array.emplace_back(i, static_cast<float>(i));
+    ASSERT_LE(multi_field_array.capacity() * 2UL, multi_field_array.size() * 3UL + mf::page_size);
+  }
+  ASSERT_EQ(multi_field_array.get<int>(9999), 9999);
+}
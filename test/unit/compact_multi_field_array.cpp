@@ -0,0 +1,194 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/compact_multi_field_array.hpp>
+#include <mf/multi_field_array.hpp>
+
+TEST(CompactMultiFieldArray, ObjectSize)
+{
+  using array_type = mf::compact_multi_field_array<float, int, double, char, std::string, short, std::uint64_t>;
+  using non_compact_array_type = mf::multi_field_array<float, int, double, char, std::string, short, std::uint64_t>;
+  ASSERT_EQ(sizeof(array_type), sizeof(void*) + 2 * sizeof(std::uint32_t));
+  ASSERT_LT(sizeof(array_type), sizeof(non_compact_array_type));
+}
+
+TEST(CompactMultiFieldArray, DefaultCTor)
+{
+  mf::compact_multi_field_array<float, int, std::string> compact_multi_field_array;
+
+  ASSERT_TRUE(compact_multi_field_array.empty());
+  ASSERT_EQ(compact_multi_field_array.size(), 0UL);
+  ASSERT_EQ(compact_multi_field_array.capacity(), 0UL);
+}
+
+TEST(CompactMultiFieldArray, InitialSizeAndValueCTor)
+{
+  mf::compact_multi_field_array<float, int, std::string> compact_multi_field_array{
+    10, std::forward_as_tuple(4.f, 1, "bbb")};
+
+  ASSERT_EQ(compact_multi_field_array.size(), 10UL);
+  ASSERT_GE(compact_multi_field_array.capacity(), 10UL);
+  for (const auto& [f, i, s] : compact_multi_field_array)
+  {
+    ASSERT_EQ(f, 4.f);
+    ASSERT_EQ(i, 1);
+    ASSERT_EQ(s, "bbb");
+  }
+}
+
+TEST(CompactMultiFieldArray, FieldOffsetsMatchLayout)
+{
+  using array_type = mf::compact_multi_field_array<char, double, short, std::string>;
+  array_type compact_multi_field_array{3};
+
+  const auto capacity = compact_multi_field_array.capacity();
+  ASSERT_EQ(capacity % array_type::capacity_alignment, 0UL);
+
+  const auto offsets = array_type::layout_type::offsets(capacity);
+  const auto* const block = reinterpret_cast<const std::uint8_t*>(compact_multi_field_array.data<0>());
+  ASSERT_EQ(reinterpret_cast<const std::uint8_t*>(compact_multi_field_array.data<1>()), block + offsets[1]);
+  ASSERT_EQ(reinterpret_cast<const std::uint8_t*>(compact_multi_field_array.data<2>()), block + offsets[2]);
+  ASSERT_EQ(reinterpret_cast<const std::uint8_t*>(compact_multi_field_array.data<3>()), block + offsets[3]);
+}
+
+TEST(CompactMultiFieldArray, EmplaceBackGrows)
+{
+  mf::compact_multi_field_array<int, std::string> compact_multi_field_array;
+  for (int i = 0; i < 1000; ++i)
+  {
+    compact_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  ASSERT_EQ(compact_multi_field_array.size(), 1000UL);
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(compact_multi_field_array.get<int>(i), i);
+    ASSERT_EQ(compact_multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+TEST(CompactMultiFieldArray, PushBackPopBack)
+{
+  mf::compact_multi_field_array<int, std::string> compact_multi_field_array;
+  compact_multi_field_array.push_back(std::make_tuple(1, std::string{"one"}));
+  compact_multi_field_array.push_back(std::make_tuple(2, std::string{"two"}));
+  compact_multi_field_array.pop_back();
+
+  ASSERT_EQ(compact_multi_field_array.size(), 1UL);
+  ASSERT_EQ(compact_multi_field_array.get<std::string>(0), "one");
+}
+
+TEST(CompactMultiFieldArray, ResizeAndShrinkToFit)
+{
+  mf::compact_multi_field_array<double, std::string> compact_multi_field_array;
+  compact_multi_field_array.resize(100, std::forward_as_tuple(1.0, "ok"));
+  compact_multi_field_array.resize(3);
+  compact_multi_field_array.shrink_to_fit();
+
+  ASSERT_EQ(compact_multi_field_array.size(), 3UL);
+  ASSERT_LT(compact_multi_field_array.capacity(), 100UL);
+  ASSERT_EQ(compact_multi_field_array.get<std::string>(2), "ok");
+
+  compact_multi_field_array.clear();
+  compact_multi_field_array.shrink_to_fit();
+  ASSERT_EQ(compact_multi_field_array.capacity(), 0UL);
+}
+
+TEST(CompactMultiFieldArray, View)
+{
+  mf::compact_multi_field_array<float, int, std::string> compact_multi_field_array{10};
+  for (auto [i, s] : compact_multi_field_array.view<int, std::string>())
+  {
+    i = 5;
+    s = "set";
+  }
+
+  ASSERT_EQ(compact_multi_field_array.get<int>(9), 5);
+  ASSERT_EQ(std::get<2>(compact_multi_field_array[9]), "set");
+  ASSERT_EQ(std::get<0>(compact_multi_field_array.at(9)), 0.f);
+  ASSERT_THROW(compact_multi_field_array.at(10), std::out_of_range);
+}
+
+TEST(CompactMultiFieldArray, CopyCTor)
+{
+  mf::compact_multi_field_array<int, std::string> compact_multi_field_array{10, std::forward_as_tuple(1, "copy")};
+  const auto copied_multi_field_array = compact_multi_field_array;
+
+  ASSERT_EQ(copied_multi_field_array.size(), 10UL);
+  ASSERT_NE(copied_multi_field_array.data<int>(), compact_multi_field_array.data<int>());
+  ASSERT_EQ(copied_multi_field_array.get<std::string>(9), "copy");
+}
+
+TEST(CompactMultiFieldArray, MoveCTor)
+{
+  mf::compact_multi_field_array<int, std::string> compact_multi_field_array{10, std::forward_as_tuple(1, "move")};
+  const auto* const data = compact_multi_field_array.data<std::string>();
+  const auto moved_multi_field_array = std::move(compact_multi_field_array);
+
+  ASSERT_EQ(moved_multi_field_array.size(), 10UL);
+  ASSERT_EQ(moved_multi_field_array.data<std::string>(), data);
+  ASSERT_TRUE(compact_multi_field_array.empty());
+  ASSERT_EQ(compact_multi_field_array.capacity(), 0UL);
+}
+
+TEST(CompactMultiFieldArray, CopyAndMoveAssign)
+{
+  mf::compact_multi_field_array<int, std::string> compact_multi_field_array{10, std::forward_as_tuple(1, "assign")};
+  mf::compact_multi_field_array<int, std::string> assigned_multi_field_array{3};
+
+  assigned_multi_field_array = compact_multi_field_array;
+  ASSERT_EQ(assigned_multi_field_array.size(), 10UL);
+  ASSERT_EQ(assigned_multi_field_array.get<std::string>(9), "assign");
+
+  assigned_multi_field_array = std::move(compact_multi_field_array);
+  ASSERT_EQ(assigned_multi_field_array.size(), 10UL);
+  ASSERT_TRUE(compact_multi_field_array.empty());
+}
+
+TEST(CompactMultiFieldArray, MaxSize)
+{
+  using array_type = mf::BasicCompactMultiFieldArray<
+    std::tuple<int, char>,
+    mf::single_allocator_adapter<int, char>,
+    mf::DefaultCapacityIncreasePolicy,
+    std::uint8_t>;
+  array_type compact_multi_field_array;
+
+  ASSERT_EQ(array_type::max_size(), 252UL);
+  for (int i = 0; i < 252; ++i)
+  {
+    compact_multi_field_array.emplace_back(i, 'c');
+  }
+  ASSERT_EQ(compact_multi_field_array.capacity(), 252UL);
+  ASSERT_EQ(compact_multi_field_array.get<int>(251), 251);
+  ASSERT_THROW(compact_multi_field_array.emplace_back(0, 'c'), std::length_error);
+}
+
+TEST(CompactMultiFieldArray, StatefulAllocatorAdapter)
+{
+  std::pmr::monotonic_buffer_resource resource;
+  using array_type = mf::BasicCompactMultiFieldArray<
+    std::tuple<int, std::string>,
+    mf::pmr::single_allocator_adapter<int, std::string>,
+    mf::DefaultCapacityIncreasePolicy,
+    std::uint32_t>;
+  array_type compact_multi_field_array{array_type::allocator_adapter_type{&resource}};
+  compact_multi_field_array.resize(10, std::forward_as_tuple(1, "pmr"));
+
+  ASSERT_EQ(compact_multi_field_array.get_allocator_adapter(), array_type::allocator_adapter_type{&resource});
+  ASSERT_EQ(compact_multi_field_array.get<std::string>(9), "pmr");
+}
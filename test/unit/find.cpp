@@ -0,0 +1,162 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/find.hpp>
+#include <mf/multi_field_array.hpp>
+
+namespace
+{
+
+/**
+ * @brief Returns positions where \c predicate is true, found one element at a time
+ */
+template <typename ViewT, typename PredicateT>
+std::vector<std::size_t> scalar_find_all(ViewT view, PredicateT predicate)
+{
+  std::vector<std::size_t> positions;
+  for (std::size_t i = 0; i < view.size(); ++i)
+  {
+    if (predicate(std::get<0>(view[i])))
+    {
+      positions.push_back(i);
+    }
+  }
+  return positions;
+}
+
+/**
+ * @brief Checks every comparison predicate against a field of \c T, with values spanning the whole range of \c T
+ */
+template <typename T> void check_all_comparisons()
+{
+  mf::multi_field_array<T, std::string> multi_field_array{1001};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    const T value = (i % 3 == 0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+    multi_field_array.template get<T>(i) = (i % 5 == 0) ? T{7} : value;
+  }
+
+  const auto view = multi_field_array.template view<T>();
+  ASSERT_EQ(mf::find_all(view, mf::equal_to(T{7})), scalar_find_all(view, mf::equal_to(T{7})));
+  ASSERT_EQ(mf::find_all(view, mf::not_equal_to(T{7})), scalar_find_all(view, mf::not_equal_to(T{7})));
+  ASSERT_EQ(mf::find_all(view, mf::less(T{7})), scalar_find_all(view, mf::less(T{7})));
+  ASSERT_EQ(mf::find_all(view, mf::less_equal(T{7})), scalar_find_all(view, mf::less_equal(T{7})));
+  ASSERT_EQ(mf::find_all(view, mf::greater(T{7})), scalar_find_all(view, mf::greater(T{7})));
+  ASSERT_EQ(mf::find_all(view, mf::greater_equal(T{7})), scalar_find_all(view, mf::greater_equal(T{7})));
+}
+
+}  // namespace
+
+TEST(Find, FindValue)
+{
+  mf::multi_field_array<int, std::string> multi_field_array{1000};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    multi_field_array.get<int>(i) = static_cast<int>(i % 500);
+    multi_field_array.get<std::string>(i) = std::to_string(i);
+  }
+
+  ASSERT_EQ(mf::find(multi_field_array.view<int>(), 0), 0UL);
+  ASSERT_EQ(mf::find(multi_field_array.view<int>(), 499), 499UL);
+  ASSERT_EQ(mf::find(multi_field_array.view<int>(), 500), 1000UL);
+  ASSERT_EQ(mf::find(multi_field_array.view<int>().subview(1, 999), 0), 499UL);
+  ASSERT_EQ(mf::find(multi_field_array.view<std::string>(), "999"), 999UL);
+
+  const auto& const_multi_field_array = multi_field_array;
+  const auto position = mf::find(const_multi_field_array.view<int>(), 42);
+  ASSERT_EQ(const_multi_field_array.get<std::string>(position), "42");
+
+  ASSERT_EQ(mf::find(mf::multi_field_array<float>{}.view(), 0.f), 0UL);
+}
+
+TEST(Find, FindIfPredicates)
+{
+  mf::multi_field_array<float, double> multi_field_array{100};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    multi_field_array.get<float>(i) = static_cast<float>(i);
+    multi_field_array.get<double>(i) = -static_cast<double>(i);
+  }
+
+  ASSERT_EQ(mf::find_if(multi_field_array.view<float>(), mf::greater(41.5f)), 42UL);
+  ASSERT_EQ(mf::find_if(multi_field_array.view<float>(), mf::greater_equal(99.f)), 99UL);
+  ASSERT_EQ(mf::find_if(multi_field_array.view<double>(), mf::less(-97.0)), 98UL);
+  ASSERT_EQ(mf::find_if(multi_field_array.view<double>(), mf::less(-1000.0)), 100UL);
+
+  // Other predicates are evaluated one element at a time
+  ASSERT_EQ(mf::find_if(multi_field_array.view<float>(), [](const float f) { return f * f > 50.f; }), 8UL);
+}
+
+TEST(Find, FindMixedTypePredicates)
+{
+  mf::multi_field_array<float> multi_field_array;
+  multi_field_array.emplace_back(1.5f);
+  multi_field_array.emplace_back(-0.5f);
+  multi_field_array.emplace_back(1.f);
+
+  // Elements are compared as floats, not converted to the type of the predicate value
+  ASSERT_EQ(mf::find_if(multi_field_array.view(), mf::equal_to(1)), 2UL);
+  ASSERT_EQ(mf::find_if(multi_field_array.view(), mf::less(0)), 1UL);
+  ASSERT_EQ(mf::find_all(multi_field_array.view(), mf::equal_to(1)).size(), 1UL);
+  ASSERT_EQ(mf::find_all(multi_field_array.view(), mf::greater(1)), std::vector<std::size_t>{0});
+}
+
+TEST(Find, FindNaN)
+{
+  mf::multi_field_array<float> multi_field_array{70};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    multi_field_array.get<float>(i) = (i == 65) ? std::numeric_limits<float>::quiet_NaN() : 1.f;
+  }
+
+  ASSERT_EQ(mf::find_all(multi_field_array.view(), mf::not_equal_to(1.f)), std::vector<std::size_t>{65});
+  ASSERT_EQ(mf::find_all(multi_field_array.view(), mf::less_equal(1.f)).size(), 69UL);
+  ASSERT_EQ(mf::find_if(multi_field_array.view(), mf::equal_to(std::numeric_limits<float>::quiet_NaN())), 70UL);
+}
+
+TEST(Find, FindAllComparisons)
+{
+  check_all_comparisons<std::int8_t>();
+  check_all_comparisons<std::uint8_t>();
+  check_all_comparisons<std::int16_t>();
+  check_all_comparisons<std::uint16_t>();
+  check_all_comparisons<std::int32_t>();
+  check_all_comparisons<std::uint32_t>();
+  check_all_comparisons<std::int64_t>();
+  check_all_comparisons<float>();
+  check_all_comparisons<double>();
+}
+
+TEST(Find, FindAllMask)
+{
+  mf::multi_field_array<std::uint16_t, float> multi_field_array{300};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    multi_field_array.get<std::uint16_t>(i) = static_cast<std::uint16_t>(i % 4);
+    multi_field_array.get<float>(i) = static_cast<float>(i % 6);
+  }
+
+  auto mask = mf::find_all_mask(multi_field_array.view<std::uint16_t>(), mf::equal_to(std::uint16_t{0}));
+  ASSERT_EQ(mask.size(), 300UL);
+  ASSERT_EQ(mask.count(), 75UL);
+
+  // Combined with a mask over a second field
+  mask &= mf::find_all_mask(multi_field_array.view<float>(), mf::equal_to(0.f));
+  std::vector<std::size_t> positions;
+  mask.for_each_set([&positions](const std::size_t pos) { positions.push_back(pos); });
+  ASSERT_EQ(positions.size(), 25UL);
+  ASSERT_EQ(positions[1], 12UL);
+  ASSERT_EQ(positions.back(), 288UL);
+}
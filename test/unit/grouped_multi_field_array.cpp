@@ -0,0 +1,216 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/grouped_multi_field_array.hpp>
+
+namespace
+{
+
+struct Position
+{
+  float x;
+  float y;
+};
+
+struct Velocity
+{
+  float dx;
+  float dy;
+};
+
+using entity_array = mf::grouped_multi_field_array<mf::group<Position, Velocity>, std::string, int>;
+
+}  // namespace
+
+TEST(GroupedMultiFieldArray, FieldGroupLayout)
+{
+  using group_type = mf::field_group_storage_t<mf::group<Position, Velocity>>;
+
+  static_assert(std::is_same_v<group_type, mf::FieldGroup<Position, Velocity>>);
+  static_assert(std::is_same_v<mf::field_group_storage_t<int>, int>);
+  static_assert(mf::is_trivially_relocatable_v<group_type>);
+  static_assert(!mf::is_trivially_relocatable_v<mf::FieldGroup<int, std::string>>);
+
+  ASSERT_EQ(sizeof(group_type), sizeof(Position) + sizeof(Velocity));
+  ASSERT_EQ(entity_array::stride_of<Position>, sizeof(group_type));
+  ASSERT_EQ(entity_array::stride_of<Velocity>, sizeof(group_type));
+  ASSERT_EQ(entity_array::stride_of<int>, sizeof(int));
+  ASSERT_EQ(entity_array::group_index_of<Velocity>, 0UL);
+  ASSERT_EQ(entity_array::group_index_of<int>, 2UL);
+}
+
+TEST(GroupedMultiFieldArray, DefaultCTor)
+{
+  entity_array grouped_multi_field_array;
+
+  ASSERT_TRUE(grouped_multi_field_array.empty());
+  ASSERT_EQ(grouped_multi_field_array.size(), 0UL);
+  ASSERT_EQ(grouped_multi_field_array.capacity(), 0UL);
+  ASSERT_EQ(grouped_multi_field_array.data<Position>(), nullptr);
+  ASSERT_EQ(grouped_multi_field_array.begin(), grouped_multi_field_array.end());
+}
+
+TEST(GroupedMultiFieldArray, InitialSizeAndValueCTor)
+{
+  entity_array grouped_multi_field_array{10, std::make_tuple(Position{1.f, 2.f}, Velocity{3.f, 4.f}, "a", 5)};
+
+  ASSERT_EQ(grouped_multi_field_array.size(), 10UL);
+  for (const auto& [p, v, s, n] : grouped_multi_field_array)
+  {
+    ASSERT_EQ(p.y, 2.f);
+    ASSERT_EQ(v.dx, 3.f);
+    ASSERT_EQ(s, "a");
+    ASSERT_EQ(n, 5);
+  }
+}
+
+TEST(GroupedMultiFieldArray, EmplaceBackAndGet)
+{
+  entity_array grouped_multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    const float f = static_cast<float>(i);
+    grouped_multi_field_array.emplace_back(Position{f, f}, Velocity{-f, -f}, std::to_string(i), i);
+  }
+  grouped_multi_field_array.emplace_back();
+
+  ASSERT_EQ(grouped_multi_field_array.size(), 101UL);
+  for (int i = 0; i < 100; ++i)
+  {
+    const auto& [p, v] = grouped_multi_field_array.get<Position, Velocity>(i);
+    ASSERT_EQ(p.x, static_cast<float>(i));
+    ASSERT_EQ(v.dy, -static_cast<float>(i));
+    ASSERT_EQ(grouped_multi_field_array.get<std::string>(i), std::to_string(i));
+    ASSERT_EQ(grouped_multi_field_array.get<int>(i), i);
+  }
+  ASSERT_EQ(grouped_multi_field_array.get<Velocity>(100).dx, 0.f);
+  ASSERT_TRUE(grouped_multi_field_array.get<std::string>(100).empty());
+}
+
+TEST(GroupedMultiFieldArray, GroupedFieldsAreInterleaved)
+{
+  entity_array grouped_multi_field_array{4};
+
+  const auto* const position = reinterpret_cast<const std::uint8_t*>(&grouped_multi_field_array.get<Position>(1));
+  const auto* const velocity = reinterpret_cast<const std::uint8_t*>(&grouped_multi_field_array.get<Velocity>(1));
+  ASSERT_EQ(velocity - position, static_cast<std::ptrdiff_t>(sizeof(Position)));
+
+  // Fields which are not in a group remain contiguous
+  ASSERT_EQ(&grouped_multi_field_array.get<int>(1), &grouped_multi_field_array.get<int>(0) + 1);
+  ASSERT_EQ(&grouped_multi_field_array.get<int>(0), grouped_multi_field_array.data<int>());
+}
+
+TEST(GroupedMultiFieldArray, DataAfterReserve)
+{
+  mf::grouped_multi_field_array<mf::group<char, std::string, double>, int> grouped_multi_field_array;
+  grouped_multi_field_array.reserve(8);
+
+  // No element exists yet, so pointers are computed from the start of each segment
+  const auto* const segment = reinterpret_cast<const std::uint8_t*>(grouped_multi_field_array.data<char>());
+  ASSERT_NE(segment, nullptr);
+  ASSERT_EQ(
+    reinterpret_cast<const std::uint8_t*>(grouped_multi_field_array.data<double>()) - segment,
+    static_cast<std::ptrdiff_t>(decltype(grouped_multi_field_array)::offset_of<double>));
+  ASSERT_NE(grouped_multi_field_array.data<int>(), nullptr);
+
+  auto view = grouped_multi_field_array.view<std::string, int>();
+  ASSERT_EQ(view.begin(), view.end());
+
+  grouped_multi_field_array.emplace_back('a', "b", 0.5, 1);
+  ASSERT_EQ(grouped_multi_field_array.data<char>(), &grouped_multi_field_array.get<char>(0));
+  ASSERT_EQ(grouped_multi_field_array.data<std::string>(), &grouped_multi_field_array.get<std::string>(0));
+  ASSERT_EQ(grouped_multi_field_array.data<double>(), &grouped_multi_field_array.get<double>(0));
+  ASSERT_EQ(grouped_multi_field_array.data<int>(), &grouped_multi_field_array.get<int>(0));
+}
+
+TEST(GroupedMultiFieldArray, ViewIteration)
+{
+  entity_array grouped_multi_field_array;
+  for (int i = 0; i < 10; ++i)
+  {
+    grouped_multi_field_array.emplace_back(Position{0.f, 0.f}, Velocity{1.f, 2.f}, std::to_string(i), i);
+  }
+
+  for (auto [p, v] : grouped_multi_field_array.view<Position, Velocity>())
+  {
+    p.x += v.dx;
+    p.y += v.dy;
+  }
+
+  const auto view = std::as_const(grouped_multi_field_array).view<0, 3>();
+  ASSERT_EQ(std::distance(view.begin(), view.end()), 10);
+  for (const auto& [p, n] : view)
+  {
+    ASSERT_EQ(p.x, 1.f);
+    ASSERT_EQ(p.y, 2.f);
+    ASSERT_GE(n, 0);
+  }
+
+  int expected = 0;
+  for (const auto& [s] : grouped_multi_field_array.view<std::string>())
+  {
+    ASSERT_EQ(s, std::to_string(expected++));
+  }
+  ASSERT_EQ(expected, 10);
+  ASSERT_THROW(view.at(10), std::out_of_range);
+}
+
+TEST(GroupedMultiFieldArray, IteratorArithmetic)
+{
+  entity_array grouped_multi_field_array{8};
+  auto view = grouped_multi_field_array.view<Velocity, int>();
+
+  auto itr = view.begin();
+  itr += 5;
+  ASSERT_EQ(itr - view.begin(), 5);
+  ASSERT_EQ(&std::get<0>(*itr), &grouped_multi_field_array.get<Velocity>(5));
+  ASSERT_EQ(&std::get<1>(*(itr - 2)), &grouped_multi_field_array.get<int>(3));
+  ASSERT_EQ(&std::get<1>(view[7]), &grouped_multi_field_array.get<int>(7));
+}
+
+TEST(GroupedMultiFieldArray, PopBackAndResize)
+{
+  entity_array grouped_multi_field_array;
+  grouped_multi_field_array.resize(5, std::make_tuple(Position{1.f, 1.f}, Velocity{2.f, 2.f}, "ok", 3));
+  ASSERT_EQ(grouped_multi_field_array.size(), 5UL);
+  ASSERT_EQ(grouped_multi_field_array.get<std::string>(4), "ok");
+
+  grouped_multi_field_array.pop_back();
+  ASSERT_EQ(grouped_multi_field_array.size(), 4UL);
+
+  grouped_multi_field_array.resize(6);
+  ASSERT_EQ(grouped_multi_field_array.get<Velocity>(3).dx, 2.f);
+  ASSERT_EQ(grouped_multi_field_array.get<Velocity>(5).dx, 0.f);
+
+  grouped_multi_field_array.clear();
+  grouped_multi_field_array.shrink_to_fit();
+  ASSERT_EQ(grouped_multi_field_array.capacity(), 0UL);
+}
+
+TEST(GroupedMultiFieldArray, CopyAndSwap)
+{
+  entity_array grouped_multi_field_array;
+  grouped_multi_field_array.emplace_back(Position{1.f, 1.f}, Velocity{2.f, 2.f}, "a", 1);
+
+  auto copied = grouped_multi_field_array;
+  copied.emplace_back(Position{3.f, 3.f}, Velocity{4.f, 4.f}, "b", 2);
+
+  grouped_multi_field_array.swap(copied);
+  ASSERT_EQ(grouped_multi_field_array.size(), 2UL);
+  ASSERT_EQ(copied.size(), 1UL);
+  ASSERT_EQ(std::get<2>(grouped_multi_field_array.at(1)), "b");
+  ASSERT_THROW(copied.at(1), std::out_of_range);
+}
@@ -0,0 +1,66 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/huge_page_allocator_adapter.hpp>
+
+TEST(HugePageAllocatorAdapter, AllocationIsHugePageAligned)
+{
+  mf::huge_page_allocator_adapter<char, double, std::string> allocator;
+
+  for (std::size_t n = 1; n < 100000; n *= 10)
+  {
+    auto [char_ptr, double_ptr, string_ptr] = allocator.allocate(n);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(char_ptr) % mf::huge_page_size, 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(double_ptr) % alignof(double), 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(string_ptr) % alignof(std::string), 0UL);
+
+    char_ptr[n - 1] = 'a';
+    double_ptr[n - 1] = 1.0;
+
+    allocator.deallocate(std::make_tuple(char_ptr, double_ptr, string_ptr), n);
+  }
+}
+
+TEST(HugePageAllocatorAdapter, PrefaultedAllocationIsZeroed)
+{
+  mf::prefaulted_huge_page_allocator_adapter<int, float> allocator;
+
+  static constexpr std::size_t n = 1UL << 20UL;
+  auto [int_ptr, float_ptr] = allocator.allocate(n);
+
+  for (std::size_t i = 0; i < n; i += 1024UL)
+  {
+    ASSERT_EQ(int_ptr[i], 0);
+    ASSERT_EQ(float_ptr[i], 0.f);
+  }
+
+  allocator.deallocate(std::make_tuple(int_ptr, float_ptr), n);
+}
+
+TEST(HugePageAllocatorAdapter, MultiFieldArrayGrowth)
+{
+  mf::huge_page_multi_field_array<int, std::string> multi_field_array;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  ASSERT_EQ(multi_field_array.size(), 1000UL);
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<int>(i), i);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
@@ -0,0 +1,187 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/inline_allocator_adapter.hpp>
+
+/**
+ * @brief Returns true if \c ptr points into the object \c container
+ */
+template <typename ContainerT> bool is_within(const ContainerT& container, const void* const ptr)
+{
+  const auto* const first = reinterpret_cast<const std::uint8_t*>(std::addressof(container));
+  const auto* const byte_ptr = reinterpret_cast<const std::uint8_t*>(ptr);
+  return byte_ptr >= first and byte_ptr < first + sizeof(ContainerT);
+}
+
+/**
+ * @brief Counts allocations made through the default memory resource
+ */
+struct CountingMemoryResource : std::pmr::memory_resource
+{
+  std::size_t allocation_count = 0;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocation_count;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+TEST(InlineAllocatorAdapter, AllocateInlineOnce)
+{
+  using adapter_type = mf::inline_allocator_adapter<4, char, double, std::string>;
+  adapter_type allocator;
+
+  auto inline_ptrs = allocator.allocate(3);
+  ASSERT_TRUE(allocator.is_inline(inline_ptrs));
+  ASSERT_TRUE(is_within(allocator, std::get<2>(inline_ptrs) + 3));
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(std::get<1>(inline_ptrs)) % alignof(double), 0UL);
+
+  // Inline block is in use, so further requests go upstream
+  auto upstream_ptrs = allocator.allocate(2);
+  ASSERT_FALSE(allocator.is_inline(upstream_ptrs));
+  allocator.deallocate(upstream_ptrs, 2);
+
+  allocator.deallocate(inline_ptrs, 3);
+  ASSERT_TRUE(allocator.is_inline(allocator.allocate(4)));
+}
+
+TEST(InlineAllocatorAdapter, ResizeInPlaceUpToInlineCapacity)
+{
+  mf::inline_allocator_adapter<4, int, float> allocator;
+
+  auto inline_ptrs = allocator.allocate(1);
+  ASSERT_TRUE(allocator.resize_in_place(inline_ptrs, 1, 4));
+  ASSERT_FALSE(allocator.resize_in_place(inline_ptrs, 4, 5));
+  allocator.deallocate(inline_ptrs, 4);
+}
+
+TEST(InlineAllocatorAdapter, LargeRequestGoesUpstream)
+{
+  mf::inline_allocator_adapter<4, int, float> allocator;
+
+  auto upstream_ptrs = allocator.allocate(5);
+  ASSERT_FALSE(allocator.is_inline(upstream_ptrs));
+  allocator.deallocate(upstream_ptrs, 5);
+}
+
+TEST(SmallMultiFieldArray, NoAllocationUpToInlineCapacity)
+{
+  CountingMemoryResource resource;
+  auto* const previous_resource = std::pmr::set_default_resource(&resource);
+  {
+    using upstream_strategy_type = mf::SinglePassAllocationStrategy<std::pmr::polymorphic_allocator<std::uint8_t>>;
+    using strategy_type = mf::InlineAllocationStrategy<8, upstream_strategy_type>;
+    using adapter_type = mf::BasicMultiAllocatorAdapter<std::tuple<int, std::string>, strategy_type>;
+    mf::BasicMultiFieldArray<std::tuple<int, std::string>, adapter_type, mf::InlineCapacityIncreasePolicy<8>>
+      small_multi_field_array;
+
+    for (int i = 0; i < 8; ++i)
+    {
+      small_multi_field_array.emplace_back(i, "inline");
+    }
+    ASSERT_EQ(small_multi_field_array.capacity(), 8UL);
+    ASSERT_EQ(resource.allocation_count, 0UL);
+
+    small_multi_field_array.emplace_back(8, "spilled");
+    ASSERT_EQ(resource.allocation_count, 1UL);
+    ASSERT_FALSE(is_within(small_multi_field_array, small_multi_field_array.data<int>()));
+
+    for (int i = 0; i < 9; ++i)
+    {
+      ASSERT_EQ(small_multi_field_array.get<int>(i), i);
+    }
+  }
+  std::pmr::set_default_resource(previous_resource);
+}
+
+TEST(SmallMultiFieldArray, ShrinkBackInline)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array{10, std::forward_as_tuple(1, "a")};
+  ASSERT_FALSE(is_within(small_multi_field_array, small_multi_field_array.data<int>()));
+
+  small_multi_field_array.resize(2);
+  small_multi_field_array.shrink_to_fit();
+  ASSERT_TRUE(is_within(small_multi_field_array, small_multi_field_array.data<int>()));
+  ASSERT_EQ(small_multi_field_array.get<std::string>(1), "a");
+}
+
+TEST(SmallMultiFieldArray, MoveCTorInline)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array;
+  small_multi_field_array.emplace_back(1, "one");
+  small_multi_field_array.emplace_back(2, "two");
+
+  const auto moved_multi_field_array = std::move(small_multi_field_array);
+  ASSERT_TRUE(is_within(moved_multi_field_array, moved_multi_field_array.data<int>()));
+  ASSERT_EQ(moved_multi_field_array.size(), 2UL);
+  ASSERT_EQ(moved_multi_field_array.get<std::string>(1), "two");
+  ASSERT_TRUE(small_multi_field_array.empty());
+}
+
+TEST(SmallMultiFieldArray, MoveCTorSpilled)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array{10, std::forward_as_tuple(1, "a")};
+  const auto* const data = small_multi_field_array.data<std::string>();
+
+  const auto moved_multi_field_array = std::move(small_multi_field_array);
+  ASSERT_EQ(moved_multi_field_array.data<std::string>(), data);
+  ASSERT_EQ(moved_multi_field_array.size(), 10UL);
+  ASSERT_EQ(small_multi_field_array.capacity(), 0UL);
+}
+
+TEST(SmallMultiFieldArray, MoveAssignInline)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array;
+  small_multi_field_array.emplace_back(1, "one");
+
+  mf::small_multi_field_array<4, int, std::string> assigned_multi_field_array{10};
+  assigned_multi_field_array = std::move(small_multi_field_array);
+  ASSERT_EQ(assigned_multi_field_array.size(), 1UL);
+  ASSERT_EQ(assigned_multi_field_array.get<std::string>(0), "one");
+  ASSERT_TRUE(small_multi_field_array.empty());
+}
+
+TEST(SmallMultiFieldArray, Swap)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array;
+  small_multi_field_array.emplace_back(1, "inline");
+
+  mf::small_multi_field_array<4, int, std::string> other_multi_field_array{10, std::forward_as_tuple(2, "spilled")};
+  small_multi_field_array.swap(other_multi_field_array);
+
+  ASSERT_EQ(small_multi_field_array.size(), 10UL);
+  ASSERT_EQ(small_multi_field_array.get<std::string>(9), "spilled");
+  ASSERT_EQ(other_multi_field_array.size(), 1UL);
+  ASSERT_EQ(other_multi_field_array.get<std::string>(0), "inline");
+  ASSERT_TRUE(is_within(other_multi_field_array, other_multi_field_array.data<int>()));
+}
+
+TEST(SmallMultiFieldArray, CopyCTor)
+{
+  mf::small_multi_field_array<4, int, std::string> small_multi_field_array;
+  small_multi_field_array.emplace_back(1, "one");
+
+  const auto copied_multi_field_array = small_multi_field_array;
+  ASSERT_TRUE(is_within(copied_multi_field_array, copied_multi_field_array.data<int>()));
+  ASSERT_EQ(copied_multi_field_array.get<std::string>(0), "one");
+}
@@ -0,0 +1,342 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/malloc_allocator.hpp>
+#include <mf/multi_field_array.hpp>
+
+struct Vec2
+{
+  float x, y;
+};
+
+TEST(MallocAllocator, Reallocate)
+{
+  mf::MallocAllocator<int> allocator;
+
+  int* ptr = allocator.allocate(4);
+  for (int i = 0; i < 4; ++i)
+  {
+    ptr[i] = i;
+  }
+
+  ptr = allocator.reallocate(ptr, 4, 1000);
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_EQ(ptr[i], i);
+  }
+
+  allocator.deallocate(ptr, 1000);
+}
+
+TEST(MallocAllocator, PerFieldReallocate)
+{
+  static_assert(mf::multi_malloc_allocator_adapter<int, double>::supports_reallocate);
+  static_assert(!mf::multi_allocator_adapter<int, double>::supports_reallocate);
+
+  mf::multi_malloc_allocator_adapter<int, double> allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(3);
+  for (int i = 0; i < 3; ++i)
+  {
+    std::get<int*>(tuple_of_ptrs)[i] = i;
+    std::get<double*>(tuple_of_ptrs)[i] = static_cast<double>(i);
+  }
+
+  tuple_of_ptrs = allocator.reallocate(tuple_of_ptrs, 3, 3, 100);
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[i], i);
+    ASSERT_EQ(std::get<double*>(tuple_of_ptrs)[i], static_cast<double>(i));
+  }
+
+  allocator.deallocate(tuple_of_ptrs, 100);
+}
+
+/**
+ * @brief MallocAllocator which fails every allocation while \c fail is set
+ */
+template <typename T> struct FailingMallocAllocator : mf::MallocAllocator<T>
+{
+  template <typename U> struct rebind
+  {
+    using other = FailingMallocAllocator<U>;
+  };
+
+  static inline bool fail = false;
+
+  T* allocate(const std::size_t n)
+  {
+    if (fail)
+    {
+      throw std::bad_alloc{};
+    }
+    return mf::MallocAllocator<T>::allocate(n);
+  }
+
+  T* reallocate(T* const ptr, const std::size_t old_n, const std::size_t new_n)
+  {
+    if (fail)
+    {
+      throw std::bad_alloc{};
+    }
+    return mf::MallocAllocator<T>::reallocate(ptr, old_n, new_n);
+  }
+};
+
+TEST(MallocAllocator, PerFieldReallocateFailureLeavesFieldsUnchanged)
+{
+  using AllocatorAdapter = mf::BasicMultiAllocatorAdapter<
+    std::tuple<int, double>,
+    std::tuple<mf::MallocAllocator<int>, FailingMallocAllocator<double>>>;
+  static_assert(AllocatorAdapter::supports_reallocate);
+
+  AllocatorAdapter allocator;
+
+  const auto tuple_of_ptrs = allocator.allocate(3);
+  for (int i = 0; i < 3; ++i)
+  {
+    std::get<int*>(tuple_of_ptrs)[i] = i;
+    std::get<double*>(tuple_of_ptrs)[i] = static_cast<double>(i);
+  }
+
+  // Second field fails to grow; first field must still be valid at its old address
+  FailingMallocAllocator<double>::fail = true;
+  ASSERT_THROW(allocator.reallocate(tuple_of_ptrs, 3, 3, 1UL << 20UL), std::bad_alloc);
+  ASSERT_THROW(allocator.allocate(10), std::bad_alloc);
+  FailingMallocAllocator<double>::fail = false;
+
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[i], i);
+    ASSERT_EQ(std::get<double*>(tuple_of_ptrs)[i], static_cast<double>(i));
+  }
+
+  allocator.deallocate(tuple_of_ptrs, 3);
+}
+
+TEST(MallocAllocator, SinglePassReallocateShiftsSegments)
+{
+  static_assert(mf::single_malloc_allocator_adapter<char, double, int>::supports_reallocate);
+  static_assert(!mf::single_allocator_adapter<char, double, int>::supports_reallocate);
+
+  mf::single_malloc_allocator_adapter<char, double, int> allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(5);
+  for (int i = 0; i < 5; ++i)
+  {
+    std::get<char*>(tuple_of_ptrs)[i] = static_cast<char>('a' + i);
+    std::get<double*>(tuple_of_ptrs)[i] = static_cast<double>(i);
+    std::get<int*>(tuple_of_ptrs)[i] = -i;
+  }
+
+  // Grow, preserving the first 4 elements of each field
+  tuple_of_ptrs = allocator.reallocate(tuple_of_ptrs, 4, 5, 50);
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_EQ(std::get<char*>(tuple_of_ptrs)[i], static_cast<char>('a' + i));
+    ASSERT_EQ(std::get<double*>(tuple_of_ptrs)[i], static_cast<double>(i));
+    ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[i], -i);
+  }
+
+  // Shrink, preserving the first 2 elements of each field
+  tuple_of_ptrs = allocator.reallocate(tuple_of_ptrs, 2, 50, 2);
+  for (int i = 0; i < 2; ++i)
+  {
+    ASSERT_EQ(std::get<char*>(tuple_of_ptrs)[i], static_cast<char>('a' + i));
+    ASSERT_EQ(std::get<double*>(tuple_of_ptrs)[i], static_cast<double>(i));
+    ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[i], -i);
+  }
+
+  allocator.deallocate(tuple_of_ptrs, 2);
+}
+
+TEST(MallocAllocator, SinglePassReallocateFailureLeavesSegmentsUnchanged)
+{
+  using AllocatorAdapter = mf::BasicMultiAllocatorAdapter<
+    std::tuple<char, double, int>,
+    mf::SinglePassAllocationStrategy<FailingMallocAllocator<std::uint8_t>>>;
+  static_assert(AllocatorAdapter::supports_reallocate);
+
+  AllocatorAdapter allocator;
+
+  const auto tuple_of_ptrs = allocator.allocate(50);
+  for (int i = 0; i < 48; ++i)
+  {
+    std::get<char*>(tuple_of_ptrs)[i] = static_cast<char>('a' + i);
+    std::get<double*>(tuple_of_ptrs)[i] = static_cast<double>(i);
+    std::get<int*>(tuple_of_ptrs)[i] = -i;
+  }
+
+  // Segments are packed before the block is shrunk; they must be restored when shrinking fails
+  FailingMallocAllocator<std::uint8_t>::fail = true;
+  ASSERT_THROW(allocator.reallocate(tuple_of_ptrs, 48, 50, 48), std::bad_alloc);
+  FailingMallocAllocator<std::uint8_t>::fail = false;
+
+  for (int i = 0; i < 48; ++i)
+  {
+    ASSERT_EQ(std::get<char*>(tuple_of_ptrs)[i], static_cast<char>('a' + i));
+    ASSERT_EQ(std::get<double*>(tuple_of_ptrs)[i], static_cast<double>(i));
+    ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[i], -i);
+  }
+
+  allocator.deallocate(tuple_of_ptrs, 50);
+}
+
+TEST(MallocAllocator, MultiFieldArrayGrowthWithRelocatableFields)
+{
+  mf::BasicMultiFieldArray<
+    std::tuple<char, Vec2, std::unique_ptr<int>>,
+    mf::single_malloc_allocator_adapter<char, Vec2, std::unique_ptr<int>>,
+    mf::DefaultCapacityIncreasePolicy>
+    array;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    array.emplace_back(static_cast<char>(i % 100), Vec2{static_cast<float>(i), 0.f}, std::make_unique<int>(i));
+  }
+
+  array.reserve(5000);
+  array.resize(2000);
+
+  ASSERT_EQ(array.size(), 2000UL);
+  ASSERT_EQ(array.capacity(), 5000UL);
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(array.get<char>(i), static_cast<char>(i % 100));
+    ASSERT_EQ(array.get<Vec2>(i).x, static_cast<float>(i));
+    ASSERT_EQ(*array.get<std::unique_ptr<int>>(i), i);
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayGrowthWithNonRelocatableFields)
+{
+  mf::BasicMultiFieldArray<
+    std::tuple<int, std::string>,
+    mf::single_malloc_allocator_adapter<int, std::string>,
+    mf::DefaultCapacityIncreasePolicy>
+    array;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    array.emplace_back(i, std::to_string(i));
+  }
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(array.get<int>(i), i);
+    ASSERT_EQ(array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayShrinkToFitWithRelocatableFields)
+{
+  mf::BasicMultiFieldArray<
+    std::tuple<char, Vec2, double>,
+    mf::single_malloc_allocator_adapter<char, Vec2, double>,
+    mf::DefaultCapacityIncreasePolicy>
+    array;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    array.emplace_back(static_cast<char>(i % 100), Vec2{static_cast<float>(i), 0.f}, static_cast<double>(i));
+  }
+  array.resize(300);
+
+  array.shrink_to_fit();
+  ASSERT_EQ(array.capacity(), 300UL);
+
+  for (int i = 0; i < 300; ++i)
+  {
+    ASSERT_EQ(array.get<char>(i), static_cast<char>(i % 100));
+    ASSERT_EQ(array.get<Vec2>(i).x, static_cast<float>(i));
+    ASSERT_EQ(array.get<double>(i), static_cast<double>(i));
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayZeroedResize)
+{
+  mf::malloc_multi_field_array<int, float, Vec2, std::string> array;
+
+  array.resize(1UL << 16UL, std::make_tuple(0, 0.f, Vec2{0.f, 0.f}, "zero"));
+
+  for (const auto& [i, f, v, s] : array)
+  {
+    ASSERT_EQ(i, 0);
+    ASSERT_EQ(f, 0.f);
+    ASSERT_EQ(v.x, 0.f);
+    ASSERT_EQ(v.y, 0.f);
+    ASSERT_EQ(s, "zero");
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayZeroedCTorWritesNonZeroValues)
+{
+  // Negative zero is not all zero bytes, and must be written
+  mf::malloc_multi_field_array<int, float, Vec2> array{100, std::make_tuple(1, -0.f, Vec2{0.f, 2.f})};
+
+  for (const auto& [i, f, v] : array)
+  {
+    ASSERT_EQ(i, 1);
+    ASSERT_TRUE(std::signbit(f));
+    ASSERT_EQ(v.y, 2.f);
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayZeroedCTorAggregateFromMemberValue)
+{
+  struct Wrapper
+  {
+    int x;
+  };
+
+  mf::malloc_multi_field_array<Wrapper, int> array{100, std::make_tuple(0, 1)};
+
+  array.resize(200, std::make_tuple(5, 0));
+
+  for (std::size_t i = 0; i < array.size(); ++i)
+  {
+    ASSERT_EQ(array.get<Wrapper>(i).x, (i < 100UL) ? 0 : 5);
+    ASSERT_EQ(array.get<int>(i), (i < 100UL) ? 1 : 0);
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayZeroedDefaultCTorMemberPointer)
+{
+  // Null member pointers are not all zero bytes on some ABIs, so they must be written
+  mf::malloc_multi_field_array<int, float Vec2::*> array{100};
+
+  for (const auto& [i, member] : array)
+  {
+    ASSERT_EQ(i, 0);
+    ASSERT_EQ(member, nullptr);
+  }
+}
+
+TEST(MallocAllocator, MultiFieldArrayZeroedDefaultCTor)
+{
+  mf::malloc_multi_field_array<int, Vec2> array{100};
+
+  array.resize(0);
+  array.resize(1000);
+
+  for (const auto& [i, v] : array)
+  {
+    ASSERT_EQ(v.x, 0.f);
+    ASSERT_EQ(v.y, 0.f);
+  }
+}
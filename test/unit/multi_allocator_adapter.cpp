@@ -4,7 +4,9 @@
  */
 
 // C++ Standard Library
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <string>
 
 // GTest
@@ -31,3 +33,73 @@ TEST(MultiAllocatorAdapter, SinglePassAllocation)
 
   allocator.deallocate(tuple_of_ptrs, 10);
 }
+
+
+TEST(MultiAllocatorAdapter, SinglePassAllocationFieldAlignment)
+{
+  mf::single_allocator_adapter<char, double, char, std::string> allocator;
+
+  for (std::size_t n = 1; n < 10; ++n)
+  {
+    auto [char_ptr, double_ptr, other_char_ptr, string_ptr] = allocator.allocate(n);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(double_ptr) % alignof(double), 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(string_ptr) % alignof(std::string), 0UL);
+    ASSERT_LE(reinterpret_cast<const void*>(char_ptr + n), reinterpret_cast<const void*>(double_ptr));
+    ASSERT_LE(reinterpret_cast<const void*>(double_ptr + n), reinterpret_cast<const void*>(other_char_ptr));
+    ASSERT_LE(reinterpret_cast<const void*>(other_char_ptr + n), reinterpret_cast<const void*>(string_ptr));
+
+    allocator.deallocate(std::make_tuple(char_ptr, double_ptr, other_char_ptr, string_ptr), n);
+  }
+}
+
+
+TEST(MultiAllocatorAdapter, SinglePassAllocationCacheLineAlignment)
+{
+  mf::aligned_single_allocator_adapter<mf::cache_line_size, char, float, double> allocator;
+
+  for (std::size_t n = 1; n < 10; ++n)
+  {
+    auto tuple_of_ptrs = allocator.allocate(n);
+
+    mf::tuple_for_each(
+      [](const auto* ptr) { ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % mf::cache_line_size, 0UL); },
+      tuple_of_ptrs);
+
+    allocator.deallocate(tuple_of_ptrs, n);
+  }
+}
+
+
+TEST(MultiAllocatorAdapter, PmrPerFieldAllocationFromResource)
+{
+  std::pmr::unsynchronized_pool_resource resource;
+  mf::pmr::multi_allocator_adapter<float, int, std::string> allocator{&resource};
+
+  auto tuple_of_ptrs = allocator.allocate(10);
+
+  allocator.deallocate(tuple_of_ptrs, 10);
+
+  ASSERT_EQ(allocator, (mf::pmr::multi_allocator_adapter<float, int, std::string>{&resource}));
+  ASSERT_NE(allocator, (mf::pmr::multi_allocator_adapter<float, int, std::string>{}));
+}
+
+
+TEST(MultiAllocatorAdapter, PmrSinglePassAllocationFieldAlignment)
+{
+  // Offset buffer start, so alignment must be requested from the resource rather than assumed
+  alignas(std::max_align_t) std::uint8_t buffer[1024];
+  std::pmr::monotonic_buffer_resource resource{buffer + 1, sizeof(buffer) - 1, std::pmr::null_memory_resource()};
+  mf::pmr::single_allocator_adapter<char, double, std::string> allocator{&resource};
+
+  for (std::size_t n = 1; n < 4; ++n)
+  {
+    auto [char_ptr, double_ptr, string_ptr] = allocator.allocate(n);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(char_ptr) % alignof(std::string), 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(double_ptr) % alignof(double), 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(string_ptr) % alignof(std::string), 0UL);
+
+    allocator.deallocate(std::make_tuple(char_ptr, double_ptr, string_ptr), n);
+  }
+}
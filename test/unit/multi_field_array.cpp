@@ -6,6 +6,7 @@
 // C++ Standard Library
 #include <algorithm>
 #include <iterator>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -140,6 +141,26 @@ TEST(MultiFieldArray, ResizeSameWithInitialValues)
   }
 }
 
+struct IntWrapper
+{
+  int x;
+};
+
+TEST(MultiFieldArray, ResizeAggregateFromMemberValue)
+{
+  mf::multi_field_array<IntWrapper, int> multi_field_array{4UL, std::make_tuple(7, 1)};
+
+  multi_field_array.resize(8UL, std::make_tuple(3, 2));
+
+  ASSERT_EQ(multi_field_array.size(), 8UL);
+
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<IntWrapper>(i).x, (i < 4UL) ? 7 : 3);
+    ASSERT_EQ(multi_field_array.get<int>(i), (i < 4UL) ? 1 : 2);
+  }
+}
+
 TEST(MultiFieldArray, ReserveMoreAfterDefaultCTor)
 {
   mf::multi_field_array<float, int, std::string> multi_field_array;
@@ -404,6 +425,70 @@ TEST(MultiFieldArray, AllFieldViewIterationValueAssignment)
     multi_field_array.begin<2>(), multi_field_array.end<2>(), [](const std::string& v) { ASSERT_EQ(v, "ok"); });
 }
 
+TEST(MultiFieldArray, IndexedViewIterationValueAssignment)
+{
+  mf::multi_field_array<float, int, std::string> multi_field_array(10);
+
+  ASSERT_EQ(multi_field_array.view().indexed().size(), multi_field_array.size());
+
+  for (auto [float_field, str_field] : multi_field_array.view<float, std::string>().indexed())
+  {
+    float_field = 3.f;
+    str_field = "ok";
+  }
+
+  std::for_each(
+    multi_field_array.begin<float>(), multi_field_array.end<float>(), [](const auto v) { ASSERT_EQ(v, 3.f); });
+
+  std::for_each(multi_field_array.begin<std::string>(), multi_field_array.end<std::string>(), [](const auto& v) {
+    ASSERT_EQ(v, "ok");
+  });
+
+  const auto& const_multi_field_array = multi_field_array;
+  for (const auto& [float_field, str_field] : const_multi_field_array.view<0, 2>().indexed())
+  {
+    ASSERT_EQ(float_field, 3.f);
+    ASSERT_EQ(str_field, "ok");
+  }
+}
+
+TEST(MultiFieldArray, ForEachBatch)
+{
+  mf::multi_field_array<float, int, std::string> multi_field_array(19);
+
+  std::size_t full_batches = 0;
+  std::size_t tail_size = 0;
+  multi_field_array.view<float, int>().for_each_batch<8>([&](auto n, float* f, int* i) {
+    if constexpr (std::is_same_v<decltype(n), std::integral_constant<std::size_t, 8>>)
+    {
+      ++full_batches;
+    }
+    else
+    {
+      tail_size = n;
+    }
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      f[k] = 2.f;
+      i[k] = 3;
+    }
+  });
+
+  ASSERT_EQ(full_batches, 2UL);
+  ASSERT_EQ(tail_size, 3UL);
+
+  int sum = 0;
+  const auto& const_multi_field_array = multi_field_array;
+  const_multi_field_array.view<float, int>().for_each_batch<4>([&sum](auto n, const float* f, const int* i) {
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      ASSERT_EQ(f[k], 2.f);
+      sum += i[k];
+    }
+  });
+  ASSERT_EQ(sum, 19 * 3);
+}
+
 TEST(MultiFieldArray, ConstMultiFieldViewIterationValueAssignmentByType)
 {
   const mf::multi_field_array<std::vector<int>, std::string> multi_field_array(10);
@@ -1447,3 +1532,411 @@ TEST(MultiFieldArray, MoveOnlyTypeExplaceBackPiecewise)
     std::piecewise_construct, std::forward_as_tuple(0), std::forward_as_tuple(std::make_unique<std::mutex>()));
   ASSERT_EQ(move_only_sequence.size(), 5UL);
 }
+
+TEST(MultiFieldArray, CacheLineAlignedFieldsGrowth)
+{
+  using multi_field_array_type = mf::BasicMultiFieldArray<
+    std::tuple<char, double, std::string>,
+    mf::aligned_single_allocator_adapter<mf::cache_line_size, char, double, std::string>,
+    mf::DefaultCapacityIncreasePolicy>;
+
+  multi_field_array_type array;
+
+  for (std::size_t i = 0; i < 100; ++i)
+  {
+    array.emplace_back(static_cast<char>(i), static_cast<double>(i), std::to_string(i));
+
+    mf::tuple_for_each(
+      [](const auto* ptr) { ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % mf::cache_line_size, 0UL); },
+      array.data());
+  }
+
+  for (std::size_t i = 0; i < array.size(); ++i)
+  {
+    ASSERT_EQ(array.get<char>(i), static_cast<char>(i));
+    ASSERT_EQ(array.get<double>(i), static_cast<double>(i));
+    ASSERT_EQ(array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+struct TriviallyCopyableVec3
+{
+  float x, y, z;
+};
+
+TEST(MultiFieldArray, EraseRangeMiddleDistinctValues)
+{
+  mf::multi_field_array<int, std::string> multi_field_array;
+  for (int i = 0; i < 10; ++i)
+  {
+    multi_field_array.emplace_back(i, std::string(32, static_cast<char>('a' + i)));
+  }
+
+  multi_field_array.erase(2UL, 4UL);
+
+  ASSERT_EQ(multi_field_array.size(), 8UL);
+
+  const std::vector<int> expected{0, 1, 4, 5, 6, 7, 8, 9};
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<int>(i), expected[i]);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), std::string(32, static_cast<char>('a' + expected[i])));
+  }
+}
+
+TEST(MultiFieldArray, TriviallyRelocatableGrowInsertErase)
+{
+  static_assert(mf::is_trivially_relocatable_v<TriviallyCopyableVec3>);
+  static_assert(mf::is_trivially_relocatable_v<std::unique_ptr<int>>);
+  static_assert(!mf::is_trivially_relocatable_v<std::string>);
+
+  mf::multi_field_array<TriviallyCopyableVec3, std::unique_ptr<int>, std::string> multi_field_array;
+
+  for (int i = 0; i < 100; ++i)
+  {
+    const float v = static_cast<float>(i);
+    multi_field_array.emplace_back(TriviallyCopyableVec3{v, v, v}, std::make_unique<int>(i), std::to_string(i));
+  }
+
+  // Insert copies of a POD and empty pointers at the front
+  multi_field_array.insert(0UL, 2UL, std::make_tuple(TriviallyCopyableVec3{-1.f, -1.f, -1.f}, nullptr, "x"));
+
+  // Erase a single element and a range
+  multi_field_array.erase(10UL);
+  multi_field_array.erase(20UL, 30UL);
+
+  ASSERT_EQ(multi_field_array.size(), 91UL);
+
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<TriviallyCopyableVec3>(i).x, -1.f);
+    ASSERT_EQ(multi_field_array.get<std::unique_ptr<int>>(i), nullptr);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), "x");
+  }
+
+  for (std::size_t i = 2; i < multi_field_array.size(); ++i)
+  {
+    const int expected = static_cast<int>(i) - 2 + (i >= 10 ? 1 : 0) + (i >= 20 ? 10 : 0);
+    ASSERT_EQ(multi_field_array.get<TriviallyCopyableVec3>(i).y, static_cast<float>(expected));
+    ASSERT_EQ(*multi_field_array.get<std::unique_ptr<int>>(i), expected);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), std::to_string(expected));
+  }
+}
+
+TEST(MultiFieldArray, TriviallyCopyableCopyCTor)
+{
+  mf::multi_field_array<TriviallyCopyableVec3, int> original_multi_field_array;
+  original_multi_field_array.resize(10, std::make_tuple(TriviallyCopyableVec3{1.f, 2.f, 3.f}, 4));
+
+  const mf::multi_field_array<TriviallyCopyableVec3, int> copied_multi_field_array{original_multi_field_array};
+
+  for (std::size_t i = 0; i < copied_multi_field_array.size(); ++i)
+  {
+    ASSERT_EQ(copied_multi_field_array.get<TriviallyCopyableVec3>(i).z, 3.f);
+    ASSERT_EQ(copied_multi_field_array.get<int>(i), 4);
+  }
+}
+
+
+TEST(MultiFieldArray, ShrinkToFit)
+{
+  mf::multi_field_array<int, std::string> multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    multi_field_array.emplace_back(i, std::to_string(i));
+  }
+  multi_field_array.resize(10);
+
+  multi_field_array.shrink_to_fit();
+
+  ASSERT_EQ(multi_field_array.capacity(), 10UL);
+  ASSERT_EQ(multi_field_array.size(), 10UL);
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<int>(i), i);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+
+TEST(MultiFieldArray, ShrinkTo)
+{
+  mf::multi_field_array<char, double, int> multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    multi_field_array.emplace_back(static_cast<char>(i), static_cast<double>(i), i);
+  }
+  multi_field_array.resize(10);
+
+  multi_field_array.shrink_to(50);
+  ASSERT_EQ(multi_field_array.capacity(), 50UL);
+
+  // Capacity is never reduced below size
+  multi_field_array.shrink_to(5);
+  ASSERT_EQ(multi_field_array.capacity(), 10UL);
+
+  // Capacity is never increased
+  multi_field_array.shrink_to(100);
+  ASSERT_EQ(multi_field_array.capacity(), 10UL);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<char>(i), static_cast<char>(i));
+    ASSERT_EQ(multi_field_array.get<double>(i), static_cast<double>(i));
+    ASSERT_EQ(multi_field_array.get<int>(i), i);
+  }
+}
+
+
+TEST(MultiFieldArray, ShrinkToFitEmpty)
+{
+  mf::multi_field_array<int, std::string> multi_field_array{10};
+  multi_field_array.clear();
+
+  multi_field_array.shrink_to_fit();
+
+  ASSERT_EQ(multi_field_array.capacity(), 0UL);
+  ASSERT_EQ(multi_field_array.data<int>(), nullptr);
+}
+
+
+struct DefaultMemberInitialized
+{
+  int value = 42;
+};
+
+
+TEST(MultiFieldArray, DefaultInitCTor)
+{
+  mf::multi_field_array<TriviallyCopyableVec3, std::string, DefaultMemberInitialized> multi_field_array{
+    mf::default_init, 10};
+
+  ASSERT_EQ(multi_field_array.size(), 10UL);
+  ASSERT_EQ(multi_field_array.capacity(), 10UL);
+  for (const auto& [vec, s, initialized] : multi_field_array)
+  {
+    ASSERT_TRUE(s.empty());
+    ASSERT_EQ(initialized.value, 42);
+  }
+}
+
+
+TEST(MultiFieldArray, ResizeDefaultInit)
+{
+  mf::multi_field_array<TriviallyCopyableVec3, std::string, DefaultMemberInitialized> multi_field_array;
+  multi_field_array.emplace_back(TriviallyCopyableVec3{1.f, 2.f, 3.f}, "first", DefaultMemberInitialized{7});
+
+  multi_field_array.resize_default_init(100);
+
+  ASSERT_EQ(multi_field_array.size(), 100UL);
+  ASSERT_EQ(multi_field_array.get<TriviallyCopyableVec3>(0).z, 3.f);
+  ASSERT_EQ(multi_field_array.get<std::string>(0), "first");
+  ASSERT_EQ(multi_field_array.get<DefaultMemberInitialized>(0).value, 7);
+  for (std::size_t i = 1; i < multi_field_array.size(); ++i)
+  {
+    ASSERT_TRUE(multi_field_array.get<std::string>(i).empty());
+    ASSERT_EQ(multi_field_array.get<DefaultMemberInitialized>(i).value, 42);
+  }
+
+  multi_field_array.resize_default_init(1);
+  ASSERT_EQ(multi_field_array.size(), 1UL);
+  ASSERT_EQ(multi_field_array.get<std::string>(0), "first");
+}
+
+
+TEST(MultiFieldArray, MoveAssignReplacesContents)
+{
+  mf::multi_field_array<int, std::string> multi_field_array{5, std::make_tuple(1, std::string{"replaced value"})};
+  mf::multi_field_array<int, std::string> other_multi_field_array{3, std::make_tuple(2, std::string{"moved value"})};
+
+  multi_field_array = std::move(other_multi_field_array);
+
+  ASSERT_EQ(multi_field_array.size(), 3UL);
+  ASSERT_TRUE(other_multi_field_array.empty());
+  ASSERT_EQ(other_multi_field_array.capacity(), 0UL);
+  for (const auto& [i, s] : multi_field_array)
+  {
+    ASSERT_EQ(i, 2);
+    ASSERT_EQ(s, "moved value");
+  }
+}
+
+
+namespace
+{
+
+/**
+ * @brief Counts the number of allocations made through an upstream memory resource
+ */
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocation_count = 0UL;
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocation_count;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+}  // namespace
+
+
+TEST(PmrMultiFieldArray, AllocatesFromResource)
+{
+  CountingMemoryResource resource;
+  using array_type = mf::pmr::multi_field_array<int, double, std::string>;
+  array_type multi_field_array{array_type::allocator_adapter_type{&resource}};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    multi_field_array.emplace_back(i, static_cast<double>(i), std::to_string(i));
+  }
+
+  ASSERT_GT(resource.allocation_count, 0UL);
+  ASSERT_EQ(multi_field_array.get<std::string>(99), "99");
+}
+
+
+TEST(PmrMultiFieldArray, CopyCTorUsesDefaultResource)
+{
+  CountingMemoryResource resource;
+  using array_type = mf::pmr::multi_field_array<int, std::string>;
+  const array_type multi_field_array{10, array_type::allocator_adapter_type{&resource}, std::make_tuple(1, "copied")};
+
+  const array_type copied_multi_field_array{multi_field_array};
+
+  ASSERT_EQ(resource.allocation_count, 1UL);
+  ASSERT_EQ(copied_multi_field_array.get_allocator_adapter(), array_type::allocator_adapter_type{});
+  ASSERT_EQ(copied_multi_field_array.size(), 10UL);
+  ASSERT_EQ(copied_multi_field_array.get<std::string>(9), "copied");
+}
+
+
+TEST(PmrMultiFieldArray, CopyAssignKeepsResource)
+{
+  CountingMemoryResource resource;
+  using array_type = mf::pmr::multi_field_array<int, std::string>;
+  const array_type multi_field_array{10, std::make_tuple(1, "copied")};
+  array_type assigned_multi_field_array{array_type::allocator_adapter_type{&resource}};
+
+  assigned_multi_field_array = multi_field_array;
+
+  ASSERT_EQ(resource.allocation_count, 1UL);
+  ASSERT_EQ(assigned_multi_field_array.get_allocator_adapter(), array_type::allocator_adapter_type{&resource});
+  ASSERT_EQ(assigned_multi_field_array.get<std::string>(9), "copied");
+}
+
+
+TEST(PmrMultiFieldArray, MoveAssignSameResourceTakesBuffers)
+{
+  std::pmr::unsynchronized_pool_resource resource;
+  using array_type = mf::pmr::multi_field_array<int, std::string>;
+  array_type multi_field_array{10, array_type::allocator_adapter_type{&resource}, std::make_tuple(1, "moved")};
+  array_type assigned_multi_field_array{array_type::allocator_adapter_type{&resource}};
+
+  const auto* const data = multi_field_array.data<std::string>();
+  assigned_multi_field_array = std::move(multi_field_array);
+
+  ASSERT_EQ(assigned_multi_field_array.data<std::string>(), data);
+  ASSERT_EQ(assigned_multi_field_array.size(), 10UL);
+  ASSERT_EQ(multi_field_array.capacity(), 0UL);
+}
+
+
+TEST(PmrMultiFieldArray, MoveAssignDifferentResourceMovesElements)
+{
+  CountingMemoryResource resource;
+  std::pmr::unsynchronized_pool_resource other_resource;
+  using array_type = mf::pmr::multi_field_array<int, std::string>;
+  array_type multi_field_array{10, array_type::allocator_adapter_type{&other_resource}, std::make_tuple(1, "moved")};
+  array_type assigned_multi_field_array{array_type::allocator_adapter_type{&resource}};
+
+  const auto* const data = multi_field_array.data<std::string>();
+  assigned_multi_field_array = std::move(multi_field_array);
+
+  ASSERT_EQ(resource.allocation_count, 1UL);
+  ASSERT_NE(assigned_multi_field_array.data<std::string>(), data);
+  ASSERT_EQ(assigned_multi_field_array.get_allocator_adapter(), array_type::allocator_adapter_type{&resource});
+  ASSERT_EQ(assigned_multi_field_array.size(), 10UL);
+  ASSERT_EQ(assigned_multi_field_array.get<std::string>(9), "moved");
+  ASSERT_TRUE(multi_field_array.empty());
+}
+
+
+TEST(PmrMultiFieldArray, SharedPoolResource)
+{
+  std::pmr::unsynchronized_pool_resource resource;
+  using array_type = mf::pmr::multi_field_array<int, float>;
+  std::vector<array_type> multi_field_arrays;
+  multi_field_arrays.reserve(16);
+  for (int i = 0; i < 16; ++i)
+  {
+    auto& multi_field_array = multi_field_arrays.emplace_back(array_type::allocator_adapter_type{&resource});
+    for (int j = 0; j <= i; ++j)
+    {
+      multi_field_array.emplace_back(j, static_cast<float>(j));
+    }
+  }
+
+  for (int i = 0; i < 16; ++i)
+  {
+    ASSERT_EQ(multi_field_arrays[i].size(), static_cast<std::size_t>(i + 1));
+    ASSERT_EQ(multi_field_arrays[i].get<int>(i), i);
+  }
+}
+
+TEST(MultiFieldArray, ParallelSizedCTor)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int, std::string> multi_field_array{
+    pool, 4 * mf::ThreadPool::default_min_chunk_size, std::forward_as_tuple(7, "ok")};
+
+  ASSERT_EQ(multi_field_array.size(), 4 * mf::ThreadPool::default_min_chunk_size);
+  for (const auto& [i, s] : multi_field_array)
+  {
+    ASSERT_EQ(i, 7);
+    ASSERT_EQ(s, "ok");
+  }
+}
+
+TEST(MultiFieldArray, ParallelResize)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int, std::string> multi_field_array;
+  multi_field_array.emplace_back(1, "first");
+
+  const std::size_t size = 4 * mf::ThreadPool::default_min_chunk_size;
+  multi_field_array.resize(pool, size, std::forward_as_tuple(3, "grown"));
+  ASSERT_EQ(multi_field_array.size(), size);
+  ASSERT_EQ(multi_field_array.get<std::string>(0), "first");
+  for (std::size_t i = 1; i < size; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<int>(i), 3);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), "grown");
+  }
+
+  multi_field_array.resize(pool, 10);
+  ASSERT_EQ(multi_field_array.size(), 10UL);
+  ASSERT_EQ(multi_field_array.get<std::string>(9), "grown");
+}
+
+TEST(MultiFieldArray, ParallelClear)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int, std::string> multi_field_array{pool, 4 * mf::ThreadPool::default_min_chunk_size};
+  const auto capacity = multi_field_array.capacity();
+
+  multi_field_array.clear(pool);
+  ASSERT_TRUE(multi_field_array.empty());
+  ASSERT_EQ(multi_field_array.capacity(), capacity);
+}
@@ -0,0 +1,277 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/packed_multi_field_array.hpp>
+
+TEST(PackedMultiFieldArray, DefaultCTor)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<std::string>, int> packed_multi_field_array;
+
+  ASSERT_TRUE(packed_multi_field_array.empty());
+  ASSERT_EQ(packed_multi_field_array.size(), 0UL);
+  ASSERT_EQ(packed_multi_field_array.capacity(), 0UL);
+}
+
+TEST(PackedMultiFieldArray, InitialSizeCTor)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<std::string>, int> packed_multi_field_array{100};
+
+  ASSERT_EQ(packed_multi_field_array.size(), 100UL);
+  ASSERT_EQ(packed_multi_field_array.bits<0>().word_count(), 2UL);
+  ASSERT_TRUE(packed_multi_field_array.bits<0>().none());
+  ASSERT_TRUE(packed_multi_field_array.presence<std::string>().none());
+  ASSERT_EQ(packed_multi_field_array.view<int>().size(), 100UL);
+}
+
+TEST(PackedMultiFieldArray, EmplaceBackAndGet)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<std::string>, int> packed_multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    if (i % 2 == 0)
+    {
+      packed_multi_field_array.emplace_back(true, std::to_string(i), i);
+    }
+    else
+    {
+      packed_multi_field_array.emplace_back(false, std::nullopt, i);
+    }
+  }
+  packed_multi_field_array.emplace_back();
+
+  ASSERT_EQ(packed_multi_field_array.size(), 101UL);
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(packed_multi_field_array.get<bool>(i), i % 2 == 0);
+    ASSERT_EQ(packed_multi_field_array.has<std::string>(i), i % 2 == 0);
+    ASSERT_EQ(packed_multi_field_array.get<int>(i), i);
+  }
+  ASSERT_EQ(packed_multi_field_array.get<std::string>(10), "10");
+  ASSERT_FALSE(packed_multi_field_array.get<bool>(100));
+  ASSERT_FALSE(packed_multi_field_array.has<std::string>(100));
+  ASSERT_EQ(packed_multi_field_array.bits<0>().count(), 50UL);
+}
+
+TEST(PackedMultiFieldArray, EmplaceBackWithFixedStepPolicy)
+{
+  mf::BasicPackedMultiFieldArray<
+    std::tuple<bool, mf::nullable<int>>,
+    std::allocator<std::uint8_t>,
+    mf::FixedStepCapacityIncreasePolicy<4>>
+    packed_multi_field_array;
+  for (int i = 0; i < 20; ++i)
+  {
+    packed_multi_field_array.emplace_back(true, i);
+    ASSERT_GE(packed_multi_field_array.capacity(), packed_multi_field_array.size());
+  }
+
+  ASSERT_EQ(packed_multi_field_array.size(), 20UL);
+  ASSERT_EQ(packed_multi_field_array.capacity(), 20UL);
+  for (int i = 0; i < 20; ++i)
+  {
+    ASSERT_TRUE(packed_multi_field_array.get<bool>(i));
+    ASSERT_EQ(packed_multi_field_array.get<int>(i), i);
+  }
+}
+
+TEST(PackedMultiFieldArray, BitProxyReferences)
+{
+  mf::packed_multi_field_array<bool, int> packed_multi_field_array{10};
+
+  packed_multi_field_array.get<bool>(3) = true;
+  auto [flag, value] = packed_multi_field_array.get<bool, int>(3);
+  value = 7;
+  flag.flip();
+
+  ASSERT_FALSE(std::as_const(packed_multi_field_array).get<bool>(3));
+  ASSERT_EQ(packed_multi_field_array.get<int>(3), 7);
+
+  packed_multi_field_array.bits<0>().set();
+  ASSERT_TRUE(packed_multi_field_array.bits<0>().all());
+}
+
+TEST(PackedMultiFieldArray, EmplaceAndResetNullable)
+{
+  mf::packed_multi_field_array<mf::nullable<std::string>, mf::nullable<double>> packed_multi_field_array{5};
+
+  packed_multi_field_array.emplace<std::string>(2, "abc");
+  packed_multi_field_array.emplace<double>(2, 0.5);
+  packed_multi_field_array.emplace<std::string>(4, "def");
+
+  ASSERT_TRUE((packed_multi_field_array.has<std::string, double>(2)));
+  ASSERT_FALSE((packed_multi_field_array.has<std::string, double>(4)));
+  ASSERT_EQ(packed_multi_field_array.get<std::string>(2), "abc");
+
+  packed_multi_field_array.emplace<std::string>(2, "replaced");
+  ASSERT_EQ(packed_multi_field_array.get<std::string>(2), "replaced");
+
+  packed_multi_field_array.reset<std::string>(2);
+  ASSERT_FALSE(packed_multi_field_array.has<std::string>(2));
+  ASSERT_EQ(packed_multi_field_array.presence<std::string>().count(), 1UL);
+}
+
+TEST(PackedMultiFieldArray, ForEachPresent)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<int>, mf::nullable<std::string>, float> packed_multi_field_array{
+    200};
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    if (i % 2 == 0)
+    {
+      packed_multi_field_array.emplace<int>(i, static_cast<int>(i));
+    }
+    if (i % 5 == 0)
+    {
+      packed_multi_field_array.emplace<std::string>(i, std::to_string(i));
+    }
+  }
+
+  std::vector<int> found;
+  packed_multi_field_array.for_each_present<int, std::string, float>(
+    [&found](int& n, const std::string& s, float& f) {
+      ASSERT_EQ(std::to_string(n), s);
+      f = 1.f;
+      found.push_back(n);
+    });
+  ASSERT_EQ(found.size(), 20UL);
+  ASSERT_EQ(found.back(), 190);
+  ASSERT_EQ(packed_multi_field_array.get<float>(10), 1.f);
+
+  std::size_t count = 0;
+  std::as_const(packed_multi_field_array).for_each_present<int>([&count](const int& n) { ++count; });
+  ASSERT_EQ(count, 100UL);
+}
+
+TEST(PackedMultiFieldArray, PopBackAndResize)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<std::string>, int> packed_multi_field_array;
+  for (int i = 0; i < 10; ++i)
+  {
+    packed_multi_field_array.emplace_back(true, std::to_string(i), i);
+  }
+
+  packed_multi_field_array.pop_back();
+  ASSERT_EQ(packed_multi_field_array.size(), 9UL);
+  ASSERT_EQ(packed_multi_field_array.presence<std::string>().count(), 9UL);
+
+  packed_multi_field_array.resize(4);
+  ASSERT_EQ(packed_multi_field_array.bits<0>().count(), 4UL);
+  ASSERT_EQ(packed_multi_field_array.get<std::string>(3), "3");
+
+  packed_multi_field_array.resize(8);
+  ASSERT_FALSE(packed_multi_field_array.get<bool>(7));
+  ASSERT_FALSE(packed_multi_field_array.has<std::string>(7));
+
+  packed_multi_field_array.shrink_to_fit();
+  ASSERT_EQ(packed_multi_field_array.capacity(), 8UL);
+  ASSERT_EQ(packed_multi_field_array.get<std::string>(2), "2");
+
+  packed_multi_field_array.clear();
+  ASSERT_TRUE(packed_multi_field_array.empty());
+}
+
+TEST(PackedMultiFieldArray, View)
+{
+  mf::packed_multi_field_array<bool, int, float> packed_multi_field_array{10};
+
+  for (auto [i, f] : packed_multi_field_array.view<int, float>())
+  {
+    i = 1;
+    f = 2.f;
+  }
+
+  for (const auto& [f] : std::as_const(packed_multi_field_array).view<float>())
+  {
+    ASSERT_EQ(f, 2.f);
+  }
+  ASSERT_EQ(packed_multi_field_array.get<int>(9), 1);
+}
+
+TEST(PackedMultiFieldArray, CopyAndMove)
+{
+  mf::packed_multi_field_array<bool, mf::nullable<std::string>> packed_multi_field_array;
+  for (int i = 0; i < 6; ++i)
+  {
+    packed_multi_field_array.emplace_back(i == 3, std::to_string(i));
+  }
+  packed_multi_field_array.reset<std::string>(1);
+
+  auto copied = packed_multi_field_array;
+  ASSERT_EQ(copied.size(), 6UL);
+  ASSERT_FALSE(copied.has<std::string>(1));
+  ASSERT_EQ(copied.get<std::string>(5), "5");
+  ASSERT_TRUE(copied.get<bool>(3));
+
+  auto moved = std::move(packed_multi_field_array);
+  ASSERT_EQ(moved.size(), 6UL);
+  ASSERT_TRUE(packed_multi_field_array.empty());
+
+  copied.emplace_back(false, "6");
+  moved = copied;
+  ASSERT_EQ(moved.size(), 7UL);
+  ASSERT_EQ(moved.get<std::string>(6), "6");
+
+  packed_multi_field_array = std::move(copied);
+  ASSERT_EQ(packed_multi_field_array.size(), 7UL);
+  ASSERT_TRUE(copied.empty());
+}
+
+/**
+ * @brief Counts live instances, and throws when copied while \c copies_before_throw reaches zero
+ */
+struct ThrowingCopy
+{
+  static inline int live = 0;
+  static inline int copies_before_throw = -1;
+
+  explicit ThrowingCopy(const int v) : value{v} { ++live; }
+
+  ThrowingCopy(const ThrowingCopy& other) : value{other.value}
+  {
+    if (copies_before_throw == 0)
+    {
+      throw std::runtime_error{"copy failed"};
+    }
+    --copies_before_throw;
+    ++live;
+  }
+
+  ~ThrowingCopy() { --live; }
+
+  int value;
+};
+
+TEST(PackedMultiFieldArray, CopyFailureDestroysCopiedValues)
+{
+  {
+    mf::packed_multi_field_array<int, mf::nullable<ThrowingCopy>> packed_multi_field_array;
+    for (int i = 0; i < 100; ++i)
+    {
+      packed_multi_field_array.emplace_back(i, i);
+    }
+    packed_multi_field_array.reset<ThrowingCopy>(1);
+    ASSERT_EQ(ThrowingCopy::live, 99);
+
+    ThrowingCopy::copies_before_throw = 50;
+    ASSERT_THROW(auto copied = packed_multi_field_array, std::runtime_error);
+    ThrowingCopy::copies_before_throw = -1;
+
+    ASSERT_EQ(ThrowingCopy::live, 99);
+  }
+  ASSERT_EQ(ThrowingCopy::live, 0);
+}
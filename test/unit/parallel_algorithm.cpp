@@ -0,0 +1,180 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/multi_field_array.hpp>
+#include <mf/parallel_algorithm.hpp>
+
+TEST(ParallelAlgorithm, ParallelForEach)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int, double, std::string> multi_field_array{10000};
+
+  mf::parallel_for_each(
+    pool,
+    multi_field_array.view<int, std::string>(),
+    [](int& i, std::string& s) {
+      i = 1;
+      s = "ok";
+    },
+    16);
+
+  for (const auto& [i, d, s] : multi_field_array.view())
+  {
+    ASSERT_EQ(i, 1);
+    ASSERT_EQ(s, "ok");
+  }
+}
+
+TEST(ParallelAlgorithm, ParallelForEachCacheLineAlignedRanges)
+{
+  mf::ThreadPool pool{4};
+  mf::BasicMultiFieldArray<
+    std::tuple<float, double, std::int8_t>,
+    mf::aligned_single_allocator_adapter<mf::cache_line_size, float, double, std::int8_t>,
+    mf::DefaultCapacityIncreasePolicy>
+    multi_field_array{5000};
+
+  std::vector<std::thread::id> owners(multi_field_array.size());
+  const float* const first = &multi_field_array.get<float>(0);
+  mf::parallel_for_each(
+    pool,
+    multi_field_array.view(),
+    [&owners, first](float& f, [[maybe_unused]] double& d, [[maybe_unused]] std::int8_t& b) {
+      owners[&f - first] = std::this_thread::get_id();
+    },
+    1);
+
+  // Work may only change hands where all fields start a cache line
+  const auto starts_cache_line = [](const void* const ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % mf::cache_line_size == 0UL;
+  };
+  for (std::size_t i = 1; i < owners.size(); ++i)
+  {
+    if (owners[i] != owners[i - 1])
+    {
+      ASSERT_TRUE(starts_cache_line(&multi_field_array.get<float>(i)));
+      ASSERT_TRUE(starts_cache_line(&multi_field_array.get<double>(i)));
+      ASSERT_TRUE(starts_cache_line(&multi_field_array.get<std::int8_t>(i)));
+    }
+  }
+}
+
+TEST(ParallelAlgorithm, CommonCacheLineIndex)
+{
+  alignas(mf::cache_line_size) static std::uint8_t buffer[4 * mf::cache_line_size];
+  const auto* const floats = reinterpret_cast<float*>(buffer + mf::cache_line_size - 8);
+  const auto* const doubles = reinterpret_cast<double*>(buffer + 2 * mf::cache_line_size - 16);
+  const auto* const bytes = buffer + 3 * mf::cache_line_size - 18;
+
+  ASSERT_EQ(mf::detail::common_cache_line_index(std::make_tuple(floats)), 2UL);
+  ASSERT_EQ(mf::detail::common_cache_line_index(std::make_tuple(floats, doubles)), 2UL);
+  ASSERT_EQ(mf::detail::common_cache_line_index(std::make_tuple(floats, doubles, bytes)), 18UL);
+
+  // Fields which never start a cache line at the same index
+  ASSERT_EQ(mf::detail::common_cache_line_index(std::make_tuple(floats, bytes + 1)), 64UL);
+}
+
+TEST(ParallelAlgorithm, ParallelForEachStealsFromSlowThreads)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int> multi_field_array{4000};
+
+  // First quarter of elements is much more expensive than the rest
+  std::vector<std::atomic<int>> visits(multi_field_array.size());
+  mf::parallel_for_each(
+    pool,
+    multi_field_array.view(),
+    [&visits, first = &multi_field_array.get<int>(0)](int& i) {
+      const std::size_t index = &i - first;
+      if (index < 1000)
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds{10});
+      }
+      ++visits[index];
+    },
+    16);
+
+  for (const auto& count : visits)
+  {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+
+TEST(ParallelAlgorithm, ParallelForEachRethrows)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<int> multi_field_array{10000};
+
+  ASSERT_THROW(
+    mf::parallel_for_each(
+      pool,
+      multi_field_array.view(),
+      [first = &multi_field_array.get<int>(0)](int& i) {
+        if (&i - first == 5000)
+        {
+          throw std::runtime_error{"element failed"};
+        }
+      },
+      16),
+    std::runtime_error);
+}
+
+TEST(ParallelAlgorithm, ParallelTransform)
+{
+  mf::ThreadPool pool{4};
+  mf::multi_field_array<float, float, double> multi_field_array{10000};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    std::get<0>(multi_field_array[i]) = static_cast<float>(i);
+  }
+
+  mf::parallel_transform(
+    pool, multi_field_array.view<0>(), multi_field_array.view<1>(), [](const float x) { return 2.f * x; }, 16);
+  mf::parallel_transform(
+    pool,
+    multi_field_array.view<0, 1>(),
+    multi_field_array.view<0, 2>(),
+    [](const float x, const float y) { return std::make_tuple(x + y, static_cast<double>(y)); },
+    16);
+
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    ASSERT_EQ(std::get<0>(multi_field_array[i]), 3.f * i);
+    ASSERT_EQ(std::get<1>(multi_field_array[i]), 2.f * i);
+    ASSERT_EQ(std::get<2>(multi_field_array[i]), 2.0 * i);
+  }
+}
+
+TEST(View, Subview)
+{
+  mf::multi_field_array<int, std::string> multi_field_array{10};
+  for (std::size_t i = 0; i < multi_field_array.size(); ++i)
+  {
+    multi_field_array.get<int>(i) = static_cast<int>(i);
+  }
+
+  auto subview = multi_field_array.view().subview(4, 3);
+  ASSERT_EQ(subview.size(), 3UL);
+  ASSERT_EQ(std::get<0>(subview[0]), 4);
+  ASSERT_EQ(std::get<0>(subview.data()), &multi_field_array.get<int>(4));
+
+  const auto& const_multi_field_array = multi_field_array;
+  ASSERT_EQ(std::get<0>(const_multi_field_array.view().subview(9, 1)[0]), 9);
+  ASSERT_TRUE(multi_field_array.view().subview(10, 0).empty());
+  ASSERT_THROW(multi_field_array.view().subview(8, 3), std::out_of_range);
+}
@@ -0,0 +1,134 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/pooled_allocator_adapter.hpp>
+
+TEST(PooledAllocatorAdapter, ReleasedBlockIsReused)
+{
+  using adapter_type = mf::pooled_allocator_adapter<char, double, std::string>;
+  adapter_type allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(10);
+  const auto* const block = std::get<0>(tuple_of_ptrs);
+  allocator.deallocate(tuple_of_ptrs, 10);
+
+  ASSERT_EQ(adapter_type::cached_block_count(), 1UL);
+
+  // Any count in the same size class reuses the block
+  auto [char_ptr, double_ptr, string_ptr] = allocator.allocate(13);
+  ASSERT_EQ(char_ptr, block);
+  ASSERT_EQ(adapter_type::cached_block_count(), 0UL);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(double_ptr) % alignof(double), 0UL);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(string_ptr) % alignof(std::string), 0UL);
+  ASSERT_LE(reinterpret_cast<const void*>(char_ptr + 13), reinterpret_cast<const void*>(double_ptr));
+  ASSERT_LE(reinterpret_cast<const void*>(double_ptr + 13), reinterpret_cast<const void*>(string_ptr));
+
+  allocator.deallocate(std::make_tuple(char_ptr, double_ptr, string_ptr), 13);
+  adapter_type::trim();
+  ASSERT_EQ(adapter_type::cached_block_count(), 0UL);
+}
+
+TEST(PooledAllocatorAdapter, DifferentSizeClassIsNotReused)
+{
+  using adapter_type = mf::pooled_allocator_adapter<int, float>;
+  adapter_type allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(10);
+  allocator.deallocate(tuple_of_ptrs, 10);
+
+  auto other_tuple_of_ptrs = allocator.allocate(17);
+  ASSERT_EQ(adapter_type::cached_block_count(), 1UL);
+  allocator.deallocate(other_tuple_of_ptrs, 17);
+
+  ASSERT_EQ(adapter_type::cached_block_count(), 2UL);
+  adapter_type::trim();
+}
+
+TEST(PooledAllocatorAdapter, PoolIsPerThread)
+{
+  using adapter_type = mf::pooled_allocator_adapter<int, std::uint8_t>;
+  adapter_type allocator;
+
+  allocator.deallocate(allocator.allocate(4), 4);
+  ASSERT_EQ(adapter_type::cached_block_count(), 1UL);
+
+  std::thread{[] { ASSERT_EQ(adapter_type::cached_block_count(), 0UL); }}.join();
+
+  adapter_type::trim();
+}
+
+TEST(PooledAllocatorAdapter, ReleaseAfterPoolDestroyed)
+{
+  using array_type = mf::pooled_multi_field_array<int, std::string, double>;
+
+  std::thread{[] {
+    // Constructed before the pool is first used, so destroyed after it on thread exit
+    thread_local array_type array;
+    array.resize(10);
+    ASSERT_EQ(array.size(), 10UL);
+  }}.join();
+}
+
+TEST(PooledAllocatorAdapter, MultiFieldArrayReusesCapacity)
+{
+  using array_type = mf::pooled_multi_field_array<int, std::string, double>;
+
+  const int* first_data = nullptr;
+  for (int n = 0; n < 3; ++n)
+  {
+    array_type multi_field_array;
+    for (int i = 0; i < 100; ++i)
+    {
+      multi_field_array.emplace_back(i, std::to_string(i), static_cast<double>(i));
+    }
+
+    ASSERT_EQ(multi_field_array.capacity(), 128UL);
+    for (int i = 0; i < 100; ++i)
+    {
+      ASSERT_EQ(multi_field_array.get<int>(i), i);
+      ASSERT_EQ(multi_field_array.get<std::string>(i), std::to_string(i));
+    }
+
+    if (first_data == nullptr)
+    {
+      first_data = multi_field_array.data<int>();
+    }
+    else
+    {
+      ASSERT_EQ(multi_field_array.data<int>(), first_data);
+    }
+  }
+
+  array_type::allocator_adapter_type::trim();
+}
+
+TEST(PooledAllocatorAdapter, MultiFieldArrayTriviallyRelocatableGrowth)
+{
+  mf::pooled_multi_field_array<char, int, double> multi_field_array;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    multi_field_array.emplace_back(static_cast<char>(i), i, static_cast<double>(i));
+  }
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<char>(i), static_cast<char>(i));
+    ASSERT_EQ(multi_field_array.get<int>(i), i);
+    ASSERT_EQ(multi_field_array.get<double>(i), static_cast<double>(i));
+  }
+
+  multi_field_array.reserve(1001);
+  ASSERT_EQ(multi_field_array.get<double>(999), 999.0);
+}
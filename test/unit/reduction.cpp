@@ -0,0 +1,145 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/multi_field_array.hpp>
+#include <mf/reduction.hpp>
+
+namespace
+{
+
+mf::multi_field_array<float, int, std::string> make_multi_field_array(const std::size_t size)
+{
+  mf::multi_field_array<float, int, std::string> multi_field_array{size};
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    // Values rise to (size / 4), fall to 1, then rise from 0 to (size / 2 - 1)
+    const int value = static_cast<int>(i < size / 4 ? i : (i < size / 2 ? size / 2 - i : i - size / 2));
+    multi_field_array.get<float>(i) = 0.1f * static_cast<float>(i % 7);
+    multi_field_array.get<int>(i) = value;
+    multi_field_array.get<std::string>(i) = std::to_string(i % 10);
+  }
+  return multi_field_array;
+}
+
+}  // namespace
+
+TEST(Reduction, Reduce)
+{
+  const auto multi_field_array = make_multi_field_array(1000);
+
+  const auto total_length = mf::reduce(
+    multi_field_array.view<int, std::string>(),
+    std::size_t{0},
+    [](std::size_t acc, const int i, const std::string& s) { return acc + static_cast<std::size_t>(i) + s.size(); });
+  std::size_t expected_total_length = 0;
+  for (const auto& [f, i, s] : multi_field_array.view())
+  {
+    expected_total_length += static_cast<std::size_t>(i) + s.size();
+  }
+  ASSERT_EQ(total_length, expected_total_length);
+
+  mf::ThreadPool pool{4};
+  const auto parallel_total_length = mf::reduce(
+    pool,
+    multi_field_array.view<int, std::string>(),
+    std::size_t{0},
+    [](std::size_t acc, const int i, const std::string& s) { return acc + static_cast<std::size_t>(i) + s.size(); },
+    [](const std::size_t lhs, const std::size_t rhs) { return lhs + rhs; });
+  ASSERT_EQ(parallel_total_length, total_length);
+}
+
+TEST(Reduction, SumSingleField)
+{
+  mf::multi_field_array<std::int8_t> multi_field_array{300};
+  std::fill(multi_field_array.begin<std::int8_t>(), multi_field_array.end<std::int8_t>(), std::int8_t{100});
+
+  // Sums of small types are promoted
+  const auto sum = mf::sum(multi_field_array.view());
+  ASSERT_TRUE((std::is_same_v<decltype(sum), const int>));
+  ASSERT_EQ(sum, 30000);
+
+  ASSERT_EQ(mf::sum(mf::multi_field_array<double>{}.view()), 0.0);
+}
+
+TEST(Reduction, SumMultiFieldIsDeterministic)
+{
+  const auto multi_field_array = make_multi_field_array(100003);
+
+  const auto [float_sum, int_sum] = mf::sum(multi_field_array.view<float, int>());
+  ASSERT_EQ(int_sum, std::accumulate(multi_field_array.begin<int>(), multi_field_array.end<int>(), 0));
+  ASSERT_NEAR(float_sum, 0.3f * 100003, 1.f);
+
+  // Floating point sums are identical, bit for bit, regardless of the number of threads
+  for (std::size_t thread_count = 1; thread_count <= 4; ++thread_count)
+  {
+    mf::ThreadPool pool{thread_count};
+    ASSERT_EQ(mf::sum(pool, multi_field_array.view<float>()), float_sum);
+  }
+}
+
+TEST(Reduction, MinMax)
+{
+  const auto multi_field_array = make_multi_field_array(100000);
+
+  ASSERT_EQ(mf::min(multi_field_array.view<int>()), 0);
+  ASSERT_EQ(mf::max(multi_field_array.view<int>()), 49999);
+  ASSERT_EQ(mf::minmax(multi_field_array.view<int>()), std::make_pair(0, 49999));
+  ASSERT_EQ(mf::min(multi_field_array.view<std::string>()), "0");
+
+  const auto [float_max, int_max] = mf::max(multi_field_array.view<float, int>());
+  ASSERT_EQ(float_max, 0.6f);
+  ASSERT_EQ(int_max, 49999);
+
+  mf::ThreadPool pool{4};
+  ASSERT_EQ(mf::minmax(pool, multi_field_array.view<int>()), std::make_pair(0, 49999));
+  ASSERT_EQ(mf::min(pool, multi_field_array.view<float>()), 0.f);
+  ASSERT_EQ(mf::max(pool, multi_field_array.view<int>().subview(0, 50000)), 25000);
+}
+
+TEST(Reduction, ArgMinArgMax)
+{
+  const auto multi_field_array = make_multi_field_array(100000);
+
+  // First of equal values is found
+  ASSERT_EQ(mf::argmin(multi_field_array.view<int>()), 0UL);
+  ASSERT_EQ(mf::argmax(multi_field_array.view<int>()), 99999UL);
+  ASSERT_EQ(mf::argmax(multi_field_array.view<float>()), 6UL);
+  ASSERT_EQ(mf::argmin(multi_field_array.view<int>().subview(1, 99999)), 49999UL);
+  ASSERT_EQ(mf::argmax(multi_field_array.view<int>().subview(0, 50000)), 25000UL);
+
+  mf::ThreadPool pool{4};
+  ASSERT_EQ(mf::argmax(pool, multi_field_array.view<float, int>()), std::make_tuple(6UL, 99999UL));
+  ASSERT_EQ(mf::argmin(pool, multi_field_array.view<int>().subview(1, 99999)), 49999UL);
+
+  ASSERT_EQ(mf::argmin(mf::multi_field_array<float>{}.view()), 0UL);
+}
+
+TEST(Reduction, CountIf)
+{
+  const auto multi_field_array = make_multi_field_array(10000);
+
+  const auto count = mf::count_if(
+    multi_field_array.view<int, std::string>(), [](const int i, const std::string& s) { return i > 100 and s == "0"; });
+  std::size_t expected_count = 0;
+  for (const auto& [f, i, s] : multi_field_array.view())
+  {
+    expected_count += (i > 100 and s == "0");
+  }
+  ASSERT_EQ(count, expected_count);
+
+  mf::ThreadPool pool{4};
+  ASSERT_EQ(mf::count_if(pool, multi_field_array.view<float>(), [](const float f) { return f == 0.f; }), 1429UL);
+}
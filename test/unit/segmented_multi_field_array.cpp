@@ -0,0 +1,317 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/segmented_multi_field_array.hpp>
+
+namespace
+{
+
+/// Fails the next global allocation while set; used to fail growth of the chunk directory
+bool fail_next_operator_new = false;
+
+}  // namespace
+
+void* operator new(const std::size_t n)
+{
+  if (fail_next_operator_new)
+  {
+    fail_next_operator_new = false;
+    throw std::bad_alloc{};
+  }
+  if (void* const ptr = std::malloc(n == 0UL ? 1UL : n); ptr != nullptr)
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* const ptr, std::size_t) noexcept { std::free(ptr); }
+
+/**
+ * @brief Allocator which counts live allocations, and fails every allocation while \c fail is set
+ *
+ *        Memory comes from \c std::malloc so that chunk allocations never reach the global <code>operator new</code>
+ */
+template <typename T> struct CountingAllocator : std::allocator<T>
+{
+  template <typename U> struct rebind
+  {
+    using other = CountingAllocator<U>;
+  };
+
+  static inline bool fail = false;
+  static inline std::size_t live = 0UL;
+
+  T* allocate(const std::size_t n)
+  {
+    if (fail)
+    {
+      throw std::bad_alloc{};
+    }
+    T* const ptr = static_cast<T*>(std::malloc(n * sizeof(T)));
+    if (ptr == nullptr)
+    {
+      throw std::bad_alloc{};
+    }
+    ++live;
+    return ptr;
+  }
+
+  void deallocate(T* const ptr, [[maybe_unused]] const std::size_t n)
+  {
+    std::free(ptr);
+    --live;
+  }
+};
+
+using counting_segmented_multi_field_array = mf::BasicSegmentedMultiFieldArray<
+  std::tuple<int>,
+  mf::BasicMultiAllocatorAdapter<std::tuple<int>, std::tuple<CountingAllocator<int>>>,
+  4>;
+
+TEST(SegmentedMultiFieldArray, DefaultCTor)
+{
+  mf::segmented_multi_field_array<16, float, int, std::string> segmented_multi_field_array;
+
+  ASSERT_TRUE(segmented_multi_field_array.empty());
+  ASSERT_EQ(segmented_multi_field_array.size(), 0UL);
+  ASSERT_EQ(segmented_multi_field_array.capacity(), 0UL);
+  ASSERT_EQ(segmented_multi_field_array.chunk_count(), 0UL);
+}
+
+TEST(SegmentedMultiFieldArray, InitialSizeAndValueCTor)
+{
+  mf::segmented_multi_field_array<4, float, int, std::string> segmented_multi_field_array{
+    10, std::forward_as_tuple(4.f, 1, "bbb")};
+
+  ASSERT_EQ(segmented_multi_field_array.size(), 10UL);
+  ASSERT_EQ(segmented_multi_field_array.capacity(), 12UL);
+  ASSERT_EQ(segmented_multi_field_array.chunk_count(), 3UL);
+  for (const auto& [f, i, s] : segmented_multi_field_array)
+  {
+    ASSERT_EQ(f, 4.f);
+    ASSERT_EQ(i, 1);
+    ASSERT_EQ(s, "bbb");
+  }
+}
+
+TEST(SegmentedMultiFieldArray, EmplaceBackKeepsElementAddresses)
+{
+  mf::segmented_multi_field_array<8, int, std::string> segmented_multi_field_array;
+  segmented_multi_field_array.emplace_back(0, "0");
+
+  const int* const first_int = &segmented_multi_field_array.get<int>(0);
+  const std::string* const first_string = &segmented_multi_field_array.get<std::string>(0);
+
+  for (int i = 1; i < 1000; ++i)
+  {
+    segmented_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  ASSERT_EQ(&segmented_multi_field_array.get<int>(0), first_int);
+  ASSERT_EQ(&segmented_multi_field_array.get<std::string>(0), first_string);
+  ASSERT_EQ(segmented_multi_field_array.chunk_count(), 125UL);
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(segmented_multi_field_array.get<int>(i), i);
+    ASSERT_EQ(segmented_multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+TEST(SegmentedMultiFieldArray, EmplaceBackPiecewiseAndDefault)
+{
+  mf::segmented_multi_field_array<2, int, std::string> segmented_multi_field_array;
+  segmented_multi_field_array.emplace_back(std::piecewise_construct, std::make_tuple(3), std::make_tuple("abc"));
+  segmented_multi_field_array.emplace_back();
+
+  ASSERT_EQ(segmented_multi_field_array.get<int>(0), 3);
+  ASSERT_EQ(segmented_multi_field_array.get<std::string>(0), "abc");
+  ASSERT_EQ(segmented_multi_field_array.get<int>(1), 0);
+  ASSERT_TRUE(segmented_multi_field_array.get<std::string>(1).empty());
+}
+
+TEST(SegmentedMultiFieldArray, ChunkViews)
+{
+  mf::segmented_multi_field_array<4, int, float, std::string> segmented_multi_field_array;
+  for (int i = 0; i < 10; ++i)
+  {
+    segmented_multi_field_array.emplace_back(i, static_cast<float>(i), std::to_string(i));
+  }
+
+  ASSERT_EQ(segmented_multi_field_array.chunk(0).size(), 4UL);
+  ASSERT_EQ(segmented_multi_field_array.chunk(2).size(), 2UL);
+
+  int expected = 0;
+  segmented_multi_field_array.for_each_chunk([&expected](auto chunk_view) {
+    const int* const values = &std::get<0>(chunk_view[0]);
+    for (std::size_t i = 0; i < chunk_view.size(); ++i)
+    {
+      ASSERT_EQ(values[i], expected++);
+    }
+  });
+  ASSERT_EQ(expected, 10);
+
+  const auto& const_segmented_multi_field_array = segmented_multi_field_array;
+  for (const auto& [i, s] : const_segmented_multi_field_array.chunk<0, 2>(1))
+  {
+    ASSERT_EQ(std::to_string(i), s);
+  }
+  for (const auto& [f] : const_segmented_multi_field_array.chunk<float>(2))
+  {
+    ASSERT_GE(f, 8.f);
+  }
+}
+
+TEST(SegmentedMultiFieldArray, PopBackAndResize)
+{
+  mf::segmented_multi_field_array<4, int, std::string> segmented_multi_field_array;
+  segmented_multi_field_array.resize(9, std::forward_as_tuple(7, "ok"));
+  ASSERT_EQ(segmented_multi_field_array.size(), 9UL);
+  ASSERT_EQ(segmented_multi_field_array.get<std::string>(8), "ok");
+
+  segmented_multi_field_array.pop_back();
+  ASSERT_EQ(segmented_multi_field_array.size(), 8UL);
+  ASSERT_EQ(segmented_multi_field_array.capacity(), 12UL);
+
+  segmented_multi_field_array.resize(3);
+  ASSERT_EQ(segmented_multi_field_array.size(), 3UL);
+  ASSERT_EQ(segmented_multi_field_array.capacity(), 12UL);
+
+  segmented_multi_field_array.shrink_to_fit();
+  ASSERT_EQ(segmented_multi_field_array.capacity(), 4UL);
+
+  segmented_multi_field_array.resize(6);
+  ASSERT_EQ(segmented_multi_field_array.get<std::string>(2), "ok");
+  ASSERT_TRUE(segmented_multi_field_array.get<std::string>(5).empty());
+}
+
+TEST(SegmentedMultiFieldArray, AtOutOfRange)
+{
+  mf::segmented_multi_field_array<4, int> segmented_multi_field_array{3};
+  ASSERT_NO_THROW(segmented_multi_field_array.at(2));
+  ASSERT_THROW(segmented_multi_field_array.at(3), std::out_of_range);
+}
+
+TEST(SegmentedMultiFieldArray, CopyAndMove)
+{
+  mf::segmented_multi_field_array<4, int, std::string> segmented_multi_field_array;
+  for (int i = 0; i < 6; ++i)
+  {
+    segmented_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  auto copied = segmented_multi_field_array;
+  ASSERT_EQ(copied.size(), 6UL);
+  ASSERT_EQ(copied.get<std::string>(5), "5");
+
+  const std::string* const original_address = &segmented_multi_field_array.get<std::string>(5);
+  auto moved = std::move(segmented_multi_field_array);
+  ASSERT_EQ(&moved.get<std::string>(5), original_address);
+  ASSERT_TRUE(segmented_multi_field_array.empty());
+
+  copied.emplace_back(6, "6");
+  moved.swap(copied);
+  ASSERT_EQ(moved.size(), 7UL);
+  ASSERT_EQ(copied.size(), 6UL);
+
+  copied = moved;
+  ASSERT_EQ(copied.size(), 7UL);
+  ASSERT_EQ(copied.get<std::string>(6), "6");
+}
+
+TEST(SegmentedMultiFieldArray, MoveAssignWithUnequalAdapters)
+{
+  using array_type = mf::BasicSegmentedMultiFieldArray<
+    std::tuple<int, std::string>,
+    mf::pmr::single_allocator_adapter<int, std::string>,
+    4>;
+
+  std::pmr::monotonic_buffer_resource resource_a;
+  std::pmr::monotonic_buffer_resource resource_b;
+
+  array_type segmented_multi_field_array_a{mf::pmr::single_allocator_adapter<int, std::string>{&resource_a}};
+  array_type segmented_multi_field_array_b{mf::pmr::single_allocator_adapter<int, std::string>{&resource_b}};
+  for (int i = 0; i < 5; ++i)
+  {
+    segmented_multi_field_array_b.emplace_back(i, std::to_string(i));
+  }
+
+  segmented_multi_field_array_a = std::move(segmented_multi_field_array_b);
+  ASSERT_EQ(segmented_multi_field_array_a.size(), 5UL);
+  ASSERT_TRUE(segmented_multi_field_array_b.empty());
+  ASSERT_EQ(segmented_multi_field_array_a.get<std::string>(4), "4");
+}
+
+TEST(SegmentedMultiFieldArray, IterateAllElements)
+{
+  mf::segmented_multi_field_array<8, int, double> segmented_multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    segmented_multi_field_array.emplace_back(i, 0.5);
+  }
+
+  for (auto [i, d] : segmented_multi_field_array)
+  {
+    d += i;
+  }
+
+  ASSERT_EQ(std::distance(segmented_multi_field_array.begin(), segmented_multi_field_array.end()), 100);
+  ASSERT_EQ(std::get<1>(segmented_multi_field_array[99]), 99.5);
+}
+
+TEST(SegmentedMultiFieldArray, ChunkAllocationFailureLeavesArrayUnchanged)
+{
+  counting_segmented_multi_field_array segmented_multi_field_array;
+  for (int i = 0; i < 4; ++i)
+  {
+    segmented_multi_field_array.emplace_back(i);
+  }
+
+  CountingAllocator<int>::fail = true;
+  ASSERT_THROW(segmented_multi_field_array.emplace_back(4), std::bad_alloc);
+  CountingAllocator<int>::fail = false;
+
+  ASSERT_EQ(segmented_multi_field_array.size(), 4UL);
+  ASSERT_EQ(segmented_multi_field_array.chunk_count(), 1UL);
+  ASSERT_EQ(CountingAllocator<int>::live, 1UL);
+
+  segmented_multi_field_array.emplace_back(4);
+  ASSERT_EQ(segmented_multi_field_array.get<int>(4), 4);
+}
+
+TEST(SegmentedMultiFieldArray, ChunkDirectoryGrowthFailureDoesNotLeakChunk)
+{
+  {
+    counting_segmented_multi_field_array segmented_multi_field_array;
+    for (int i = 0; i < 4; ++i)
+    {
+      segmented_multi_field_array.emplace_back(i);
+    }
+
+    fail_next_operator_new = true;
+    ASSERT_THROW(segmented_multi_field_array.emplace_back(4), std::bad_alloc);
+    fail_next_operator_new = false;
+
+    ASSERT_EQ(segmented_multi_field_array.size(), 4UL);
+    ASSERT_EQ(segmented_multi_field_array.chunk_count(), 1UL);
+    ASSERT_EQ(CountingAllocator<int>::live, 1UL);
+  }
+  ASSERT_EQ(CountingAllocator<int>::live, 0UL);
+}
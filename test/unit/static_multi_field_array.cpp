@@ -0,0 +1,169 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/static_multi_field_array.hpp>
+
+TEST(StaticMultiFieldArray, DefaultCTor)
+{
+  mf::static_multi_field_array<8, float, int, std::string> static_multi_field_array;
+
+  ASSERT_TRUE(static_multi_field_array.empty());
+  ASSERT_EQ(static_multi_field_array.size(), 0UL);
+  ASSERT_EQ(static_multi_field_array.capacity(), 8UL);
+}
+
+TEST(StaticMultiFieldArray, FieldsHeldWithinContainer)
+{
+  using array_type = mf::static_multi_field_array<4, char, double, std::uint16_t>;
+  array_type static_multi_field_array;
+
+  const auto* const first = reinterpret_cast<const std::uint8_t*>(&static_multi_field_array);
+  const auto* const last = first + sizeof(array_type);
+  const auto is_within = [first, last](const void* ptr) {
+    const auto* const byte_ptr = reinterpret_cast<const std::uint8_t*>(ptr);
+    return byte_ptr >= first and byte_ptr < last;
+  };
+
+  ASSERT_TRUE(is_within(static_multi_field_array.data<0>()));
+  ASSERT_TRUE(is_within(static_multi_field_array.data<1>() + 3));
+  ASSERT_TRUE(is_within(static_multi_field_array.data<2>() + 3));
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(static_multi_field_array.data<1>()) % alignof(double), 0UL);
+}
+
+TEST(StaticMultiFieldArray, InitialSizeAndValueCTor)
+{
+  mf::static_multi_field_array<16, float, int, std::string> static_multi_field_array{
+    10, std::forward_as_tuple(4.f, 1, "bbb")};
+
+  ASSERT_EQ(static_multi_field_array.size(), 10UL);
+  for (const auto& [f, i, s] : static_multi_field_array)
+  {
+    ASSERT_EQ(f, 4.f);
+    ASSERT_EQ(i, 1);
+    ASSERT_EQ(s, "bbb");
+  }
+}
+
+TEST(StaticMultiFieldArray, InitialSizeExceedsCapacity)
+{
+  using array_type = mf::static_multi_field_array<4, float, int>;
+  ASSERT_THROW((array_type{5}), std::length_error);
+}
+
+TEST(StaticMultiFieldArray, EmplaceBackUntilFull)
+{
+  mf::static_multi_field_array<100, int, std::string> static_multi_field_array;
+  for (int i = 0; i < 100; ++i)
+  {
+    static_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  ASSERT_TRUE(static_multi_field_array.full());
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(static_multi_field_array.get<int>(i), i);
+    ASSERT_EQ(static_multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+TEST(StaticMultiFieldArray, EmplaceBackPiecewise)
+{
+  mf::static_multi_field_array<4, int, std::string> static_multi_field_array;
+  static_multi_field_array.emplace_back(
+    std::piecewise_construct, std::make_tuple(3), std::make_tuple("xxx", std::size_t{2}));
+
+  ASSERT_EQ(static_multi_field_array.get<int>(0), 3);
+  ASSERT_EQ(static_multi_field_array.get<std::string>(0), "xx");
+}
+
+TEST(StaticMultiFieldArray, PopBack)
+{
+  mf::static_multi_field_array<4, int, std::string> static_multi_field_array;
+  static_multi_field_array.emplace_back(1, "a");
+  static_multi_field_array.emplace_back(2, "b");
+  static_multi_field_array.pop_back();
+
+  ASSERT_EQ(static_multi_field_array.size(), 1UL);
+  ASSERT_EQ(std::get<1>(static_multi_field_array.back()), "a");
+}
+
+TEST(StaticMultiFieldArray, EraseByIndexAndIterator)
+{
+  mf::static_multi_field_array<8, int, std::string> static_multi_field_array;
+  for (int i = 0; i < 6; ++i)
+  {
+    static_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  ASSERT_EQ(static_multi_field_array.erase(1UL), 1UL);
+  const auto itr = static_multi_field_array.erase(static_multi_field_array.begin() + 1);
+  ASSERT_EQ(std::get<0>(*itr), 3);
+
+  ASSERT_EQ(static_multi_field_array.erase(1UL, 3UL), 1UL);
+
+  ASSERT_EQ(static_multi_field_array.size(), 2UL);
+  ASSERT_EQ(static_multi_field_array.get<std::string>(0), "0");
+  ASSERT_EQ(static_multi_field_array.get<std::string>(1), "5");
+}
+
+TEST(StaticMultiFieldArray, Resize)
+{
+  mf::static_multi_field_array<8, int, std::string> static_multi_field_array;
+  static_multi_field_array.resize(5, std::forward_as_tuple(7, "ok"));
+  ASSERT_EQ(static_multi_field_array.size(), 5UL);
+  ASSERT_EQ(static_multi_field_array.get<std::string>(4), "ok");
+
+  static_multi_field_array.resize(2);
+  ASSERT_EQ(static_multi_field_array.size(), 2UL);
+
+  ASSERT_THROW(static_multi_field_array.resize(9), std::length_error);
+  ASSERT_EQ(static_multi_field_array.size(), 2UL);
+}
+
+TEST(StaticMultiFieldArray, CopyAndMove)
+{
+  mf::static_multi_field_array<8, int, std::string> static_multi_field_array{3, std::forward_as_tuple(1, "abc")};
+
+  auto copied = static_multi_field_array;
+  ASSERT_EQ(copied.size(), 3UL);
+  ASSERT_EQ(copied.get<std::string>(2), "abc");
+
+  auto moved = std::move(static_multi_field_array);
+  ASSERT_EQ(moved.size(), 3UL);
+  ASSERT_EQ(moved.get<std::string>(2), "abc");
+  ASSERT_TRUE(static_multi_field_array.empty());
+
+  copied.emplace_back(2, "def");
+  moved.swap(copied);
+  ASSERT_EQ(moved.size(), 4UL);
+  ASSERT_EQ(copied.size(), 3UL);
+  ASSERT_EQ(moved.get<std::string>(3), "def");
+}
+
+TEST(StaticMultiFieldArray, View)
+{
+  mf::static_multi_field_array<8, int, float, std::string> static_multi_field_array{
+    4, std::forward_as_tuple(2, 1.f, "")};
+
+  for (auto [i, s] : static_multi_field_array.view<int, std::string>())
+  {
+    s = std::to_string(i);
+  }
+
+  for (const auto& [i, s] : static_multi_field_array.view<0, 2>())
+  {
+    ASSERT_EQ(std::to_string(i), s);
+  }
+}
@@ -0,0 +1,177 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/thread_pool.hpp>
+
+TEST(ThreadPool, Size)
+{
+  mf::ThreadPool pool{4};
+  ASSERT_EQ(pool.size(), 4UL);
+}
+
+TEST(ThreadPool, ZeroThreadsRunsOnCallingThread)
+{
+  mf::ThreadPool pool{0};
+  ASSERT_EQ(pool.size(), 1UL);
+
+  std::size_t total = 0;
+  pool.parallel_for(10000, [&total](std::size_t first, std::size_t last) { total += last - first; }, 1);
+  ASSERT_EQ(total, 10000UL);
+}
+
+TEST(ThreadPool, ParallelForCoversRange)
+{
+  mf::ThreadPool pool{4};
+  std::vector<int> visits(10000, 0);
+  pool.parallel_for(
+    visits.size(),
+    [&visits](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        ++visits[i];
+      }
+    },
+    1);
+
+  for (const int count : visits)
+  {
+    ASSERT_EQ(count, 1);
+  }
+}
+
+TEST(ThreadPool, ParallelForSmallRangeRunsOnCallingThread)
+{
+  mf::ThreadPool pool{4};
+  std::size_t chunk_count = 0;
+  std::thread::id chunk_thread_id;
+  pool.parallel_for(100, [&](std::size_t first, std::size_t last) {
+    ++chunk_count;
+    chunk_thread_id = std::this_thread::get_id();
+    ASSERT_EQ(first, 0UL);
+    ASSERT_EQ(last, 100UL);
+  });
+
+  ASSERT_EQ(chunk_count, 1UL);
+  ASSERT_EQ(chunk_thread_id, std::this_thread::get_id());
+}
+
+TEST(ThreadPool, ParallelForSameChunksOnEachJob)
+{
+  mf::ThreadPool pool{4};
+  std::vector<std::thread::id> first_owners(4 * 1000);
+  std::vector<std::thread::id> second_owners(4 * 1000);
+  const auto record = [](std::vector<std::thread::id>& owners) {
+    return [&owners](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        owners[i] = std::this_thread::get_id();
+      }
+    };
+  };
+  pool.parallel_for(first_owners.size(), record(first_owners), 1000);
+  pool.parallel_for(second_owners.size(), record(second_owners), 1000);
+
+  ASSERT_EQ(first_owners, second_owners);
+  ASSERT_EQ(std::set<std::thread::id>(first_owners.begin(), first_owners.end()).size(), 4UL);
+}
+
+TEST(ThreadPool, ParallelForRethrows)
+{
+  mf::ThreadPool pool{4};
+  std::atomic<std::size_t> chunk_count{0};
+  ASSERT_THROW(
+    pool.parallel_for(
+      4 * 1000,
+      [&chunk_count](std::size_t first, [[maybe_unused]] std::size_t last) {
+        ++chunk_count;
+        if (first != 0)
+        {
+          throw std::runtime_error{"chunk failed"};
+        }
+      },
+      1000),
+    std::runtime_error);
+  ASSERT_EQ(chunk_count.load(), 4UL);
+
+  // Pool is still usable after a failed job
+  std::atomic<std::size_t> total{0};
+  pool.parallel_for(
+    4 * 1000, [&total](std::size_t first, std::size_t last) { total += last - first; }, 1000);
+  ASSERT_EQ(total.load(), 4UL * 1000UL);
+}
+
+TEST(ThreadPool, NestedParallelForRunsOnCallingThread)
+{
+  mf::ThreadPool pool{4};
+  std::vector<int> visits(4 * 100, 0);
+  pool.parallel_for(
+    4,
+    [&pool, &visits](std::size_t outer_first, std::size_t outer_last) {
+      for (std::size_t outer = outer_first; outer < outer_last; ++outer)
+      {
+        const auto outer_thread_id = std::this_thread::get_id();
+        pool.parallel_for_stealing(
+          100,
+          [&visits, outer, outer_thread_id](std::size_t first, std::size_t last) {
+            ASSERT_EQ(std::this_thread::get_id(), outer_thread_id);
+            for (std::size_t i = first; i < last; ++i)
+            {
+              ++visits[outer * 100 + i];
+            }
+          },
+          10);
+      }
+    },
+    1);
+
+  for (const int count : visits)
+  {
+    ASSERT_EQ(count, 1);
+  }
+}
+
+TEST(ThreadPool, ParallelForStealingCoversRangeOnBlockBoundaries)
+{
+  mf::ThreadPool pool{4};
+  std::vector<int> visits(10007, 0);
+  std::mutex ranges_mutex;
+  std::vector<std::pair<std::size_t, std::size_t>> ranges;
+  pool.parallel_for_stealing(
+    visits.size(),
+    [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        ++visits[i];
+      }
+      std::lock_guard<std::mutex> lock{ranges_mutex};
+      ranges.emplace_back(first, last);
+    },
+    64,
+    5);
+
+  for (const int count : visits)
+  {
+    ASSERT_EQ(count, 1);
+  }
+  ASSERT_GT(ranges.size(), 1UL);
+  for (const auto& [first, last] : ranges)
+  {
+    ASSERT_TRUE(first == 0 or (first % 64) == 5);
+    ASSERT_TRUE(last == visits.size() or (last % 64) == 5);
+  }
+}
@@ -0,0 +1,202 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/tiled_multi_field_array.hpp>
+
+TEST(TiledMultiFieldArray, Layout)
+{
+  using layout_type = mf::TiledLayout<std::tuple<char, float, double>, 8>;
+
+  ASSERT_EQ(layout_type::offsets[0], 0UL);
+  ASSERT_EQ(layout_type::offsets[1], 32UL);
+  ASSERT_EQ(layout_type::offsets[2], 64UL);
+  ASSERT_EQ(layout_type::tile_alignment, 64UL);
+  ASSERT_EQ(layout_type::tile_stride, 128UL);
+}
+
+TEST(TiledMultiFieldArray, DefaultCTor)
+{
+  mf::tiled_multi_field_array<8, float, int, std::string> tiled_multi_field_array;
+
+  ASSERT_TRUE(tiled_multi_field_array.empty());
+  ASSERT_EQ(tiled_multi_field_array.size(), 0UL);
+  ASSERT_EQ(tiled_multi_field_array.capacity(), 0UL);
+  ASSERT_EQ(tiled_multi_field_array.begin(), tiled_multi_field_array.end());
+}
+
+TEST(TiledMultiFieldArray, InitialSizeAndValueCTor)
+{
+  mf::tiled_multi_field_array<8, float, int, std::string> tiled_multi_field_array{
+    10, std::forward_as_tuple(4.f, 1, "bbb")};
+
+  ASSERT_EQ(tiled_multi_field_array.size(), 10UL);
+  ASSERT_EQ(tiled_multi_field_array.capacity(), 16UL);
+  ASSERT_EQ(tiled_multi_field_array.tile_count(), 2UL);
+  for (const auto& [f, i, s] : tiled_multi_field_array)
+  {
+    ASSERT_EQ(f, 4.f);
+    ASSERT_EQ(i, 1);
+    ASSERT_EQ(s, "bbb");
+  }
+}
+
+TEST(TiledMultiFieldArray, EmplaceBackAndGet)
+{
+  mf::tiled_multi_field_array<4, int, std::string, double> tiled_multi_field_array;
+  for (int i = 0; i < 1000; ++i)
+  {
+    tiled_multi_field_array.emplace_back(i, std::to_string(i), 0.5 * i);
+  }
+
+  ASSERT_EQ(tiled_multi_field_array.size(), 1000UL);
+  ASSERT_EQ(tiled_multi_field_array.capacity() % 4UL, 0UL);
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto& [n, s] = tiled_multi_field_array.get<int, std::string>(i);
+    ASSERT_EQ(n, i);
+    ASSERT_EQ(s, std::to_string(i));
+    ASSERT_EQ(tiled_multi_field_array.get<double>(i), 0.5 * i);
+  }
+}
+
+TEST(TiledMultiFieldArray, EmplaceBackPiecewiseAndDefault)
+{
+  mf::tiled_multi_field_array<4, int, std::string> tiled_multi_field_array;
+  tiled_multi_field_array.emplace_back(std::piecewise_construct, std::make_tuple(3), std::make_tuple("abc"));
+  tiled_multi_field_array.emplace_back();
+
+  ASSERT_EQ(tiled_multi_field_array.get<int>(0), 3);
+  ASSERT_EQ(tiled_multi_field_array.get<std::string>(0), "abc");
+  ASSERT_EQ(tiled_multi_field_array.get<int>(1), 0);
+  ASSERT_TRUE(tiled_multi_field_array.get<std::string>(1).empty());
+}
+
+TEST(TiledMultiFieldArray, FieldsContiguousWithinTile)
+{
+  mf::tiled_multi_field_array<8, float, double, int> tiled_multi_field_array{20};
+
+  for (std::size_t i = 1; i < 20; ++i)
+  {
+    if (i % 8 != 0)
+    {
+      ASSERT_EQ(&tiled_multi_field_array.get<double>(i), &tiled_multi_field_array.get<double>(i - 1) + 1);
+    }
+  }
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&tiled_multi_field_array.get<float>(8)) % 32UL, 0UL);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&tiled_multi_field_array.get<double>(8)) % 64UL, 0UL);
+}
+
+TEST(TiledMultiFieldArray, TileIteration)
+{
+  mf::tiled_multi_field_array<8, int, float, std::string> tiled_multi_field_array;
+  for (int i = 0; i < 20; ++i)
+  {
+    tiled_multi_field_array.emplace_back(i, static_cast<float>(i), std::to_string(i));
+  }
+
+  std::size_t tile_count = 0;
+  int expected = 0;
+  for (auto tile : tiled_multi_field_array.view<int, float>().tiles())
+  {
+    ASSERT_EQ(tile.size(), (tile_count < 2) ? 8UL : 4UL);
+
+    // Each field is contiguous within a tile
+    const int* const values = &std::get<0>(tile[0]);
+    for (std::size_t i = 0; i < tile.size(); ++i)
+    {
+      ASSERT_EQ(values[i], expected++);
+    }
+    ++tile_count;
+  }
+  ASSERT_EQ(tile_count, 3UL);
+  ASSERT_EQ(expected, 20);
+
+  const auto& const_tiled_multi_field_array = tiled_multi_field_array;
+  for (const auto& [i, s] : const_tiled_multi_field_array.view<0, 2>().tile(1))
+  {
+    ASSERT_EQ(std::to_string(i), s);
+  }
+}
+
+TEST(TiledMultiFieldArray, ViewIteration)
+{
+  mf::tiled_multi_field_array<4, int, float, std::string> tiled_multi_field_array{
+    10, std::forward_as_tuple(2, 1.f, "")};
+
+  int n = 0;
+  for (auto [i, s] : tiled_multi_field_array.view<int, std::string>())
+  {
+    i = n++;
+    s = std::to_string(i);
+  }
+
+  const auto view = std::as_const(tiled_multi_field_array).view<0, 2>();
+  ASSERT_EQ(std::distance(view.begin(), view.end()), 10);
+  for (const auto& [i, s] : view)
+  {
+    ASSERT_EQ(std::to_string(i), s);
+  }
+  ASSERT_THROW(view.at(10), std::out_of_range);
+}
+
+TEST(TiledMultiFieldArray, PopBackAndResize)
+{
+  mf::tiled_multi_field_array<4, int, std::string> tiled_multi_field_array;
+  tiled_multi_field_array.resize(9, std::forward_as_tuple(7, "ok"));
+  ASSERT_EQ(tiled_multi_field_array.size(), 9UL);
+  ASSERT_EQ(tiled_multi_field_array.get<std::string>(8), "ok");
+
+  tiled_multi_field_array.pop_back();
+  ASSERT_EQ(tiled_multi_field_array.size(), 8UL);
+
+  tiled_multi_field_array.resize(3);
+  ASSERT_EQ(tiled_multi_field_array.size(), 3UL);
+
+  tiled_multi_field_array.resize(6);
+  ASSERT_EQ(tiled_multi_field_array.get<std::string>(2), "ok");
+  ASSERT_TRUE(tiled_multi_field_array.get<std::string>(5).empty());
+}
+
+TEST(TiledMultiFieldArray, CopyAndMove)
+{
+  mf::tiled_multi_field_array<4, int, std::string> tiled_multi_field_array;
+  for (int i = 0; i < 6; ++i)
+  {
+    tiled_multi_field_array.emplace_back(i, std::to_string(i));
+  }
+
+  auto copied = tiled_multi_field_array;
+  ASSERT_EQ(copied.size(), 6UL);
+  ASSERT_EQ(copied.get<std::string>(5), "5");
+
+  auto moved = std::move(tiled_multi_field_array);
+  ASSERT_EQ(moved.size(), 6UL);
+  ASSERT_EQ(moved.get<std::string>(5), "5");
+  ASSERT_TRUE(tiled_multi_field_array.empty());
+
+  copied.emplace_back(6, "6");
+  moved.swap(copied);
+  ASSERT_EQ(moved.size(), 7UL);
+  ASSERT_EQ(copied.size(), 6UL);
+
+  copied = moved;
+  ASSERT_EQ(copied.size(), 7UL);
+  ASSERT_EQ(copied.get<std::string>(6), "6");
+
+  tiled_multi_field_array = std::move(copied);
+  ASSERT_EQ(tiled_multi_field_array.size(), 7UL);
+  ASSERT_EQ(std::get<1>(tiled_multi_field_array.at(6)), "6");
+}
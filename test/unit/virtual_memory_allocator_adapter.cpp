@@ -0,0 +1,139 @@
+/**
+ * @copyright 2022 MF
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <array>
+#include <new>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MF
+#include <mf/virtual_memory_allocator_adapter.hpp>
+
+TEST(VirtualMemoryAllocatorAdapter, AllocateResizeInPlace)
+{
+  mf::virtual_memory_allocator_adapter<1UL << 20UL, float, int, std::string> allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(10);
+
+  std::get<int*>(tuple_of_ptrs)[9] = 9;
+
+  ASSERT_TRUE(allocator.resize_in_place(tuple_of_ptrs, 10, 100000));
+
+  std::get<int*>(tuple_of_ptrs)[99999] = 99999;
+  ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[9], 9);
+
+  ASSERT_TRUE(allocator.resize_in_place(tuple_of_ptrs, 100000, 10));
+  ASSERT_EQ(std::get<int*>(tuple_of_ptrs)[9], 9);
+
+  allocator.deallocate(tuple_of_ptrs, 10);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, ResizeInPlaceBeyondReservation)
+{
+  mf::virtual_memory_allocator_adapter<100UL, float, int> allocator;
+
+  auto tuple_of_ptrs = allocator.allocate(10);
+
+  ASSERT_FALSE(allocator.resize_in_place(tuple_of_ptrs, 10, 101));
+
+  allocator.deallocate(tuple_of_ptrs, 10);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, AllocateBeyondReservation)
+{
+  mf::virtual_memory_allocator_adapter<100UL, float, int> allocator;
+
+  ASSERT_THROW(allocator.allocate(101), std::bad_alloc);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, FailedReservationReleasesOtherFields)
+{
+  // Second field needs more address space than any process has, so every allocation fails after reserving the first
+  using huge_type = std::array<char, 1UL << 14UL>;
+  mf::virtual_memory_allocator_adapter<1UL << 42UL, char, huge_type> failing_allocator;
+
+  // Leaking the first field on each failure would exhaust the address space well before the last iteration
+  for (int i = 0; i < 64; ++i)
+  {
+    ASSERT_THROW(failing_allocator.allocate(1), std::bad_alloc);
+  }
+
+  mf::virtual_memory_allocator_adapter<1UL << 42UL, char> allocator;
+  auto tuple_of_ptrs = allocator.allocate(1);
+  allocator.deallocate(tuple_of_ptrs, 1);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, MultiFieldArrayNeverRelocates)
+{
+  mf::virtual_memory_multi_field_array<1UL << 20UL, float, int, std::string> multi_field_array;
+
+  multi_field_array.emplace_back(0.f, 0, "0");
+
+  const auto* const first_float_ptr = &multi_field_array.get<float>(0);
+  const auto* const first_string_ptr = &multi_field_array.get<std::string>(0);
+
+  for (int i = 1; i < 50000; ++i)
+  {
+    multi_field_array.emplace_back(static_cast<float>(i), i, std::to_string(i));
+  }
+
+  ASSERT_EQ(first_float_ptr, &multi_field_array.get<float>(0));
+  ASSERT_EQ(first_string_ptr, &multi_field_array.get<std::string>(0));
+
+  for (int i = 0; i < 50000; ++i)
+  {
+    ASSERT_EQ(multi_field_array.get<float>(i), static_cast<float>(i));
+    ASSERT_EQ(multi_field_array.get<int>(i), i);
+    ASSERT_EQ(multi_field_array.get<std::string>(i), std::to_string(i));
+  }
+}
+
+TEST(VirtualMemoryAllocatorAdapter, MultiFieldArrayCapacityLimit)
+{
+  mf::virtual_memory_multi_field_array<100UL, float, int> multi_field_array;
+
+  for (int i = 0; i < 100; ++i)
+  {
+    multi_field_array.emplace_back(static_cast<float>(i), i);
+  }
+
+  ASSERT_EQ(multi_field_array.capacity(), 100UL);
+  ASSERT_THROW(multi_field_array.emplace_back(0.f, 0), std::bad_alloc);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, MultiFieldArrayShrinkToFitKeepsAddresses)
+{
+  mf::virtual_memory_multi_field_array<1UL << 20UL, int, std::string> multi_field_array;
+  multi_field_array.resize(100000);
+
+  const auto* const first_int_ptr = &multi_field_array.get<int>(0);
+  multi_field_array.resize(10);
+  multi_field_array.shrink_to_fit();
+
+  ASSERT_EQ(multi_field_array.capacity(), 10UL);
+  ASSERT_EQ(&multi_field_array.get<int>(0), first_int_ptr);
+
+  multi_field_array.resize(100);
+  ASSERT_EQ(&multi_field_array.get<int>(0), first_int_ptr);
+}
+
+TEST(VirtualMemoryAllocatorAdapter, MultiFieldArrayZeroedResize)
+{
+  mf::virtual_memory_multi_field_array<1UL << 20UL, int, double> multi_field_array;
+
+  multi_field_array.resize(100000, std::make_tuple(0, 0.0));
+  multi_field_array.get<double>(99999) = 1.0;
+  multi_field_array.clear();
+  multi_field_array.resize(200000, std::make_tuple(0, 0.0));
+
+  for (const auto& [i, d] : multi_field_array)
+  {
+    ASSERT_EQ(i, 0);
+    ASSERT_EQ(d, 0.0);
+  }
+}
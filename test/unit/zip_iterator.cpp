@@ -102,3 +102,37 @@ TEST(ZipIterator, StdPrev)
 
   ASSERT_EQ(std::distance(zip_itr_end, zip_itr_prev), -1);
 }
+
+TEST(IndexedZipIterator, ForLoop)
+{
+  std::string s{"oooo"};
+  std::vector<int> v{1, 1, 1, 1};
+
+  for (auto itr = mf::make_indexed_zip_iterator(0, s.begin(), v.begin());
+       itr != mf::make_indexed_zip_iterator(4, s.begin(), v.begin());
+       ++itr)
+  {
+    auto [c, i] = *itr;
+    ASSERT_EQ(c, 'o');
+    ASSERT_EQ(i, 1);
+    i = 2;
+  }
+
+  ASSERT_EQ(v, (std::vector<int>{2, 2, 2, 2}));
+}
+
+TEST(IndexedZipIterator, Offset)
+{
+  const std::string s{"abcd"};
+  const std::vector<int> v{1, 2, 3, 4};
+
+  const mf::IndexedZipRange<std::tuple<const char*, const int*>> range{std::make_tuple(s.data(), v.data()), 4};
+
+  ASSERT_TRUE((std::is_same_v<
+               std::iterator_traits<decltype(range.begin())>::iterator_category,
+               std::random_access_iterator_tag>));
+  ASSERT_EQ(std::distance(range.begin(), range.end()), 4);
+  ASSERT_EQ(std::get<0>(*(range.begin() + 2)), 'c');
+  ASSERT_EQ(std::get<1>(*std::prev(range.end())), 4);
+  ASSERT_EQ(std::get<1>(range[1]), 2);
+}